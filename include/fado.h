@@ -2,7 +2,72 @@
 /* SPDX-License-Identifier: AGPL-3.0-only */
 #pragma once
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
+#include "fado_memory.h"
+#include "fairy/fairy.h"
+#include "vc_vector/vc_vector_typed.h"
+
+typedef struct {
+    size_t symbolIndex;
+    int file;
+    uint32_t relocWord;
+} FadoRelocInfo;
+
+VC_VECTOR_DECLARE(FadoRelocInfo);
+
+/* Whether relocs against a symbol are kept, for each symbol of a file */
+typedef enum {
+    FADO_SYMBOL_UNKNOWN,
+    FADO_SYMBOL_KEPT,   /* Defined in the overlay */
+    FADO_SYMBOL_DROPPED /* Outside the overlay, so left to the linker */
+} FadoSymbolKept;
+
+/* Whether name is defined by an input file other than file, according to what data has of the other files */
+typedef bool (*FadoDefinedElsewhereFunc)(const char* name, int file, const void* data);
+
+typedef struct {
+    const vc_allocator* allocators[FADO_MEMORY_MAX]; /* Owners of the overlay's memory by category, NULL for libc */
+    const FairyContext* context;                     /* Options it was read with, NULL for the defaults */
+    int inputFilesCount;
+    FairyFileInfo* fileInfos;
+    bool ownsFileInfos; /* Whether destroying the overlay destroys them, false if they were passed in */
+    vc_vector_FadoRelocInfo relocList[FAIRY_SECTION_OTHER]; /* In the order they will be printed */
+    uint32_t sectionSizes[FAIRY_SECTION_OTHER];
+    uint32_t bssSize;
+    uint32_t relocCount;
+} FadoOverlay;
+
+extern const FairyDefineString relSectionNames[];
+extern const FairyDefineString relTypeNames[];
+
+uint32_t Fado_GetOvlSectionSize(uint32_t relocCount);
+uint32_t Fado_MakeRelocWord(FairySection section, const FairyRela* data);
+const char* Fado_GetRelocSymbolName(const FadoOverlay* overlay, const FadoRelocInfo* relocInfo);
+bool Fado_IsSymbolKept(uint8_t* symbolsKept, const FairyFileInfo* fileInfo, int file, size_t symbolIndex,
+                       FadoDefinedElsewhereFunc definedElsewhere, const void* data);
+
+void Fado_ExtractRelocs(FadoOverlay* overlay, int inputFilesCount, FILE** inputFiles);
+void Fado_ExtractRelocsWithAllocator(FadoOverlay* overlay, int inputFilesCount, FILE** inputFiles,
+                                     const vc_allocator* allocator);
+void Fado_ExtractRelocsWithAllocators(FadoOverlay* overlay, int inputFilesCount, FILE** inputFiles,
+                                      const FairyContext* context,
+                                      const vc_allocator* const allocators[FADO_MEMORY_MAX]);
+void Fado_ExtractRelocsFromFileInfos(FadoOverlay* overlay, int inputFilesCount, FairyFileInfo* fileInfos,
+                                     const FairyContext* context,
+                                     const vc_allocator* const allocators[FADO_MEMORY_MAX]);
+bool Fado_ExtractRelocsFromBuffers(FadoOverlay* overlay, int inputFilesCount, const void* const inputBuffers[],
+                                   const size_t inputSizes[], const FairyContext* context,
+                                   const vc_allocator* const allocators[FADO_MEMORY_MAX]);
+void Fado_WriteRelocsHeader(FILE* outputFile, const uint32_t sectionSizes[FAIRY_SECTION_OTHER], uint32_t bssSize,
+                            uint32_t relocCount, const char* ovlName, bool literalSizes);
+void Fado_WriteRelocsSectionHeader(FILE* outputFile, FairySection section);
+void Fado_WriteReloc(FILE* outputFile, uint32_t relocWord, const char* symbolName);
+void Fado_WriteRelocsFooter(FILE* outputFile, uint32_t relocCount, const char* ovlName);
+void Fado_WriteRelocs(FILE* outputFile, const FadoOverlay* overlay, const char* ovlName, bool literalSizes);
+void Fado_WriteOvlSection(uint8_t* buffer, const FadoOverlay* overlay);
+void Fado_DestroyOverlay(FadoOverlay* overlay);
 
 void Fado_Relocs(FILE* outputFile, int inputFilesCount, FILE** inputFiles, const char* ovlName);
 // void Fado_WriteRelocFile(FILE* outputFile, FILE** inputFiles, int inputFilesCount);
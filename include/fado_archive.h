@@ -0,0 +1,31 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "vc_vector/vc_vector_typed.h"
+
+typedef struct {
+    char* name;
+    size_t offset; /* Of its data in the archive */
+    size_t size;
+} FadoArchiveMember;
+
+VC_VECTOR_DECLARE(FadoArchiveMember);
+
+/* An ar archive, mapped into memory whole, and its members in order */
+typedef struct {
+    const char* fileName;
+    const unsigned char* data;
+    size_t size;
+    vc_vector_FadoArchiveMember members;
+} FadoArchive;
+
+bool Fado_ArchiveOpen(FadoArchive* archive, const char* fileName);
+void Fado_ArchiveClose(FadoArchive* archive);
+const FadoArchiveMember* Fado_ArchiveFindMember(const FadoArchive* archive, const char* name);
+bool Fado_ArchiveMemberIsObject(const FadoArchive* archive, const FadoArchiveMember* member);
+FILE* Fado_ArchiveOpenMember(const FadoArchive* archive, const FadoArchiveMember* member);
+char* Fado_ArchiveSplitInput(const char* input, char** memberNameOut);
@@ -0,0 +1,21 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include "fado.h"
+
+typedef struct {
+    uint32_t relocCount;
+    uint32_t sectionCounts[FAIRY_SECTION_OTHER];
+    uint32_t typeCounts[4]; /* R_MIPS_32, R_MIPS_26, R_MIPS_HI16, R_MIPS_LO16 */
+    uint32_t tableSize;     /* Size of the whole .ovl section in bytes */
+    uint32_t linesTouched;  /* Distinct data cache lines the relocated words are in */
+    uint32_t loopCycles;
+    uint32_t dmaCycles;
+} FadoLoadCost;
+
+void Fado_EstimateLoadCost(FadoLoadCost* cost, const FadoOverlay* overlay);
+void Fado_WriteLoadCostHeader(FILE* outputFile);
+void Fado_WriteLoadCost(FILE* outputFile, const FadoLoadCost* cost, const char* ovlName);
@@ -0,0 +1,10 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "fado.h"
+
+void Fado_WriteHotspots(FILE* outputFile, const FadoOverlay* overlay, const char* ovlName, char** inputFileNames,
+                        size_t topCount, bool json);
@@ -0,0 +1,18 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include "fairy/fairy.h"
+
+typedef struct {
+    const FairyContext* context;
+    int inputFilesCount;
+    char** inputFileNames;
+    const char* outputFileName;
+    const char* sidecarFileName; /* What each input contributed to the output last time */
+    const char* ovlName;
+    bool literalSizes;
+} FadoIncrementalOptions;
+
+bool Fado_Incremental(const FadoIncrementalOptions* options);
@@ -0,0 +1,38 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "fado_archive.h"
+#include "fairy/fairy.h"
+
+/* How the parts of the input files that Fairy reads were fetched */
+typedef struct {
+    bool usedIoUring;       /* Rather than pread */
+    size_t batches;         /* Waves of reads, each waiting for the last */
+    size_t reads;           /* Issued in those waves */
+    size_t bytesPrefetched;
+} FadoIoStats;
+
+bool Fado_OpenInputFiles(FILE** inputFiles, int inputFilesCount, char** fileNames, bool useIoUring,
+                         FadoIoStats* stats);
+
+/* The input files of an overlay, with archives expanded into their members */
+typedef struct {
+    int count;
+    char** names; /* File names, or "ARCHIVE(MEMBER)" for archive members */
+    FILE** files;
+    int pathCount;
+    char** paths; /* The files on disk that were read, each once, for dependency files */
+    int archiveCount;
+    FadoArchive* archives;
+    FadoArchive** memberArchives;      /* For each input, its archive, or NULL for a file on disk */
+    const FadoArchiveMember** members; /* For each input, its member, or NULL for a file on disk */
+} FadoInputs;
+
+bool Fado_ExpandInputs(FadoInputs* inputs, int argCount, char** args);
+bool Fado_OpenInputs(FadoInputs* inputs, bool useIoUring, FadoIoStats* stats);
+void Fado_CloseInputs(FadoInputs* inputs);
+void Fado_FreeInputs(FadoInputs* inputs);
@@ -0,0 +1,27 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "fado.h"
+#include "vc_vector/vc_vector_typed.h"
+
+typedef struct {
+    char* name;
+    uint32_t value;
+} FadoLinkSymbol;
+
+VC_VECTOR_DECLARE(FadoLinkSymbol);
+
+/* Addresses of the symbols outside the overlay that it refers to, sorted by name */
+typedef struct {
+    vc_vector_FadoLinkSymbol symbols;
+} FadoLinkSymbols;
+
+bool Fado_ReadLinkSymbols(FadoLinkSymbols* symbols, FILE* file, const char* fileName);
+void Fado_DestroyLinkSymbols(FadoLinkSymbols* symbols);
+
+bool Fado_LinkOverlay(FILE* outputFile, const FadoOverlay* overlay, FILE** inputFiles, char** inputFileNames,
+                      uint32_t vram, const FadoLinkSymbols* externals);
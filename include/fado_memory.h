@@ -0,0 +1,34 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdio.h>
+#include "fairy/fairy.h"
+#include "vc_vector/vc_allocator.h"
+
+/* What fado's memory is used for. The first ones are Fairy's, so a FadoMemory can be passed to it as is. */
+typedef enum {
+    FADO_MEMORY_SECTION_TABLES = FAIRY_MEMORY_SECTION_TABLE,
+    FADO_MEMORY_SYMTABS = FAIRY_MEMORY_SYMTAB,
+    FADO_MEMORY_STRTABS = FAIRY_MEMORY_STRTAB,
+    FADO_MEMORY_RELOCS = FAIRY_MEMORY_RELOCS, /* The input reloc sections */
+    FADO_MEMORY_STRING_VECTORS = FAIRY_MEMORY_MAX,
+    FADO_MEMORY_OUTPUT,   /* The lists of relocs to write */
+    FADO_MEMORY_FILE_INFO, /* Per-file bookkeeping */
+    FADO_MEMORY_MAX
+} FadoMemoryCategory;
+
+/**
+ * Counting allocators for each category of fado's memory, which also count into a total
+ */
+typedef struct {
+    vc_counting_allocator total;
+    vc_counting_allocator counters[FADO_MEMORY_MAX];
+    vc_allocator allocators[FADO_MEMORY_MAX];
+    const vc_allocator* categories[FADO_MEMORY_MAX]; /* Points into allocators, to be passed to Fado/Fairy */
+} FadoMemory;
+
+void Fado_MemoryInit(FadoMemory* memory, const vc_allocator* parent);
+
+void Fado_MemoryWrite(FILE* outputFile, const FadoMemory* memory);
+void Fado_MemoryWriteJson(FILE* outputFile, const FadoMemory* memory);
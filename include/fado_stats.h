@@ -0,0 +1,85 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "fado_memory.h"
+#include "fairy/fairy.h"
+#include "vc_vector/vc_vector_typed.h"
+
+typedef enum {
+    FADO_PHASE_OPEN,     /* Opening the input files */
+    FADO_PHASE_READ,     /* Fairy_InitFile, also recorded per file */
+    FADO_PHASE_STRINGS,  /* Building the lists of defined symbol names */
+    FADO_PHASE_FILTER,   /* Choosing the relocs to keep */
+    FADO_PHASE_OUTPUT,   /* Writing the .ovl section */
+    FADO_PHASE_TEARDOWN, /* Freeing everything */
+    FADO_PHASE_MAX
+} FadoPhase;
+
+typedef enum {
+    FADO_COUNTER_CYCLES,
+    FADO_COUNTER_INSTRUCTIONS,
+    FADO_COUNTER_CACHE_MISSES,
+    FADO_COUNTER_MAX
+} FadoCounter;
+
+typedef struct {
+    uint32_t calls;
+    uint64_t nanoseconds;
+    uint64_t counters[FADO_COUNTER_MAX];
+} FadoPhaseStats;
+
+typedef struct {
+    uint64_t nanoseconds;
+    uint64_t counters[FADO_COUNTER_MAX];
+} FadoStatsSnapshot;
+
+/* A span of the trace: one phase, or the part of one for a single input file or one section of it */
+typedef struct {
+    FadoPhase phase;
+    int file;    /* -1 if not for a single file */
+    int section; /* -1 if not for a single section */
+    uint64_t startNs;
+    uint64_t endNs;
+} FadoTraceEvent;
+
+VC_VECTOR_DECLARE(FadoTraceEvent);
+
+/**
+ * What has been recorded about a run, owned by the caller and reached through FairyContext's stats, so that separate
+ * runs in the same process keep separate statistics. The Fado_Stats functions ignore a NULL stats, so they can be left
+ * in the code unconditionally.
+ */
+typedef struct FadoStats {
+    bool tracing; /* Also record every phase as a span on a timeline, for Fado_TraceWrite */
+    bool haveCounters;
+    int perfFds[FADO_COUNTER_MAX]; /* The first is the group leader */
+    FadoStatsSnapshot phaseStarts[FADO_PHASE_MAX];
+    FadoPhaseStats phases[FADO_PHASE_MAX];
+    int inputFilesCount;
+    FadoPhaseStats* files; /* FADO_PHASE_READ of each input file */
+    uint32_t relocsKept;
+    uint32_t relocsDropped;
+    size_t bytesRead;
+    const FadoMemory* memory; /* Reported alongside, if set */
+    vc_vector_FadoTraceEvent traceEvents;
+} FadoStats;
+
+void Fado_StatsInit(FadoStats* stats, const FairyContext* context, int inputFilesCount, bool tracing);
+void Fado_StatsDestroy(FadoStats* stats);
+FadoStats* Fado_StatsOf(const FairyContext* context);
+
+void Fado_StatsBegin(FadoStats* stats, FadoPhase phase);
+void Fado_StatsEnd(FadoStats* stats, FadoPhase phase);
+void Fado_StatsEndFile(FadoStats* stats, FadoPhase phase, int file);
+void Fado_StatsEndSection(FadoStats* stats, FadoPhase phase, int file, FairySection section);
+void Fado_StatsSetRelocCounts(FadoStats* stats, uint32_t kept, uint32_t dropped);
+void Fado_StatsAddBytesRead(FadoStats* stats, size_t bytes);
+void Fado_StatsSetMemory(FadoStats* stats, const FadoMemory* memory);
+
+void Fado_StatsWrite(const FadoStats* stats, FILE* outputFile, char** inputFileNames);
+void Fado_StatsWriteJson(const FadoStats* stats, FILE* outputFile, char** inputFileNames);
+void Fado_TraceWrite(const FadoStats* stats, FILE* outputFile, char** inputFileNames);
@@ -0,0 +1,9 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdio.h>
+#include "fado.h"
+
+int Fado_CheckSizeSymbols(FILE* elfFile, const FadoOverlay* overlay, const char* ovlName);
+int Fado_Verify(FILE* overlayFile, const FadoOverlay* overlay, const char* ovlName);
@@ -0,0 +1,17 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include "fairy/fairy.h"
+
+typedef struct {
+    const FairyContext* context;
+    int inputFilesCount;
+    char** inputFileNames;
+    const char* outputFileName;
+    const char* ovlName;
+    bool literalSizes;
+} FadoWatchOptions;
+
+bool Fado_Watch(const FadoWatchOptions* options);
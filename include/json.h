@@ -0,0 +1,7 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdio.h>
+
+void Json_WriteString(FILE* outputFile, const char* string);
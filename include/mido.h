@@ -1,6 +1,32 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdio.h>
 #include "vc_vector/vc_vector.h"
 
+typedef enum {
+    MIDO_FORMAT_MAKE, /* Each rule followed by an empty rule for each input, so make does not fail if one is deleted */
+    MIDO_FORMAT_NINJA /* Just the rules, as ninja's deps = gcc expects */
+} MidoFormat;
+
+typedef struct {
+    MidoFormat format;
+    bool writeIfChanged; /* Leave the file untouched if it already has the same contents */
+} MidoOptions;
+
+/* A dependency file being put together in memory, from one or more rules */
+typedef struct {
+    const MidoOptions* options;
+    FILE* stream;
+    char* contents;
+    size_t size;
+} MidoDependencyFile;
+
 int Mido_WriteDependencyFile(FILE* dependencyFile, const char* relocFile, vc_vector* inputFilesVector);
+
+void Mido_WriteRule(FILE* dependencyFile, const char* target, int inputFilesCount, char** inputFiles,
+                    MidoFormat format);
+bool Mido_Begin(MidoDependencyFile* dependencyFile, const MidoOptions* options);
+void Mido_AddRule(MidoDependencyFile* dependencyFile, const char* target, int inputFilesCount, char** inputFiles);
+bool Mido_End(MidoDependencyFile* dependencyFile, const char* fileName);
+int Mido_WriteFileIfChanged(const char* fileName, const char* contents, size_t size);
@@ -397,6 +397,12 @@ typedef struct {
 #define SHT_LOUSER 0x80000000      /* Start of application-specific */
 #define SHT_HIUSER 0x8fffffff      /* End of application-specific */
 
+/* Legal values for sh_flags (section flags).  */
+
+#define SHF_WRITE (1 << 0)     /* Writable */
+#define SHF_ALLOC (1 << 1)     /* Occupies memory during execution */
+#define SHF_EXECINSTR (1 << 2) /* Executable */
+
 /* Symbol table entry.  */
 
 typedef struct {
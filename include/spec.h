@@ -0,0 +1,28 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "vc_vector/vc_vector_typed.h"
+
+VC_VECTOR_DECLARE_NAMED(specPath, char*);
+
+/* A beginseg ... endseg block of a spec file */
+typedef struct {
+    char* name;
+    vc_vector_specPath includes; /* In the order they are linked */
+    int line;                    /* Of the beginseg, for messages */
+} SpecSegment;
+
+VC_VECTOR_DECLARE(SpecSegment);
+
+typedef struct {
+    vc_vector_SpecSegment segments;
+} Spec;
+
+bool Spec_Read(Spec* spec, FILE* file, const char* fileName);
+void Spec_Destroy(Spec* spec);
+
+const char* Spec_GetRelocInclude(const SpecSegment* segment);
+char* Spec_GetRelocOutput(const char* relocInclude);
@@ -16,26 +16,94 @@
 #include "vc_vector/vc_vector.h"
 #include "macros.h"
 
-VerbosityLevel gVerbosity = VERBOSITY_NONE;
-bool gUseElfAlignment = false;
+static const char* sVerbosityNames[] = { "none", "info", "debug" };
 
-int Fairy_DebugPrintf(const char* file, int line, const char* func, VerbosityLevel level, const char* fmt, ...) {
-    if (gVerbosity >= level) {
+/**
+ * Print a log message as a single line of key=value pairs, with the message quoted and any trailing newline removed
+ */
+static int Fairy_LogStructured(const char* file, int line, const char* func, VerbosityLevel level, const char* fmt,
+                               va_list args) {
+    char buffer[256];
+    char* message = buffer;
+    const char* c;
+    size_t length;
+    va_list argsCopy;
+    int ret = 0;
+
+    va_copy(argsCopy, args);
+    length = vsnprintf(buffer, sizeof(buffer), fmt, args);
+    if (length >= sizeof(buffer)) {
+        message = malloc(length + 1);
+        vsnprintf(message, length + 1, fmt, argsCopy);
+    }
+    va_end(argsCopy);
+
+    while ((length > 0) && (message[length - 1] == '\n')) {
+        message[--length] = '\0';
+    }
+
+    ret += fprintf(stderr, "level=%s file=%s line=%d func=%s msg=\"", sVerbosityNames[level], file, line, func);
+    for (c = message; *c != '\0'; c++) {
+        switch (*c) {
+            case '"':
+            case '\\':
+                ret += fprintf(stderr, "\\%c", *c);
+                break;
+
+            case '\n':
+                ret += fprintf(stderr, "\\n");
+                break;
+
+            default:
+                fputc(*c, stderr);
+                ret++;
+                break;
+        }
+    }
+    ret += fprintf(stderr, "\"\n");
+
+    if (message != buffer) {
+        free(message);
+    }
+    return ret;
+}
+
+int Fairy_DebugPrintf(const FairyContext* context, const char* file, int line, const char* func, VerbosityLevel level,
+                      const char* fmt, ...) {
+    if ((context != NULL) && (context->verbosity >= level)) {
         int ret = 0;
         va_list args;
         va_start(args, fmt);
 
-        if (gVerbosity >= VERBOSITY_DEBUG) {
-            ret += fprintf(stderr, "%s:%d:%s: ", file, line, func);
-        }
+        if (context->logStructured) {
+            ret = Fairy_LogStructured(file, line, func, level, fmt, args);
+        } else {
+            if (context->verbosity >= VERBOSITY_DEBUG) {
+                ret += fprintf(stderr, "%s:%d:%s: ", file, line, func);
+            }
 
-        ret += vfprintf(stderr, fmt, args);
+            ret += vfprintf(stderr, fmt, args);
+        }
         va_end(args);
         return ret;
     }
     return 0;
 }
 
+/**
+ * The default options: no logging, and sections padded to 0x10 as the original build tools do
+ */
+void Fairy_InitContext(FairyContext* context) {
+    context->verbosity = VERBOSITY_NONE;
+    context->logStructured = false;
+    context->useElfAlignment = false;
+    context->stats = NULL;
+}
+
+static size_t Fairy_Read(void* buffer, size_t size, FILE* file) {
+    return fread(buffer, sizeof(char), size, file);
+}
+
 /* Endian readers. MIPS is BE, so only need these */
 static Elf32_Half Fairy_ReadHalf(const uint8_t* data) {
     return data[0] << 8 | data[1] << 0;
@@ -103,9 +171,16 @@ bool Fairy_StartsWith(const char* string, const char* initial) {
  * - The rest of the arguments are important information about the struct it is reading (offset and size, usually)
  */
 
-FairyFileHeader* Fairy_ReadFileHeader(FairyFileHeader* header, FILE* file) {
+/**
+ * Reads any 32-bit big-endian MIPS ELF header (relocatable, executable, ...). Fairy_ReadFileHeader should be used for
+ * the object files that Fado takes as input.
+ */
+FairyFileHeader* Fairy_ReadElfHeader(FairyFileHeader* header, FILE* file) {
     fseek(file, 0, SEEK_SET);
-    assert(fread(header, sizeof(char), 0x34, file) == 0x34);
+    if (Fairy_Read(header, 0x34, file) != 0x34) {
+        fprintf(stderr, "File too short to be an ELF file.\n");
+        return NULL;
+    }
 
     if (!Fairy_VerifyMagic(header->e_ident)) {
         fprintf(stderr, "Not a valid ELF file.\n");
@@ -118,11 +193,6 @@ FairyFileHeader* Fairy_ReadFileHeader(FairyFileHeader* header, FILE* file) {
     }
 
     header->e_type = REEND16(header->e_type);
-    if (header->e_type != ET_REL) {
-        fprintf(stderr, "Not a relocatable object file.\n");
-        return NULL;
-    }
-
     header->e_machine = REEND16(header->e_machine);
     if (header->e_machine != EM_MIPS) {
         fprintf(stderr, "Not a MIPS object file.\n");
@@ -144,13 +214,26 @@ FairyFileHeader* Fairy_ReadFileHeader(FairyFileHeader* header, FILE* file) {
     return header;
 }
 
+FairyFileHeader* Fairy_ReadFileHeader(FairyFileHeader* header, FILE* file) {
+    if (Fairy_ReadElfHeader(header, file) == NULL) {
+        return NULL;
+    }
+
+    if (header->e_type != ET_REL) {
+        fprintf(stderr, "Not a relocatable object file.\n");
+        return NULL;
+    }
+
+    return header;
+}
+
 /* tableOffset and number should be obtained from the file header */
 FairySecHeader* Fairy_ReadSectionTable(FairySecHeader* sectionTable, FILE* file, size_t tableOffset, size_t number) {
     size_t entrySize = sizeof(FairySecHeader);
     size_t tableSize = number * entrySize;
 
     fseek(file, tableOffset, SEEK_SET);
-    assert(fread(sectionTable, sizeof(char), tableSize, file) == tableSize);
+    assert(Fairy_Read(sectionTable, tableSize, file) == tableSize);
 
     /* Since the section table happens to only have entries of width 4, we can byteswap it by pretending it is a raw
      * uint32_t array */
@@ -165,17 +248,21 @@ FairySecHeader* Fairy_ReadSectionTable(FairySecHeader* sectionTable, FILE* file,
     return sectionTable;
 }
 
-size_t Fairy_ReadSymbolTable(FairySym** symbolTableOut, FILE* file, size_t tableOffset, size_t tableSize) {
+/**
+ * Reads a symbol table, allocating it with the given allocator (NULL for libc). Returns the number of symbols read.
+ */
+size_t Fairy_ReadSymbolTableWithAllocator(FairySym** symbolTableOut, FILE* file, size_t tableOffset, size_t tableSize,
+                                          const vc_allocator* allocator) {
     size_t number = tableSize / sizeof(FairySym);
-    FairySym* symbolTable = malloc(tableSize);
+    FairySym* symbolTable = vc_allocator_alloc(allocator, tableSize);
 
     *symbolTableOut = NULL;
 
     if (symbolTable == NULL) {
         return 0;
     }
-    if (fseek(file, tableOffset, SEEK_SET) != 0 || fread(symbolTable, sizeof(char), tableSize, file) != tableSize) {
-        free(symbolTable);
+    if (fseek(file, tableOffset, SEEK_SET) != 0 || Fairy_Read(symbolTable, tableSize, file) != tableSize) {
+        vc_allocator_free(allocator, symbolTable);
         return 0;
     }
 
@@ -194,32 +281,41 @@ size_t Fairy_ReadSymbolTable(FairySym** symbolTableOut, FILE* file, size_t table
     return number;
 }
 
+size_t Fairy_ReadSymbolTable(FairySym** symbolTableOut, FILE* file, size_t tableOffset, size_t tableSize) {
+    return Fairy_ReadSymbolTableWithAllocator(symbolTableOut, file, tableOffset, tableSize, NULL);
+}
+
 /* Can be used for both the section header string table and the strtab */
 char* Fairy_ReadStringTable(char* stringTable, FILE* file, size_t tableOffset, size_t tableSize) {
     fseek(file, tableOffset, SEEK_SET);
-    assert(fread(stringTable, sizeof(char), tableSize, file) == tableSize);
+    assert(Fairy_Read(stringTable, tableSize, file) == tableSize);
     return stringTable;
 }
 
-/* offset and number are attained from the section table, the returned pointer must be freed */
-size_t Fairy_ReadRelocs(FairyRela** relocsOut, FILE* file, int type, size_t offset, size_t size) {
+/**
+ * offset and number are attained from the section table, the returned pointer must be freed with the same allocator
+ * (NULL for libc)
+ */
+size_t Fairy_ReadRelocsWithAllocator(FairyRela** relocsOut, FILE* file, int type, size_t offset, size_t size,
+                                     const vc_allocator* allocator) {
     /* Final size of the relocation table, relocations of type SHT_REL need more space for extra addend of 0 */
     size_t finalSize = (type == SHT_REL) ? ((size * sizeof(FairyRela)) / sizeof(FairyRel)) : size;
-    void* readBuf = malloc(size);
-    FairyRela* relocTable = malloc(finalSize);
+    void* readBuf = vc_allocator_alloc(allocator, size);
+    FairyRela* relocTable = vc_allocator_alloc(allocator, finalSize);
 
     *relocsOut = NULL;
 
     if (readBuf == NULL) {
+        vc_allocator_free(allocator, relocTable);
         return 0;
     }
     if (relocTable == NULL) {
-        free(readBuf);
+        vc_allocator_free(allocator, readBuf);
         return 0;
     }
-    if (fseek(file, offset, SEEK_SET) != 0 || fread(readBuf, sizeof(char), size, file) != size) {
-        free(readBuf);
-        free(relocTable);
+    if (fseek(file, offset, SEEK_SET) != 0 || Fairy_Read(readBuf, size, file) != size) {
+        vc_allocator_free(allocator, readBuf);
+        vc_allocator_free(allocator, relocTable);
         return 0;
     }
 
@@ -245,12 +341,17 @@ size_t Fairy_ReadRelocs(FairyRela** relocsOut, FILE* file, int type, size_t offs
     } else {
         memcpy(relocTable, readBuf, size);
     }
-    free(readBuf);
+    vc_allocator_free(allocator, readBuf);
 
     *relocsOut = relocTable;
     return finalSize / sizeof(FairyRela);
 }
 
+/* offset and number are attained from the section table, the returned pointer must be freed */
+size_t Fairy_ReadRelocs(FairyRela** relocsOut, FILE* file, int type, size_t offset, size_t size) {
+    return Fairy_ReadRelocsWithAllocator(relocsOut, file, type, offset, size, NULL);
+}
+
 char* Fairy_GetSectionName(FairySecHeader* sectionTable, char* shstrtab, size_t index) {
     return &shstrtab[sectionTable[index].sh_name];
 }
@@ -262,28 +363,46 @@ char* Fairy_GetSymbolName(FairySym* symtab, char* strtab, size_t index) {
 
 /* FairyFileInfo functions */
 
-void Fairy_InitFile(FairyFileInfo* fileInfo, FILE* file) {
+/**
+ * Reads the information fado needs from a relocatable object, with the options of context (NULL for the defaults),
+ * which must outlive fileInfo. Memory owned by fileInfo is taken from the allocator of its FairyMemoryCategory (NULL
+ * for libc), and is returned to it by Fairy_DestroyFile.
+ */
+void Fairy_InitFileWithAllocators(FairyFileInfo* fileInfo, FILE* file, const FairyContext* context,
+                                  const vc_allocator* const allocators[FAIRY_MEMORY_MAX]) {
     FairyFileHeader fileHeader;
     FairySecHeader* sectionTable;
     char* shstrtab;
+    bool useElfAlignment = (context != NULL) && context->useElfAlignment;
     int i;
 
     assert(fileInfo != NULL);
     assert(file != NULL);
 
-    fileInfo->progBitsSections = vc_vector_create(3, sizeof(Elf32_Section), NULL);
+    for (i = 0; i < FAIRY_MEMORY_MAX; i++) {
+        fileInfo->allocators[i] = allocators[i];
+    }
+    vc_vector_init_with_allocator(&fileInfo->progBitsSections, 3, sizeof(Elf32_Section), NULL,
+                                  allocators[FAIRY_MEMORY_SECTION_TABLE]);
     for (i = 0; i < 3; i++) {
         fileInfo->progBitsSizes[i] = 0;
     }
+    fileInfo->bssSize = 0;
+    fileInfo->context = context;
     Fairy_ReadFileHeader(&fileHeader, file);
+    fileInfo->bytesRead = sizeof(FairyFileHeader);
 
-    sectionTable = malloc(fileHeader.e_shnum * fileHeader.e_shentsize);
+    sectionTable =
+        vc_allocator_alloc(allocators[FAIRY_MEMORY_SECTION_TABLE], fileHeader.e_shnum * fileHeader.e_shentsize);
     Fairy_ReadSectionTable(sectionTable, file, fileHeader.e_shoff, fileHeader.e_shnum);
+    fileInfo->bytesRead += fileHeader.e_shnum * sizeof(FairySecHeader);
 
-    shstrtab = malloc(sectionTable[fileHeader.e_shstrndx].sh_size * sizeof(char));
+    shstrtab = vc_allocator_alloc(allocators[FAIRY_MEMORY_STRTAB],
+                                  sectionTable[fileHeader.e_shstrndx].sh_size * sizeof(char));
     fseek(file, sectionTable[fileHeader.e_shstrndx].sh_offset, SEEK_SET);
-    assert(fread(shstrtab, sizeof(char), sectionTable[fileHeader.e_shstrndx].sh_size, file) ==
+    assert(Fairy_Read(shstrtab, sectionTable[fileHeader.e_shstrndx].sh_size, file) ==
            sectionTable[fileHeader.e_shstrndx].sh_size);
+    fileInfo->bytesRead += sectionTable[fileHeader.e_shstrndx].sh_size;
 
     /* Search for the sections we need */
     {
@@ -291,6 +410,7 @@ void Fairy_InitFile(FairyFileInfo* fileInfo, FILE* file) {
         FairySecHeader currentSection;
         for (currentIndex = 0; currentIndex < 3; currentIndex++) {
             fileInfo->relocTablesInfo[currentIndex].sectionData = NULL;
+            fileInfo->relocTablesInfo[currentIndex].sectionEntryCount = 0;
         }
 
         for (currentIndex = 0; currentIndex < fileHeader.e_shnum; currentIndex++) {
@@ -300,7 +420,7 @@ void Fairy_InitFile(FairyFileInfo* fileInfo, FILE* file) {
 
             switch (currentSection.sh_type) {
                 case SHT_PROGBITS:
-                    assert(vc_vector_push_back(fileInfo->progBitsSections, &currentIndex));
+                    assert(vc_vector_push_back(&fileInfo->progBitsSections, &currentIndex));
 
                     {
                         FairySection sectionType = FAIRY_SECTION_OTHER;
@@ -317,46 +437,64 @@ void Fairy_InitFile(FairyFileInfo* fileInfo, FILE* file) {
                         }
 
                         if (sectionType != FAIRY_SECTION_OTHER) {
-                            if (gUseElfAlignment) {
+                            if (useElfAlignment) {
                                 /* Ensure the next file will start at its correct alignment */
                                 fileInfo->progBitsSizes[sectionType] =
                                     ALIGN(fileInfo->progBitsSizes[sectionType], currentSection.sh_addralign);
 
                                 alignedSize = ALIGN(currentSection.sh_size, currentSection.sh_addralign);
 
-                                FAIRY_DEBUG_PRINTF("%s section alignment: 0x%X\n", sectionName,
+                                FAIRY_DEBUG_PRINTF(context, "%s section alignment: 0x%X\n", sectionName,
                                                    currentSection.sh_addralign);
-                                FAIRY_DEBUG_PRINTF("%s section size before align: 0x%X\n", sectionName,
+                                FAIRY_DEBUG_PRINTF(context, "%s section size before align: 0x%X\n", sectionName,
                                                    currentSection.sh_size);
-                                FAIRY_DEBUG_PRINTF("%s section size after align: 0x%X\n", sectionName, alignedSize);
+                                FAIRY_DEBUG_PRINTF(context, "%s section size after align: 0x%zX\n", sectionName,
+                                                   alignedSize);
 
                                 fileInfo->progBitsSizes[sectionType] += alignedSize;
                             } else {
                                 fileInfo->progBitsSizes[sectionType] += ALIGN(currentSection.sh_size, 0x10);
                             }
 
-                            FAIRY_DEBUG_PRINTF("%s section size: 0x%X\n", sectionName,
+                            FAIRY_DEBUG_PRINTF(context, "%s section size: 0x%X\n", sectionName,
                                                fileInfo->progBitsSizes[sectionType]);
                         }
                     }
 
                     break;
 
+                case SHT_NOBITS:
+                    /* Ignore the leading "." */
+                    if (strcmp(&shstrtab[currentSection.sh_name + 1], "bss") == 0) {
+                        if (useElfAlignment) {
+                            fileInfo->bssSize = ALIGN(fileInfo->bssSize, currentSection.sh_addralign);
+                            fileInfo->bssSize += ALIGN(currentSection.sh_size, currentSection.sh_addralign);
+                        } else {
+                            fileInfo->bssSize += ALIGN(currentSection.sh_size, 0x10);
+                        }
+
+                        FAIRY_DEBUG_PRINTF(context, "bss section size: 0x%X\n", fileInfo->bssSize);
+                    }
+                    break;
+
                 case SHT_SYMTAB:
                     if (strcmp(&shstrtab[currentSection.sh_name + 1], "symtab") == 0) {
                         fileInfo->symtabInfo.sectionType = SHT_SYMTAB;
                         fileInfo->symtabInfo.sectionEntrySize = sizeof(FairySym);
                         fileInfo->symtabInfo.sectionEntryCount =
-                            Fairy_ReadSymbolTable((FairySym**)&fileInfo->symtabInfo.sectionData, file,
-                                                  currentSection.sh_offset, currentSection.sh_size);
+                            Fairy_ReadSymbolTableWithAllocator((FairySym**)&fileInfo->symtabInfo.sectionData, file,
+                                                               currentSection.sh_offset, currentSection.sh_size,
+                                                               allocators[FAIRY_MEMORY_SYMTAB]);
+                        fileInfo->bytesRead += currentSection.sh_size;
                     }
                     break;
 
                 case SHT_STRTAB:
                     if (strcmp(&shstrtab[currentSection.sh_name + 1], "strtab") == 0) {
-                        FAIRY_DEBUG_PRINTF("%s", "strtab found\n");
-                        fileInfo->strtab = malloc(currentSection.sh_size);
+                        FAIRY_DEBUG_PRINTF(context, "%s", "strtab found\n");
+                        fileInfo->strtab = vc_allocator_alloc(allocators[FAIRY_MEMORY_STRTAB], currentSection.sh_size);
                         Fairy_ReadStringTable(fileInfo->strtab, file, currentSection.sh_offset, currentSection.sh_size);
+                        fileInfo->bytesRead += currentSection.sh_size;
                     }
                     break;
 
@@ -379,14 +517,16 @@ void Fairy_InitFile(FairyFileInfo* fileInfo, FILE* file) {
                         } else {
                             break;
                         }
-                        FAIRY_DEBUG_PRINTF("Found %s section\n", &shstrtab[currentSection.sh_name]);
+                        FAIRY_DEBUG_PRINTF(context, "Found %s section\n", &shstrtab[currentSection.sh_name]);
 
-                        relocCount = Fairy_ReadRelocs(&relocs, file, currentSection.sh_type, currentSection.sh_offset,
-                                                      currentSection.sh_size);
+                        relocCount = Fairy_ReadRelocsWithAllocator(&relocs, file, currentSection.sh_type,
+                                                                   currentSection.sh_offset, currentSection.sh_size,
+                                                                   allocators[FAIRY_MEMORY_RELOCS]);
+                        fileInfo->bytesRead += currentSection.sh_size;
 
                         /* Ignore empty reloc sections */
                         if (relocCount == 0) {
-                            free(relocs);
+                            vc_allocator_free(allocators[FAIRY_MEMORY_RELOCS], relocs);
                             break;
                         }
 
@@ -407,24 +547,42 @@ void Fairy_InitFile(FairyFileInfo* fileInfo, FILE* file) {
         }
     }
 
-    free(sectionTable);
-    free(shstrtab);
+    vc_allocator_free(allocators[FAIRY_MEMORY_SECTION_TABLE], sectionTable);
+    vc_allocator_free(allocators[FAIRY_MEMORY_STRTAB], shstrtab);
+}
+
+/**
+ * Reads the information fado needs from a relocatable object, taking all memory owned by fileInfo from allocator (NULL
+ * for libc)
+ */
+void Fairy_InitFileWithAllocator(FairyFileInfo* fileInfo, FILE* file, const vc_allocator* allocator) {
+    const vc_allocator* allocators[FAIRY_MEMORY_MAX];
+    size_t i;
+
+    for (i = 0; i < FAIRY_MEMORY_MAX; i++) {
+        allocators[i] = allocator;
+    }
+    Fairy_InitFileWithAllocators(fileInfo, file, NULL, allocators);
+}
+
+void Fairy_InitFile(FairyFileInfo* fileInfo, FILE* file) {
+    Fairy_InitFileWithAllocator(fileInfo, file, NULL);
 }
 
 void Fairy_DestroyFile(FairyFileInfo* fileInfo) {
     size_t i;
     for (i = 0; i < ARRAY_COUNTU(fileInfo->relocTablesInfo); i++) {
         if (fileInfo->relocTablesInfo[i].sectionData != NULL) {
-            FAIRY_DEBUG_PRINTF("Freeing reloc section %zd data\n", i);
-            free(fileInfo->relocTablesInfo[i].sectionData);
+            FAIRY_DEBUG_PRINTF(fileInfo->context, "Freeing reloc section %zd data\n", i);
+            vc_allocator_free(fileInfo->allocators[FAIRY_MEMORY_RELOCS], fileInfo->relocTablesInfo[i].sectionData);
         }
     }
 
-    vc_vector_release(fileInfo->progBitsSections);
+    vc_vector_deinit(&fileInfo->progBitsSections);
 
-    FAIRY_DEBUG_PRINTF("%s", "Freeing symtab data\n");
-    free(fileInfo->symtabInfo.sectionData);
+    FAIRY_DEBUG_PRINTF(fileInfo->context, "%s", "Freeing symtab data\n");
+    vc_allocator_free(fileInfo->allocators[FAIRY_MEMORY_SYMTAB], fileInfo->symtabInfo.sectionData);
 
-    FAIRY_DEBUG_PRINTF("%s", "Freeing strtab data\n");
-    free(fileInfo->strtab);
+    FAIRY_DEBUG_PRINTF(fileInfo->context, "%s", "Freeing strtab data\n");
+    vc_allocator_free(fileInfo->allocators[FAIRY_MEMORY_STRTAB], fileInfo->strtab);
 }
@@ -17,8 +17,27 @@ typedef enum {
     VERBOSITY_DEBUG //,
 } VerbosityLevel;
 
-extern VerbosityLevel gVerbosity;
-extern bool gUseElfAlignment;
+/* The highest verbosity that is compiled in at all; logging above it costs nothing, not even a check of the context */
+#ifndef FAIRY_COMPILED_VERBOSITY
+#ifdef DEBUG_ON
+#define FAIRY_COMPILED_VERBOSITY VERBOSITY_DEBUG
+#else
+#define FAIRY_COMPILED_VERBOSITY VERBOSITY_INFO
+#endif
+#endif
+
+struct FadoStats;
+
+/**
+ * Options for reading files and logging, passed to everything that needs them rather than kept in globals, so that
+ * several can be in use at once in the same process. A NULL context means the defaults of Fairy_InitContext.
+ */
+typedef struct {
+    VerbosityLevel verbosity;
+    bool logStructured;      /* Log as lines of key=value pairs */
+    bool useElfAlignment;    /* Align sections to their sh_addralign rather than 0x10 */
+    struct FadoStats* stats; /* Where fado records how long each phase takes (see fado_stats.h), NULL for nowhere */
+} FairyContext;
 
 typedef Elf32_Ehdr FairyFileHeader;
 typedef Elf32_Shdr FairySecHeader;
@@ -38,12 +57,25 @@ typedef struct {
     size_t sectionEntrySize;
 } FairySectionInfo;
 
+/* What Fairy allocates memory for, so that it can be accounted for separately */
+typedef enum {
+    FAIRY_MEMORY_SECTION_TABLE, /* Section headers and the list of PROGBITS sections */
+    FAIRY_MEMORY_SYMTAB,
+    FAIRY_MEMORY_STRTAB, /* .strtab and .shstrtab */
+    FAIRY_MEMORY_RELOCS,
+    FAIRY_MEMORY_MAX
+} FairyMemoryCategory;
+
 typedef struct {
     FairySectionInfo symtabInfo;
     char* strtab;
     Elf32_Word progBitsSizes[3];
-    vc_vector* progBitsSections;
+    Elf32_Word bssSize;
+    vc_vector progBitsSections;
     FairySectionInfo relocTablesInfo[3];
+    const vc_allocator* allocators[FAIRY_MEMORY_MAX]; /* Owners of all the above memory, by category */
+    const FairyContext* context;
+    size_t bytesRead; /* From the file while reading the above */
 } FairyFileInfo;
 
 typedef enum {
@@ -53,22 +85,54 @@ typedef enum {
     FAIRY_SECTION_OTHER //,
 } FairySection;
 
+#ifdef __GNUC__
+#define FAIRY_PRINTF_LIKE(fmtIndex) __attribute__((format(printf, fmtIndex, fmtIndex + 1), cold))
+#else
+#define FAIRY_PRINTF_LIKE(fmtIndex)
+#endif
+
 /* Prints debugging information to stderr. To be used via the macros. */
-int Fairy_DebugPrintf(const char* file, int line, const char* func, VerbosityLevel level, const char* fmt, ...);
-#define FAIRY_INFO_PRINTF(fmt, ...) Fairy_DebugPrintf(__FILE__, __LINE__, __func__, VERBOSITY_INFO, fmt, __VA_ARGS__)
-#define FAIRY_DEBUG_PRINTF(fmt, ...) Fairy_DebugPrintf(__FILE__, __LINE__, __func__, VERBOSITY_DEBUG, fmt, __VA_ARGS__)
+int Fairy_DebugPrintf(const FairyContext* context, const char* file, int line, const char* func, VerbosityLevel level,
+                      const char* fmt, ...) FAIRY_PRINTF_LIKE(6);
+
+/* Whether logging at level would print anything. Constant false above FAIRY_COMPILED_VERBOSITY. */
+#define FAIRY_LOG_ENABLED(context, level) \
+    (((level) <= FAIRY_COMPILED_VERBOSITY) && ((context) != NULL) && ((context)->verbosity >= (level)))
+
+/**
+ * Logging macros. The verbosity is checked inline, so the arguments are only evaluated and the call only made if the
+ * message will be printed, and the whole statement is compiled out above FAIRY_COMPILED_VERBOSITY.
+ */
+#define FAIRY_LOG_PRINTF(context, level, fmt, ...)                                              \
+    do {                                                                                        \
+        if (FAIRY_LOG_ENABLED(context, level)) {                                                \
+            Fairy_DebugPrintf(context, __FILE__, __LINE__, __func__, level, fmt, __VA_ARGS__); \
+        }                                                                                       \
+    } while (0)
+#define FAIRY_INFO_PRINTF(context, fmt, ...) FAIRY_LOG_PRINTF(context, VERBOSITY_INFO, fmt, __VA_ARGS__)
+#define FAIRY_DEBUG_PRINTF(context, fmt, ...) FAIRY_LOG_PRINTF(context, VERBOSITY_DEBUG, fmt, __VA_ARGS__)
+
+void Fairy_InitContext(FairyContext* context);
 
 const char* Fairy_StringFromDefine(const FairyDefineString* dict, int define);
 bool Fairy_StartsWith(const char* string, const char* initial);
 
+FairyFileHeader* Fairy_ReadElfHeader(FairyFileHeader* header, FILE* file);
 FairyFileHeader* Fairy_ReadFileHeader(FairyFileHeader* header, FILE* file);
 FairySecHeader* Fairy_ReadSectionTable(FairySecHeader* sectionTable, FILE* file, size_t tableOffset, size_t number);
 char* Fairy_ReadStringTable(char* stringTable, FILE* file, size_t tableOffset, size_t tableSize);
 size_t Fairy_ReadSymbolTable(FairySym** symbolTableOut, FILE* file, size_t tableOffset, size_t tableSize);
+size_t Fairy_ReadSymbolTableWithAllocator(FairySym** symbolTableOut, FILE* file, size_t tableOffset, size_t tableSize,
+                                          const vc_allocator* allocator);
 size_t Fairy_ReadRelocs(FairyRela** relocsOut, FILE* file, int type, size_t offset, size_t size);
+size_t Fairy_ReadRelocsWithAllocator(FairyRela** relocsOut, FILE* file, int type, size_t offset, size_t size,
+                                     const vc_allocator* allocator);
 
 char* Fairy_GetSectionName(FairySecHeader* sectionTable, char* shstrtab, size_t index);
 char* Fairy_GetSymbolName(FairySym* symtab, char* strtab, size_t index);
 
 void Fairy_InitFile(FairyFileInfo* fileInfo, FILE* file);
+void Fairy_InitFileWithAllocator(FairyFileInfo* fileInfo, FILE* file, const vc_allocator* allocator);
+void Fairy_InitFileWithAllocators(FairyFileInfo* fileInfo, FILE* file, const FairyContext* context,
+                                  const vc_allocator* const allocators[FAIRY_MEMORY_MAX]);
 void Fairy_DestroyFile(FairyFileInfo* fileInfo);
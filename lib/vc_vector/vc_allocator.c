@@ -0,0 +1,273 @@
+#include "vc_allocator.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+
+// Auxiliary methods
+
+// Prefixed to blocks whose size has to be known later; the union keeps the
+// block after it suitably aligned for any type.
+typedef union {
+  size_t size;
+  long double align_long_double;
+  long long align_long_long;
+  void* align_pointer;
+} vc_block_header;
+
+#define VC_ALIGNMENT sizeof(vc_block_header)
+#define VC_ALIGN_UP(size) (((size) + VC_ALIGNMENT - 1) & ~(VC_ALIGNMENT - 1))
+
+// ----------------------------------------------------------------------------
+
+// Libc
+
+void* vc_allocator_libc_alloc(void* context, size_t size) {
+  (void)context;
+  return malloc(size);
+}
+
+void* vc_allocator_libc_realloc(void* context, void* ptr, size_t new_size) {
+  (void)context;
+  return realloc(ptr, new_size);
+}
+
+void vc_allocator_libc_free(void* context, void* ptr) {
+  (void)context;
+  free(ptr);
+}
+
+const vc_allocator vc_allocator_libc = {
+  NULL, vc_allocator_libc_alloc, vc_allocator_libc_realloc, vc_allocator_libc_free
+};
+
+void* vc_allocator_alloc(const vc_allocator* allocator, size_t size) {
+  if (allocator == NULL) {
+    return malloc(size);
+  }
+  return allocator->alloc(allocator->context, size);
+}
+
+void* vc_allocator_realloc(const vc_allocator* allocator, void* ptr, size_t new_size) {
+  if (allocator == NULL) {
+    return realloc(ptr, new_size);
+  }
+  return allocator->realloc(allocator->context, ptr, new_size);
+}
+
+void vc_allocator_free(const vc_allocator* allocator, void* ptr) {
+  if (allocator == NULL) {
+    free(ptr);
+    return;
+  }
+  allocator->free(allocator->context, ptr);
+}
+
+// ----------------------------------------------------------------------------
+
+// Bump arena
+
+#define VC_ARENA_NO_LAST ((size_t)-1)
+
+struct vc_arena_chunk {
+  vc_arena_chunk* next;
+  size_t size;
+  size_t used;
+  size_t last; // Offset of the most recent allocation's header, if it can still be changed in place
+};
+
+#define VC_ARENA_CHUNK_HEADER_SIZE VC_ALIGN_UP(sizeof(vc_arena_chunk))
+
+char* vc_arena_chunk_data(vc_arena_chunk* chunk) {
+  return (char*)chunk + VC_ARENA_CHUNK_HEADER_SIZE;
+}
+
+// Returns the header of ptr if it is the most recent allocation in the current chunk, NULL otherwise.
+vc_block_header* vc_arena_last_block(vc_arena* arena, void* ptr) {
+  vc_arena_chunk* chunk = arena->chunks;
+  vc_block_header* header = (vc_block_header*)ptr - 1;
+
+  if (chunk == NULL || chunk->last == VC_ARENA_NO_LAST || (char*)header != vc_arena_chunk_data(chunk) + chunk->last) {
+    return NULL;
+  }
+  return header;
+}
+
+void* vc_arena_alloc(void* context, size_t size) {
+  vc_arena* arena = (vc_arena*)context;
+  vc_arena_chunk* chunk = arena->chunks;
+  const size_t total = sizeof(vc_block_header) + VC_ALIGN_UP(size);
+
+  if (chunk == NULL || chunk->size - chunk->used < total) {
+    const size_t chunk_size = (total > arena->chunk_size) ? total : arena->chunk_size;
+
+    chunk = (vc_arena_chunk*)vc_allocator_alloc(arena->parent, VC_ARENA_CHUNK_HEADER_SIZE + chunk_size);
+    if (chunk == NULL) {
+      return NULL;
+    }
+    chunk->next = arena->chunks;
+    chunk->size = chunk_size;
+    chunk->used = 0;
+    chunk->last = VC_ARENA_NO_LAST;
+    arena->chunks = chunk;
+  }
+
+  vc_block_header* header = (vc_block_header*)(vc_arena_chunk_data(chunk) + chunk->used);
+  header->size = size;
+  chunk->last = chunk->used;
+  chunk->used += total;
+  return header + 1;
+}
+
+void* vc_arena_realloc(void* context, void* ptr, size_t new_size) {
+  vc_arena* arena = (vc_arena*)context;
+
+  if (ptr == NULL) {
+    return vc_arena_alloc(context, new_size);
+  }
+
+  vc_block_header* header = vc_arena_last_block(arena, ptr);
+  if (header != NULL) {
+    vc_arena_chunk* chunk = arena->chunks;
+    const size_t total = sizeof(vc_block_header) + VC_ALIGN_UP(new_size);
+
+    if (chunk->size - chunk->last >= total) {
+      header->size = new_size;
+      chunk->used = chunk->last + total;
+      return ptr;
+    }
+  }
+
+  header = (vc_block_header*)ptr - 1;
+  void* new_ptr = vc_arena_alloc(context, new_size);
+  if (new_ptr != NULL) {
+    memcpy(new_ptr, ptr, (header->size < new_size) ? header->size : new_size);
+  }
+  return new_ptr;
+}
+
+void vc_arena_free(void* context, void* ptr) {
+  vc_arena* arena = (vc_arena*)context;
+
+  if (ptr != NULL && vc_arena_last_block(arena, ptr) != NULL) {
+    arena->chunks->used = arena->chunks->last;
+    arena->chunks->last = VC_ARENA_NO_LAST;
+  }
+}
+
+void vc_arena_init(vc_arena* arena, size_t chunk_size, const vc_allocator* parent) {
+  arena->chunks = NULL;
+  arena->chunk_size = chunk_size;
+  arena->parent = parent;
+}
+
+void vc_arena_release(vc_arena* arena) {
+  vc_arena_chunk* chunk = arena->chunks;
+
+  while (chunk != NULL) {
+    vc_arena_chunk* next = chunk->next;
+    vc_allocator_free(arena->parent, chunk);
+    chunk = next;
+  }
+  arena->chunks = NULL;
+}
+
+vc_allocator vc_arena_allocator(vc_arena* arena) {
+  vc_allocator allocator = { arena, vc_arena_alloc, vc_arena_realloc, vc_arena_free };
+  return allocator;
+}
+
+// ----------------------------------------------------------------------------
+
+// Counting wrapper
+
+typedef enum { VC_COUNTING_ALLOC, VC_COUNTING_REALLOC, VC_COUNTING_FREE } vc_counting_call;
+
+// Records a call that changed a block from old_size to new_size bytes (0 for no block) in counting and its totals.
+void vc_counting_allocator_record(vc_counting_allocator* counting, vc_counting_call call, size_t old_size,
+                                  size_t new_size) {
+  for (; counting != NULL; counting = counting->total) {
+    switch (call) {
+      case VC_COUNTING_ALLOC:
+        counting->alloc_count++;
+        break;
+      case VC_COUNTING_REALLOC:
+        counting->realloc_count++;
+        break;
+      case VC_COUNTING_FREE:
+        counting->free_count++;
+        break;
+    }
+    counting->current_bytes = counting->current_bytes - old_size + new_size;
+    if (counting->current_bytes > counting->peak_bytes) {
+      counting->peak_bytes = counting->current_bytes;
+    }
+  }
+}
+
+void* vc_counting_allocator_alloc(void* context, size_t size) {
+  vc_counting_allocator* counting = (vc_counting_allocator*)context;
+  vc_block_header* header = (vc_block_header*)vc_allocator_alloc(counting->parent, sizeof(vc_block_header) + size);
+
+  if (header == NULL) {
+    return NULL;
+  }
+
+  header->size = size;
+  vc_counting_allocator_record(counting, VC_COUNTING_ALLOC, 0, size);
+  return header + 1;
+}
+
+void* vc_counting_allocator_realloc(void* context, void* ptr, size_t new_size) {
+  vc_counting_allocator* counting = (vc_counting_allocator*)context;
+
+  if (ptr == NULL) {
+    return vc_counting_allocator_alloc(context, new_size);
+  }
+
+  vc_block_header* header = (vc_block_header*)ptr - 1;
+  const size_t old_size = header->size;
+
+  header = (vc_block_header*)vc_allocator_realloc(counting->parent, header, sizeof(vc_block_header) + new_size);
+  if (header == NULL) {
+    return NULL;
+  }
+
+  header->size = new_size;
+  vc_counting_allocator_record(counting, VC_COUNTING_REALLOC, old_size, new_size);
+  return header + 1;
+}
+
+void vc_counting_allocator_free(void* context, void* ptr) {
+  vc_counting_allocator* counting = (vc_counting_allocator*)context;
+
+  if (ptr == NULL) {
+    return;
+  }
+
+  vc_block_header* header = (vc_block_header*)ptr - 1;
+  vc_counting_allocator_record(counting, VC_COUNTING_FREE, header->size, 0);
+  vc_allocator_free(counting->parent, header);
+}
+
+void vc_counting_allocator_init(vc_counting_allocator* counting, const vc_allocator* parent) {
+  vc_counting_allocator_init_with_total(counting, parent, NULL);
+}
+
+void vc_counting_allocator_init_with_total(vc_counting_allocator* counting, const vc_allocator* parent,
+                                           vc_counting_allocator* total) {
+  counting->parent = parent;
+  counting->total = total;
+  counting->alloc_count = 0;
+  counting->realloc_count = 0;
+  counting->free_count = 0;
+  counting->current_bytes = 0;
+  counting->peak_bytes = 0;
+}
+
+vc_allocator vc_counting_allocator_get(vc_counting_allocator* counting) {
+  vc_allocator allocator = {
+    counting, vc_counting_allocator_alloc, vc_counting_allocator_realloc, vc_counting_allocator_free
+  };
+  return allocator;
+}
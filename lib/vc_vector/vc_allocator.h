@@ -0,0 +1,87 @@
+#ifndef VCALLOCATOR_H
+#define VCALLOCATOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// ----------------------------------------------------------------------------
+// Allocator interface
+// ----------------------------------------------------------------------------
+
+// A set of allocation functions with a context pointer passed to each of them.
+// The functions have the same contract as malloc/realloc/free. Wherever a
+// 'const vc_allocator*' is accepted, NULL means vc_allocator_libc.
+typedef struct vc_allocator {
+  void* context;
+  void* (*alloc)(void* context, size_t size);
+  void* (*realloc)(void* context, void* ptr, size_t new_size);
+  void (*free)(void* context, void* ptr);
+} vc_allocator;
+
+// Allocator using malloc/realloc/free.
+extern const vc_allocator vc_allocator_libc;
+
+// Allocates through the allocator, or libc if it is NULL.
+void* vc_allocator_alloc(const vc_allocator* allocator, size_t size);
+
+// Reallocates through the allocator, or libc if it is NULL.
+void* vc_allocator_realloc(const vc_allocator* allocator, void* ptr, size_t new_size);
+
+// Frees through the allocator, or libc if it is NULL.
+void vc_allocator_free(const vc_allocator* allocator, void* ptr);
+
+// ----------------------------------------------------------------------------
+// Bump arena
+// ----------------------------------------------------------------------------
+
+typedef struct vc_arena_chunk vc_arena_chunk;
+
+// Allocates by bumping a pointer through chunks obtained from a parent
+// allocator. Freeing or reallocating the most recent allocation is done in
+// place; any other free is a no-op, and everything is returned to the parent
+// at once by vc_arena_release.
+typedef struct {
+  vc_arena_chunk* chunks;
+  size_t chunk_size;
+  const vc_allocator* parent;
+} vc_arena;
+
+// Constructs an empty arena taking chunks of at least chunk_size bytes from parent.
+void vc_arena_init(vc_arena* arena, size_t chunk_size, const vc_allocator* parent);
+
+// Frees every allocation made from the arena.
+void vc_arena_release(vc_arena* arena);
+
+// Returns an allocator allocating from the arena.
+vc_allocator vc_arena_allocator(vc_arena* arena);
+
+// ----------------------------------------------------------------------------
+// Counting wrapper
+// ----------------------------------------------------------------------------
+
+// Forwards to a parent allocator, keeping count of the calls and of the bytes
+// currently and at most allocated through it. Several wrappers can share a
+// 'total' which is counted into as well, e.g. to account for memory by
+// category and still know the overall peak.
+typedef struct vc_counting_allocator {
+  const vc_allocator* parent;
+  struct vc_counting_allocator* total;
+  size_t alloc_count;
+  size_t realloc_count;
+  size_t free_count;
+  size_t current_bytes;
+  size_t peak_bytes;
+} vc_counting_allocator;
+
+// Constructs a counting wrapper around parent with all counts zero.
+void vc_counting_allocator_init(vc_counting_allocator* counting, const vc_allocator* parent);
+
+// Constructs a counting wrapper around parent with all counts zero, which
+// also counts into 'total' (itself possibly counting into another total).
+void vc_counting_allocator_init_with_total(vc_counting_allocator* counting, const vc_allocator* parent,
+                                           vc_counting_allocator* total);
+
+// Returns an allocator counting into 'counting'.
+vc_allocator vc_counting_allocator_get(vc_counting_allocator* counting);
+
+#endif // VCALLOCATOR_H
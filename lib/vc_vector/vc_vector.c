@@ -8,25 +8,32 @@
 
 // ----------------------------------------------------------------------------
 
-// vc_vector structure
-
-struct vc_vector {
-  size_t count;
-  size_t element_size;
-  size_t reserved_size;
-  char* data;
-  vc_vector_deleter* deleter;
-};
-
-// ----------------------------------------------------------------------------
-
 // Auxiliary methods
 
 bool vc_vector_realloc(vc_vector* vector, size_t new_count) {
   const size_t new_size = new_count * vector->element_size;
-  char* new_data = (char*)realloc(vector->data, new_size);
-  if (!new_data) {
-    return false;
+  char* new_data;
+
+  if (vector->data == NULL || vc_vector_is_small(vector)) {
+    if (new_size <= VC_VECTOR_SMALL_BUFFER_SIZE) {
+      vector->reserved_size = new_size;
+      vector->data = vector->small_buffer.bytes;
+      return true;
+    }
+
+    // Spill from the small buffer to the heap
+    new_data = (char*)vc_allocator_alloc(vector->allocator, new_size);
+    if (!new_data) {
+      return false;
+    }
+    if (vector->data != NULL) {
+      memcpy(new_data, vector->data, vector->count * vector->element_size);
+    }
+  } else {
+    new_data = (char*)vc_allocator_realloc(vector->allocator, vector->data, new_size);
+    if (!new_data) {
+      return false;
+    }
   }
 
   vector->reserved_size = new_size;
@@ -49,21 +56,32 @@ void vc_vector_call_deleter_all(vc_vector* vector) {
 
 // Control
 
-vc_vector* vc_vector_create(size_t count_elements, size_t size_of_element, vc_vector_deleter* deleter) {
-  vc_vector* v = (vc_vector*)malloc(sizeof(vc_vector));
-  if (v != NULL) {
-    v->data = NULL;
-    v->count = 0;
-    v->element_size = size_of_element;
-    v->deleter = deleter;
+bool vc_vector_init_with_allocator(vc_vector* vector, size_t count_elements, size_t size_of_element,
+                                   vc_vector_deleter* deleter, const vc_allocator* allocator) {
+  vector->data = NULL;
+  vector->count = 0;
+  vector->element_size = size_of_element;
+  vector->reserved_size = 0;
+  vector->deleter = deleter;
+  vector->allocator = allocator;
 
-    if (count_elements < MINIMUM_COUNT_OF_ELEMENTS) {
-      count_elements = DEFAULT_COUNT_OF_ELEMENTS;
-    }
+  if (count_elements < MINIMUM_COUNT_OF_ELEMENTS) {
+    count_elements = DEFAULT_COUNT_OF_ELEMENTS;
+  }
+
+  return size_of_element >= 1 && vc_vector_realloc(vector, count_elements);
+}
+
+bool vc_vector_init(vc_vector* vector, size_t count_elements, size_t size_of_element, vc_vector_deleter* deleter) {
+  return vc_vector_init_with_allocator(vector, count_elements, size_of_element, deleter, NULL);
+}
 
-    if (size_of_element < 1 ||
-                 !vc_vector_realloc(v, count_elements)) {
-      free(v);
+vc_vector* vc_vector_create_with_allocator(size_t count_elements, size_t size_of_element, vc_vector_deleter* deleter,
+                                           const vc_allocator* allocator) {
+  vc_vector* v = (vc_vector*)vc_allocator_alloc(allocator, sizeof(vc_vector));
+  if (v != NULL) {
+    if (!vc_vector_init_with_allocator(v, count_elements, size_of_element, deleter, allocator)) {
+      vc_allocator_free(allocator, v);
       v = NULL;
     }
   }
@@ -71,10 +89,15 @@ vc_vector* vc_vector_create(size_t count_elements, size_t size_of_element, vc_ve
   return v;
 }
 
+vc_vector* vc_vector_create(size_t count_elements, size_t size_of_element, vc_vector_deleter* deleter) {
+  return vc_vector_create_with_allocator(count_elements, size_of_element, deleter, NULL);
+}
+
 vc_vector* vc_vector_create_copy(const vc_vector* vector) {
-  vc_vector* new_vector = vc_vector_create(vector->reserved_size / vector->count,
-                                           vector->element_size,
-                                           vector->deleter);
+  vc_vector* new_vector = vc_vector_create_with_allocator(vector->reserved_size / vector->count,
+                                                          vector->element_size,
+                                                          vector->deleter,
+                                                          vector->allocator);
   if (!new_vector) {
     return new_vector;
   }
@@ -91,16 +114,25 @@ vc_vector* vc_vector_create_copy(const vc_vector* vector) {
   return new_vector;
 }
 
-void vc_vector_release(vc_vector* vector) {
+void vc_vector_deinit(vc_vector* vector) {
   if (vector->deleter != NULL) {
     vc_vector_call_deleter_all(vector);
   }
 
-  if (vector->reserved_size != 0) {
-    free(vector->data);
+  if (!vc_vector_is_small(vector)) {
+    vc_allocator_free(vector->allocator, vector->data);
   }
 
-  free(vector);
+  vector->data = NULL;
+  vector->count = 0;
+  vector->reserved_size = 0;
+}
+
+void vc_vector_release(vc_vector* vector) {
+  const vc_allocator* allocator = vector->allocator;
+
+  vc_vector_deinit(vector);
+  vc_allocator_free(allocator, vector);
 }
 
 bool vc_vector_is_equals(vc_vector* vector1, vc_vector* vector2) {
@@ -124,6 +156,10 @@ size_t vc_vector_struct_size(void) {
   return sizeof(vc_vector);
 }
 
+bool vc_vector_is_small(const vc_vector* vector) {
+  return vector->data == vector->small_buffer.bytes;
+}
+
 // ----------------------------------------------------------------------------
 
 // Element access
@@ -3,10 +3,35 @@
 
 #include <stdbool.h>
 #include <stdio.h>
+#include "vc_allocator.h"
 
 typedef struct vc_vector vc_vector;
 typedef void (vc_vector_deleter)(void *);
 
+// Size in bytes of the storage inside the vector itself. Vectors whose reserved
+// size fits use it instead of allocating, and only spill to the heap when it is
+// exceeded.
+#define VC_VECTOR_SMALL_BUFFER_SIZE 64
+
+// The structure is public so that vectors can be placed on the stack or inside
+// other structures with vc_vector_init. Its fields should not be used directly,
+// and an initialized vector must not be copied by value, since it may point
+// into its own small buffer.
+struct vc_vector {
+  size_t count;
+  size_t element_size;
+  size_t reserved_size;
+  char* data;
+  vc_vector_deleter* deleter;
+  const vc_allocator* allocator;
+  union {
+    char bytes[VC_VECTOR_SMALL_BUFFER_SIZE];
+    long double align_long_double;
+    long long align_long_long;
+    void* align_pointer;
+  } small_buffer;
+};
+
 // ----------------------------------------------------------------------------
 // Control
 // ----------------------------------------------------------------------------
@@ -14,6 +39,20 @@ typedef void (vc_vector_deleter)(void *);
 // Constructs an empty vector with an reserver size for count_elements.
 vc_vector* vc_vector_create(size_t count_elements, size_t size_of_element, vc_vector_deleter* deleter);
 
+// Constructs an empty vector like vc_vector_create, taking its memory from 'allocator' (NULL for libc).
+vc_vector* vc_vector_create_with_allocator(size_t count_elements, size_t size_of_element, vc_vector_deleter* deleter,
+                                           const vc_allocator* allocator);
+
+// Constructs an empty vector in caller-provided storage, with an reserved size for count_elements.
+bool vc_vector_init(vc_vector* vector, size_t count_elements, size_t size_of_element, vc_vector_deleter* deleter);
+
+// Constructs an empty vector like vc_vector_init, taking its memory from 'allocator' (NULL for libc).
+bool vc_vector_init_with_allocator(vc_vector* vector, size_t count_elements, size_t size_of_element,
+                                   vc_vector_deleter* deleter, const vc_allocator* allocator);
+
+// Releases the contents of a vector constructed with vc_vector_init, but not the storage itself.
+void vc_vector_deinit(vc_vector* vector);
+
 // Constructs a copy of an existing vector.
 vc_vector* vc_vector_create_copy(const vc_vector* vector);
 
@@ -32,6 +71,9 @@ size_t vc_vector_get_default_count_of_elements(void);
 // Returns constant value of the vector struct size.
 size_t vc_vector_struct_size(void);
 
+// Returns true if the elements are stored in the vector's small buffer rather than on the heap.
+bool vc_vector_is_small(const vc_vector* vector);
+
 // ----------------------------------------------------------------------------
 // Element access
 // ----------------------------------------------------------------------------
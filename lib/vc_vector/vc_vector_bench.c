@@ -0,0 +1,394 @@
+#define _DEFAULT_SOURCE
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "vc_allocator.h"
+#include "vc_vector.h"
+#include "vc_vector_typed.h"
+
+// Each benchmark runs in a forked child, so that the peak RSS reported by wait4
+// belongs to that benchmark alone. Operations are repeated until at least
+// BENCH_MIN_OPS have been timed (BENCH_MIN_QUADRATIC_OPS for the quadratic
+// insert and erase_range in the middle), so that small counts are not dominated
+// by noise. The quadratic operations stop at BENCH_MAX_QUADRATIC_COUNT elements.
+
+#define BENCH_MIN_OPS 2000000
+#define BENCH_MIN_QUADRATIC_OPS 100000
+#define BENCH_DEFAULT_MAX_COUNT 10000000
+#define BENCH_MAX_QUADRATIC_COUNT 10000
+#define BENCH_APPEND_BLOCK 64
+#define BENCH_ERASE_RANGE 16
+#define BENCH_MAX_ELEMENT_SIZE 64
+
+// Same expansion as fado's VC_FOREACH
+#define BENCH_FOREACH(i, v) for (i = vc_vector_begin(v); i != vc_vector_end(v); i = vc_vector_next(v, i))
+
+typedef struct {
+  uint64_t ops;
+  uint64_t elapsed_ns;
+  size_t reallocs;
+} bench_result;
+
+typedef void (bench_func)(size_t element_size, size_t count, bench_result* result);
+
+typedef struct {
+  const char* name;
+  bench_func* func;
+  bool quadratic;
+} bench_case;
+
+// Sink for results so that the loops cannot be optimized away.
+volatile uint64_t bench_sink;
+
+uint64_t bench_now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+size_t bench_rounds_for(size_t count, size_t min_ops) {
+  return (count >= min_ops) ? 1 : (min_ops + count - 1) / count;
+}
+
+size_t bench_rounds(size_t count) {
+  return bench_rounds_for(count, BENCH_MIN_OPS);
+}
+
+void bench_make_element(char* element, size_t element_size, size_t i) {
+  memset(element, 0, element_size);
+  memcpy(element, &i, (element_size < sizeof(i)) ? element_size : sizeof(i));
+}
+
+// Allocations and reallocations of the data, not counting the structure itself
+size_t bench_data_reallocs(const vc_counting_allocator* counting) {
+  return counting->alloc_count - 1 + counting->realloc_count;
+}
+
+vc_vector* bench_create_filled(size_t element_size, size_t count) {
+  char element[BENCH_MAX_ELEMENT_SIZE];
+  vc_vector* vector = vc_vector_create(count, element_size, NULL);
+
+  for (size_t i = 0; i < count; ++i) {
+    bench_make_element(element, element_size, i);
+    vc_vector_push_back(vector, element);
+  }
+  return vector;
+}
+
+// ----------------------------------------------------------------------------
+
+// Untyped vector
+
+void bench_push_back(size_t element_size, size_t count, bench_result* result) {
+  const size_t rounds = bench_rounds(count);
+  char element[BENCH_MAX_ELEMENT_SIZE];
+
+  for (size_t round = 0; round < rounds; ++round) {
+    vc_counting_allocator counting;
+    vc_counting_allocator_init(&counting, NULL);
+    vc_allocator allocator = vc_counting_allocator_get(&counting);
+    vc_vector* vector = vc_vector_create_with_allocator(0, element_size, NULL, &allocator);
+
+    const uint64_t start = bench_now();
+    for (size_t i = 0; i < count; ++i) {
+      bench_make_element(element, element_size, i);
+      vc_vector_push_back(vector, element);
+    }
+    result->elapsed_ns += bench_now() - start;
+    result->reallocs = bench_data_reallocs(&counting);
+
+    bench_sink += vc_vector_count(vector);
+    vc_vector_release(vector);
+  }
+  result->ops = (uint64_t)rounds * count;
+}
+
+void bench_append(size_t element_size, size_t count, bench_result* result) {
+  const size_t rounds = bench_rounds(count);
+  char* block = malloc(BENCH_APPEND_BLOCK * element_size);
+
+  for (size_t i = 0; i < BENCH_APPEND_BLOCK; ++i) {
+    bench_make_element(block + i * element_size, element_size, i);
+  }
+
+  for (size_t round = 0; round < rounds; ++round) {
+    vc_counting_allocator counting;
+    vc_counting_allocator_init(&counting, NULL);
+    vc_allocator allocator = vc_counting_allocator_get(&counting);
+    vc_vector* vector = vc_vector_create_with_allocator(0, element_size, NULL, &allocator);
+
+    const uint64_t start = bench_now();
+    for (size_t i = 0; i < count; i += BENCH_APPEND_BLOCK) {
+      vc_vector_append(vector, block, (count - i < BENCH_APPEND_BLOCK) ? count - i : BENCH_APPEND_BLOCK);
+    }
+    result->elapsed_ns += bench_now() - start;
+    result->reallocs = bench_data_reallocs(&counting);
+
+    bench_sink += vc_vector_count(vector);
+    vc_vector_release(vector);
+  }
+  result->ops = (uint64_t)rounds * count;
+  free(block);
+}
+
+void bench_insert(size_t element_size, size_t count, bench_result* result) {
+  const size_t rounds = bench_rounds_for(count, BENCH_MIN_QUADRATIC_OPS);
+  char element[BENCH_MAX_ELEMENT_SIZE];
+
+  for (size_t round = 0; round < rounds; ++round) {
+    vc_counting_allocator counting;
+    vc_counting_allocator_init(&counting, NULL);
+    vc_allocator allocator = vc_counting_allocator_get(&counting);
+    vc_vector* vector = vc_vector_create_with_allocator(0, element_size, NULL, &allocator);
+
+    const uint64_t start = bench_now();
+    for (size_t i = 0; i < count; ++i) {
+      bench_make_element(element, element_size, i);
+      vc_vector_insert(vector, i / 2, element);
+    }
+    result->elapsed_ns += bench_now() - start;
+    result->reallocs = bench_data_reallocs(&counting);
+
+    bench_sink += vc_vector_count(vector);
+    vc_vector_release(vector);
+  }
+  result->ops = (uint64_t)rounds * count;
+}
+
+void bench_erase_range(size_t element_size, size_t count, bench_result* result) {
+  const size_t rounds = bench_rounds_for(count, BENCH_MIN_QUADRATIC_OPS);
+  uint64_t ops = 0;
+
+  for (size_t round = 0; round < rounds; ++round) {
+    vc_vector* vector = bench_create_filled(element_size, count);
+
+    const uint64_t start = bench_now();
+    while (vc_vector_count(vector) >= BENCH_ERASE_RANGE) {
+      const size_t first = (vc_vector_count(vector) - BENCH_ERASE_RANGE) / 2;
+      vc_vector_erase_range(vector, first, first + BENCH_ERASE_RANGE);
+      ++ops;
+    }
+    result->elapsed_ns += bench_now() - start;
+
+    bench_sink += vc_vector_count(vector);
+    vc_vector_release(vector);
+  }
+  result->ops = ops;
+}
+
+void bench_iterate(size_t element_size, size_t count, bench_result* result) {
+  const size_t rounds = bench_rounds(count);
+  vc_vector* vector = bench_create_filled(element_size, count);
+  uint64_t sum = 0;
+
+  const uint64_t start = bench_now();
+  for (size_t round = 0; round < rounds; ++round) {
+    void* i;
+    BENCH_FOREACH(i, vector) {
+      sum += *(unsigned char*)i;
+    }
+  }
+  result->elapsed_ns = bench_now() - start;
+  result->ops = (uint64_t)rounds * count;
+
+  bench_sink += sum;
+  vc_vector_release(vector);
+}
+
+// ----------------------------------------------------------------------------
+
+// Typed vector, for comparison
+
+#define BENCH_DECLARE_TYPED(size)                                                                   \
+  typedef struct {                                                                                  \
+    unsigned char bytes[size];                                                                      \
+  } bench_item##size;                                                                               \
+                                                                                                    \
+  VC_VECTOR_DECLARE(bench_item##size);                                                              \
+                                                                                                    \
+  void bench_typed_push_back##size(size_t count, bench_result* result) {                            \
+    const size_t rounds = bench_rounds(count);                                                      \
+    bench_item##size item;                                                                          \
+                                                                                                    \
+    for (size_t round = 0; round < rounds; ++round) {                                               \
+      vc_counting_allocator counting;                                                               \
+      vc_counting_allocator_init(&counting, NULL);                                                  \
+      vc_allocator allocator = vc_counting_allocator_get(&counting);                                \
+      vc_vector_bench_item##size vector;                                                            \
+      vc_vector_bench_item##size##_init_with_allocator(&vector, 0, &allocator);                     \
+                                                                                                    \
+      const uint64_t start = bench_now();                                                           \
+      for (size_t i = 0; i < count; ++i) {                                                          \
+        bench_make_element((char*)item.bytes, size, i);                                             \
+        vc_vector_bench_item##size##_push_back(&vector, item);                                      \
+      }                                                                                             \
+      result->elapsed_ns += bench_now() - start;                                                    \
+      result->reallocs = counting.alloc_count + counting.realloc_count;                             \
+                                                                                                    \
+      bench_sink += vc_vector_bench_item##size##_count(&vector);                                    \
+      vc_vector_bench_item##size##_release(&vector);                                                \
+    }                                                                                               \
+    result->ops = (uint64_t)rounds * count;                                                         \
+  }                                                                                                 \
+                                                                                                    \
+  void bench_typed_iterate##size(size_t count, bench_result* result) {                              \
+    const size_t rounds = bench_rounds(count);                                                      \
+    bench_item##size item;                                                                          \
+    vc_vector_bench_item##size vector;                                                              \
+    uint64_t sum = 0;                                                                               \
+                                                                                                    \
+    vc_vector_bench_item##size##_init(&vector, count);                                              \
+    for (size_t i = 0; i < count; ++i) {                                                            \
+      bench_make_element((char*)item.bytes, size, i);                                               \
+      vc_vector_bench_item##size##_push_back(&vector, item);                                        \
+    }                                                                                               \
+                                                                                                    \
+    const uint64_t start = bench_now();                                                             \
+    for (size_t round = 0; round < rounds; ++round) {                                               \
+      bench_item##size* i;                                                                          \
+      VC_VECTOR_TYPED_FOREACH(i, &vector) {                                                         \
+        sum += i->bytes[0];                                                                         \
+      }                                                                                             \
+    }                                                                                               \
+    result->elapsed_ns = bench_now() - start;                                                       \
+    result->ops = (uint64_t)rounds * count;                                                         \
+                                                                                                    \
+    bench_sink += sum;                                                                              \
+    vc_vector_bench_item##size##_release(&vector);                                                  \
+  }
+
+BENCH_DECLARE_TYPED(4)
+BENCH_DECLARE_TYPED(16)
+BENCH_DECLARE_TYPED(64)
+
+void bench_typed_push_back(size_t element_size, size_t count, bench_result* result) {
+  switch (element_size) {
+    case 4:
+      bench_typed_push_back4(count, result);
+      break;
+    case 16:
+      bench_typed_push_back16(count, result);
+      break;
+    default:
+      bench_typed_push_back64(count, result);
+      break;
+  }
+}
+
+void bench_typed_iterate(size_t element_size, size_t count, bench_result* result) {
+  switch (element_size) {
+    case 4:
+      bench_typed_iterate4(count, result);
+      break;
+    case 16:
+      bench_typed_iterate16(count, result);
+      break;
+    default:
+      bench_typed_iterate64(count, result);
+      break;
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+// Driver
+
+const bench_case bench_cases[] = {
+  { "push_back", bench_push_back, false },
+  { "append", bench_append, false },
+  { "insert", bench_insert, true },
+  { "erase_range", bench_erase_range, true },
+  { "iterate", bench_iterate, false },
+  { "typed_push_back", bench_typed_push_back, false },
+  { "typed_iterate", bench_typed_iterate, false },
+};
+
+const size_t bench_element_sizes[] = { 4, 16, 64 };
+
+bool bench_run(const bench_case* bench, size_t element_size, size_t count, bool json, bool first) {
+  bench_result result = { 0, 0, 0 };
+  struct rusage usage;
+  int status;
+  int fds[2];
+
+  fflush(stdout);
+  if (pipe(fds) != 0) {
+    return false;
+  }
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    return false;
+  }
+  if (pid == 0) {
+    close(fds[0]);
+    bench->func(element_size, count, &result);
+    _exit(write(fds[1], &result, sizeof(result)) == sizeof(result) ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+
+  close(fds[1]);
+  const bool received = read(fds[0], &result, sizeof(result)) == sizeof(result);
+  close(fds[0]);
+  if (wait4(pid, &status, 0, &usage) != pid || !received || !WIFEXITED(status) ||
+      WEXITSTATUS(status) != EXIT_SUCCESS || result.ops == 0) {
+    return false;
+  }
+
+  const double ns_per_op = (double)result.elapsed_ns / result.ops;
+  if (json) {
+    printf("%s\n  {\"benchmark\": \"%s\", \"element_size\": %zu, \"count\": %zu, \"ops\": %" PRIu64
+           ", \"ns_per_op\": %.3f, \"reallocs\": %zu, \"peak_rss_kib\": %ld}",
+           first ? "" : ",", bench->name, element_size, count, result.ops, ns_per_op, result.reallocs,
+           usage.ru_maxrss);
+  } else {
+    printf("%s,%zu,%zu,%" PRIu64 ",%.3f,%zu,%ld\n", bench->name, element_size, count, result.ops, ns_per_op,
+           result.reallocs, usage.ru_maxrss);
+  }
+  return true;
+}
+
+void bench_usage(const char* program) {
+  fprintf(stderr, "usage: %s [--json] [max_count]\n", program);
+}
+
+int main(int argc, char** argv) {
+  size_t max_count = BENCH_DEFAULT_MAX_COUNT;
+  bool json = false;
+  bool first = true;
+
+  for (int arg = 1; arg < argc; ++arg) {
+    if (strcmp(argv[arg], "--json") == 0) {
+      json = true;
+    } else if (sscanf(argv[arg], "%zu", &max_count) != 1 || max_count == 0) {
+      bench_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  printf(json ? "[" : "benchmark,element_size,count,ops,ns_per_op,reallocs,peak_rss_kib\n");
+  for (size_t c = 0; c < sizeof(bench_cases) / sizeof(bench_cases[0]); ++c) {
+    for (size_t s = 0; s < sizeof(bench_element_sizes) / sizeof(bench_element_sizes[0]); ++s) {
+      for (size_t count = 1000; count <= max_count; count *= 10) {
+        if (bench_cases[c].quadratic && count > BENCH_MAX_QUADRATIC_COUNT) {
+          break;
+        }
+        if (!bench_run(&bench_cases[c], bench_element_sizes[s], count, json, first)) {
+          fprintf(stderr, "%s failed for element size %zu, count %zu\n", bench_cases[c].name,
+                  bench_element_sizes[s], count);
+          return EXIT_FAILURE;
+        }
+        first = false;
+      }
+    }
+  }
+  printf(json ? "\n]\n" : "");
+  return EXIT_SUCCESS;
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
+#include <stdint.h>
 #include "vc_vector.h"
 
 #define ASSERT_EQ(expected, actual)                                          \
@@ -337,6 +338,167 @@ void test_vc_vector_with_strfreefunc() {
   printf("%s passed.\n", __func__);
 }
 
+void test_vc_vector_small_buffer() {
+  const size_t small_count = VC_VECTOR_SMALL_BUFFER_SIZE / sizeof(int);
+
+  // Vector in caller storage, fitting in the small buffer
+  vc_vector vector;
+  ASSERT_TRUE(vc_vector_init(&vector, small_count, sizeof(int), NULL));
+  ASSERT_TRUE(vc_vector_is_small(&vector));
+  ASSERT_EQ(small_count, vc_vector_max_count(&vector));
+
+  for (int i = 0; (size_t)i < small_count; ++i) {
+    ASSERT_TRUE(vc_vector_push_back(&vector, &i));
+  }
+  ASSERT_TRUE(vc_vector_is_small(&vector));
+
+  // Exceeding it spills to the heap, keeping the contents
+  const int spilled = (int)small_count;
+  ASSERT_TRUE(vc_vector_push_back(&vector, &spilled));
+  ASSERT_FALSE(vc_vector_is_small(&vector));
+  ASSERT_EQ(small_count + 1, vc_vector_count(&vector));
+  for (int i = 0; (size_t)i <= small_count; ++i) {
+    ASSERT_EQ(i, *(int*)vc_vector_at(&vector, i));
+  }
+
+  vc_vector_deinit(&vector);
+  ASSERT_EQ(0, vc_vector_count(&vector));
+
+  // Insertion at the front while in the small buffer
+  ASSERT_TRUE(vc_vector_init(&vector, 2, sizeof(int), NULL));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(vc_vector_insert(&vector, 0, &i));
+  }
+  ASSERT_TRUE(vc_vector_is_small(&vector));
+  ASSERT_EQ(2, *(int*)vc_vector_front(&vector));
+  ASSERT_EQ(0, *(int*)vc_vector_back(&vector));
+  vc_vector_deinit(&vector);
+
+  // Heap-allocated vectors use it too, and a large reservation goes straight to the heap
+  vc_vector* heap_vector = vc_vector_create(0, sizeof(int), NULL);
+  ASSERT_NE(NULL, heap_vector);
+  ASSERT_TRUE(vc_vector_is_small(heap_vector));
+  ASSERT_TRUE(vc_vector_reserve_count(heap_vector, small_count * 4));
+  ASSERT_FALSE(vc_vector_is_small(heap_vector));
+  vc_vector_release(heap_vector);
+
+  printf("%s passed.\n", __func__);
+}
+
+void test_vc_vector_with_allocator() {
+  vc_counting_allocator counting;
+  vc_counting_allocator_init(&counting, NULL);
+  vc_allocator allocator = vc_counting_allocator_get(&counting);
+
+  // The structure and the spilled data both come from the allocator
+  vc_vector* vector = vc_vector_create_with_allocator(0, sizeof(int), NULL, &allocator);
+  ASSERT_NE(NULL, vector);
+  ASSERT_EQ(1, counting.alloc_count);
+
+  const int count = 100;
+  for (int i = 0; i < count; ++i) {
+    ASSERT_TRUE(vc_vector_push_back(vector, &i));
+  }
+  for (int i = 0; i < count; ++i) {
+    ASSERT_EQ(i, *(int*)vc_vector_at(vector, i));
+  }
+  ASSERT_EQ(2, counting.alloc_count);
+  ASSERT_NE(0, counting.realloc_count);
+  ASSERT_TRUE(counting.peak_bytes >= sizeof(vc_vector) + count * sizeof(int));
+
+  vc_vector_release(vector);
+  ASSERT_EQ(2, counting.free_count);
+  ASSERT_EQ(0, counting.current_bytes);
+
+  printf("%s passed.\n", __func__);
+}
+
+void test_vc_arena() {
+  vc_counting_allocator counting;
+  vc_counting_allocator_init(&counting, NULL);
+  vc_allocator parent = vc_counting_allocator_get(&counting);
+
+  vc_arena arena;
+  vc_arena_init(&arena, 256, &parent);
+  vc_allocator allocator = vc_arena_allocator(&arena);
+
+  // Small allocations share one chunk, and are suitably aligned
+  char* first = vc_allocator_alloc(&allocator, 3);
+  long double* second = vc_allocator_alloc(&allocator, sizeof(long double));
+  ASSERT_NE(NULL, first);
+  ASSERT_NE(NULL, second);
+  ASSERT_EQ(0, (uintptr_t)second % sizeof(long double));
+  ASSERT_EQ(1, counting.alloc_count);
+
+  // The most recent allocation grows in place, others are copied
+  long double* grown = vc_allocator_realloc(&allocator, second, 4 * sizeof(long double));
+  ASSERT_EQ((uintptr_t)second, (uintptr_t)grown);
+  memcpy(first, "ab", 3);
+  char* moved = vc_allocator_realloc(&allocator, first, 8);
+  ASSERT_NE((uintptr_t)first, (uintptr_t)moved);
+  ASSERT_EQ(0, strcmp("ab", moved));
+
+  // A vector spilling past the chunk size takes a new chunk
+  vc_vector* vector = vc_vector_create_with_allocator(0, sizeof(int), NULL, &allocator);
+  ASSERT_NE(NULL, vector);
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_TRUE(vc_vector_push_back(vector, &i));
+  }
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_EQ(i, *(int*)vc_vector_at(vector, i));
+  }
+  vc_vector_release(vector);
+  ASSERT_TRUE(counting.alloc_count > 1);
+
+  // Everything goes back to the parent at once
+  vc_arena_release(&arena);
+  ASSERT_EQ(counting.alloc_count, counting.free_count);
+  ASSERT_EQ(0, counting.current_bytes);
+
+  printf("%s passed.\n", __func__);
+}
+
+void test_vc_counting_allocator_total() {
+  vc_counting_allocator total;
+  vc_counting_allocator first;
+  vc_counting_allocator second;
+  vc_counting_allocator_init(&total, NULL);
+  vc_counting_allocator_init_with_total(&first, NULL, &total);
+  vc_counting_allocator_init_with_total(&second, NULL, &total);
+  vc_allocator first_allocator = vc_counting_allocator_get(&first);
+  vc_allocator second_allocator = vc_counting_allocator_get(&second);
+
+  char* a = vc_allocator_alloc(&first_allocator, 100);
+  char* b = vc_allocator_alloc(&second_allocator, 50);
+  ASSERT_NE(NULL, a);
+  ASSERT_NE(NULL, b);
+  ASSERT_EQ(100, first.current_bytes);
+  ASSERT_EQ(50, second.current_bytes);
+  ASSERT_EQ(150, total.current_bytes);
+  ASSERT_EQ(2, total.alloc_count);
+
+  a = vc_allocator_realloc(&first_allocator, a, 20);
+  ASSERT_NE(NULL, a);
+  ASSERT_EQ(20, first.current_bytes);
+  ASSERT_EQ(100, first.peak_bytes);
+  ASSERT_EQ(70, total.current_bytes);
+  ASSERT_EQ(1, total.realloc_count);
+
+  // The total's peak is of the sum, not the sum of the peaks
+  b = vc_allocator_realloc(&second_allocator, b, 120);
+  ASSERT_NE(NULL, b);
+  ASSERT_EQ(120, second.peak_bytes);
+  ASSERT_EQ(150, total.peak_bytes);
+
+  vc_allocator_free(&first_allocator, a);
+  vc_allocator_free(&second_allocator, b);
+  ASSERT_EQ(0, total.current_bytes);
+  ASSERT_EQ(2, total.free_count);
+  ASSERT_EQ(1, first.free_count);
+
+  printf("%s passed.\n", __func__);
+}
+
 void vc_vector_run_tests() {
   test_vc_vector_create();
   test_vc_vector_element_access();
@@ -344,6 +506,10 @@ void vc_vector_run_tests() {
   test_vc_vector_capacity();
   test_vc_vector_modifiers();
   test_vc_vector_with_strfreefunc();
+  test_vc_vector_small_buffer();
+  test_vc_vector_with_allocator();
+  test_vc_arena();
+  test_vc_counting_allocator_total();
 }
 
 int main() {
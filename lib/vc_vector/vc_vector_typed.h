@@ -0,0 +1,123 @@
+#ifndef VCVECTORTYPED_H
+#define VCVECTORTYPED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "vc_allocator.h"
+
+// ----------------------------------------------------------------------------
+// Type-specialized vector
+// ----------------------------------------------------------------------------
+//
+// VC_VECTOR_DECLARE(T) generates a vector type 'vc_vector_T' and a set of
+// static inline functions 'vc_vector_T_*' operating on it. Elements are
+// stored as T, so pushing is a plain assignment and iterating is pointer
+// arithmetic that the compiler can see through, unlike the untyped vc_vector
+// which copies element_size bytes and iterates through out-of-line calls.
+//
+// Use VC_VECTOR_DECLARE_NAMED(name, T) when T is not a single identifier,
+// e.g. VC_VECTOR_DECLARE_NAMED(str, char*) declares 'vc_vector_str'.
+//
+// A zero-initialized vector is valid and empty; it allocates on first push.
+
+#define VC_VECTOR_TYPED_DEFAULT_COUNT_OF_ELEMENTS 8
+
+// Iterates 'i' (a T*) over every element of the typed vector pointed to by 'v'.
+#define VC_VECTOR_TYPED_FOREACH(i, v) for (i = (v)->data; i != (v)->data + (v)->count; ++i)
+
+#define VC_VECTOR_DECLARE(T) VC_VECTOR_DECLARE_NAMED(T, T)
+
+#define VC_VECTOR_DECLARE_NAMED(name, T)                                                          \
+  typedef struct {                                                                                \
+    size_t count;                                                                                 \
+    size_t reserved_count;                                                                        \
+    T* data;                                                                                      \
+    const vc_allocator* allocator;                                                                \
+  } vc_vector_##name;                                                                             \
+                                                                                                  \
+  /* Resizes the storage to hold exactly new_count elements, if that is more than it has now. */  \
+  static inline bool vc_vector_##name##_reserve(vc_vector_##name* vector, size_t new_count) {     \
+    T* new_data;                                                                                  \
+    if (new_count <= vector->reserved_count) {                                                    \
+      return true;                                                                                \
+    }                                                                                             \
+    new_data = (T*)vc_allocator_realloc(vector->allocator, vector->data, new_count * sizeof(T));  \
+    if (new_data == NULL) {                                                                       \
+      return false;                                                                               \
+    }                                                                                             \
+    vector->data = new_data;                                                                      \
+    vector->reserved_count = new_count;                                                           \
+    return true;                                                                                  \
+  }                                                                                               \
+                                                                                                  \
+  /* Constructs an empty vector in place with an exact reserved size for count_elements, using */ \
+  /* 'allocator' for its memory (NULL for libc). */                                               \
+  static inline bool vc_vector_##name##_init_with_allocator(vc_vector_##name* vector,             \
+                                                            size_t count_elements,                \
+                                                            const vc_allocator* allocator) {      \
+    vector->count = 0;                                                                            \
+    vector->reserved_count = 0;                                                                   \
+    vector->data = NULL;                                                                          \
+    vector->allocator = allocator;                                                                \
+    return vc_vector_##name##_reserve(vector, count_elements);                                    \
+  }                                                                                               \
+                                                                                                  \
+  /* Constructs an empty vector in place with an exact reserved size for count_elements. */       \
+  static inline bool vc_vector_##name##_init(vc_vector_##name* vector, size_t count_elements) {   \
+    return vc_vector_##name##_init_with_allocator(vector, count_elements, NULL);                  \
+  }                                                                                               \
+                                                                                                  \
+  /* Releases the vector's storage, leaving it empty and valid. */                                \
+  static inline void vc_vector_##name##_release(vc_vector_##name* vector) {                       \
+    vc_allocator_free(vector->allocator, vector->data);                                           \
+    vector->count = 0;                                                                            \
+    vector->reserved_count = 0;                                                                   \
+    vector->data = NULL;                                                                          \
+  }                                                                                               \
+                                                                                                  \
+  /* Grows the storage by half (integer arithmetic), used when a push finds the vector full. */   \
+  static inline bool vc_vector_##name##_grow(vc_vector_##name* vector) {                          \
+    size_t new_count = vector->reserved_count + vector->reserved_count / 2;                       \
+    if (new_count < VC_VECTOR_TYPED_DEFAULT_COUNT_OF_ELEMENTS) {                                  \
+      new_count = VC_VECTOR_TYPED_DEFAULT_COUNT_OF_ELEMENTS;                                      \
+    }                                                                                             \
+    return vc_vector_##name##_reserve(vector, new_count);                                         \
+  }                                                                                               \
+                                                                                                  \
+  /* Inserts value at the end of the vector. */                                                   \
+  static inline bool vc_vector_##name##_push_back(vc_vector_##name* vector, T value) {            \
+    if (vector->count == vector->reserved_count && !vc_vector_##name##_grow(vector)) {            \
+      return false;                                                                               \
+    }                                                                                             \
+    vector->data[vector->count++] = value;                                                        \
+    return true;                                                                                  \
+  }                                                                                               \
+                                                                                                  \
+  /* Removes all elements from the vector (without reallocation). */                              \
+  static inline void vc_vector_##name##_clear(vc_vector_##name* vector) {                         \
+    vector->count = 0;                                                                            \
+  }                                                                                               \
+                                                                                                  \
+  /* Returns the item at index position in the vector. */                                         \
+  static inline T* vc_vector_##name##_at(const vc_vector_##name* vector, size_t index) {          \
+    return &vector->data[index];                                                                  \
+  }                                                                                               \
+                                                                                                  \
+  /* Returns the number of elements in the vector. */                                             \
+  static inline size_t vc_vector_##name##_count(const vc_vector_##name* vector) {                 \
+    return vector->count;                                                                         \
+  }                                                                                               \
+                                                                                                  \
+  /* Returns a pointer to the first item in the vector. */                                        \
+  static inline T* vc_vector_##name##_begin(const vc_vector_##name* vector) {                     \
+    return vector->data;                                                                          \
+  }                                                                                               \
+                                                                                                  \
+  /* Returns a pointer to the imaginary item after the last item in the vector. */                \
+  static inline T* vc_vector_##name##_end(const vc_vector_##name* vector) {                       \
+    return vector->data + vector->count;                                                          \
+  }                                                                                               \
+                                                                                                  \
+  typedef int vc_vector_##name##_declared
+
+#endif // VCVECTORTYPED_H
@@ -0,0 +1,251 @@
+/**
+ * Functions for reading and applying Zelda64 overlay relocation sections, in the same way as the games' overlay loader
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include "z64ovl.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "mips_elf.h"
+
+/* Number of relocs decoded at once by Z64Ovl_RelocateBatched */
+#define Z64OVL_BATCH_SIZE 64
+
+/* The loader leaves alone addresses outside KSEG0 that do not look like they are in the overlay, e.g. segmented ones */
+#define Z64OVL_SHOULD_RELOCATE(addr) (((addr)&0x0F000000) == 0)
+
+/* The images are N64 memory, so are big-endian */
+uint32_t Z64Ovl_ReadWord(const uint8_t* data) {
+    return (uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | (uint32_t)data[3] << 0;
+}
+
+void Z64Ovl_WriteWord(uint8_t* data, uint32_t word) {
+    data[0] = word >> 24;
+    data[1] = word >> 16;
+    data[2] = word >> 8;
+    data[3] = word >> 0;
+}
+
+/**
+ * Decode the overlay info of a whole overlay image (text, data, rodata and .ovl sections), which is found using the
+ * OverlayInfoOffset in its final word. info->relocs points into image. Returns false if the sizes do not fit in the
+ * image.
+ */
+bool Z64Ovl_ReadOverlayInfo(Z64OvlInfo* info, const uint8_t* image, size_t imageSize) {
+    const uint8_t* ovlInfo;
+
+    if (imageSize < 0x18 || (imageSize % 4) != 0) {
+        return false;
+    }
+
+    info->infoOffset = Z64Ovl_ReadWord(&image[imageSize - 4]);
+    if (info->infoOffset < 0x18 || info->infoOffset > imageSize || (info->infoOffset % 4) != 0) {
+        return false;
+    }
+    ovlInfo = &image[imageSize - info->infoOffset];
+
+    info->textSize = Z64Ovl_ReadWord(&ovlInfo[0x0]);
+    info->dataSize = Z64Ovl_ReadWord(&ovlInfo[0x4]);
+    info->rodataSize = Z64Ovl_ReadWord(&ovlInfo[0x8]);
+    info->bssSize = Z64Ovl_ReadWord(&ovlInfo[0xC]);
+    info->relocCount = Z64Ovl_ReadWord(&ovlInfo[0x10]);
+    info->relocs = &ovlInfo[0x14];
+
+    return info->relocCount <= (info->infoOffset - 0x18) / 4;
+}
+
+/**
+ * Find the offset into the image of the word a reloc applies to, returning false if it is invalid.
+ */
+static bool Z64Ovl_GetRelocOffset(size_t* offsetOut, uint32_t reloc, const Z64OvlInfo* info, size_t imageSize) {
+    size_t offset = Z64OVL_RELOC_OFFSET(reloc);
+
+    switch (Z64OVL_RELOC_SECTION(reloc)) {
+        case Z64OVL_SECTION_TEXT:
+            break;
+
+        case Z64OVL_SECTION_DATA:
+            offset += info->textSize;
+            break;
+
+        case Z64OVL_SECTION_RODATA:
+            offset += info->textSize + info->dataSize;
+            break;
+
+        default:
+            return false;
+    }
+
+    /* The loader uses word accesses, so an unaligned offset would crash the game */
+    *offsetOut = offset;
+    return (offset % 4) == 0 && offset + 4 <= imageSize;
+}
+
+/**
+ * Relocate an overlay image that was linked at vramStart so that it can run at allocatedAddress, one reloc at a time,
+ * exactly as the games' loader does. As in the games, a LO16 is paired with the most recent HI16 whose lui targets the
+ * register the LO16 instruction uses as its base. Returns false if the reloc table is malformed.
+ */
+bool Z64Ovl_Relocate(uint8_t* image, size_t imageSize, const Z64OvlInfo* info, uint32_t vramStart,
+                     uint32_t allocatedAddress) {
+    uint8_t* hiRefs[32] = { NULL };
+    uint32_t hiVals[32] = { 0 };
+    uint32_t i;
+
+    for (i = 0; i < info->relocCount; i++) {
+        uint32_t reloc = Z64Ovl_ReadWord(&info->relocs[4 * i]);
+        size_t offset;
+        uint8_t* relocData;
+        uint32_t word;
+        uint32_t address;
+
+        if (!Z64Ovl_GetRelocOffset(&offset, reloc, info, imageSize)) {
+            return false;
+        }
+        relocData = &image[offset];
+        word = Z64Ovl_ReadWord(relocData);
+
+        switch (Z64OVL_RELOC_TYPE(reloc)) {
+            case R_MIPS_32:
+                if (Z64OVL_SHOULD_RELOCATE(word)) {
+                    Z64Ovl_WriteWord(relocData, word - vramStart + allocatedAddress);
+                }
+                break;
+
+            case R_MIPS_26:
+                /* Jump targets are always in KSEG0 */
+                address = 0x80000000 | ((word & 0x03FFFFFF) << 2);
+                address = address - vramStart + allocatedAddress;
+                Z64Ovl_WriteWord(relocData, (word & 0xFC000000) | ((address & 0x0FFFFFFF) >> 2));
+                break;
+
+            case R_MIPS_HI16:
+                /* Indexed by rt */
+                hiRefs[(word >> 0x10) & 0x1F] = relocData;
+                hiVals[(word >> 0x10) & 0x1F] = word;
+                break;
+
+            case R_MIPS_LO16: {
+                /* Indexed by rs */
+                uint32_t reg = (word >> 0x15) & 0x1F;
+
+                if (hiRefs[reg] == NULL) {
+                    return false;
+                }
+
+                address = (hiVals[reg] << 0x10) + (int16_t)(word & 0xFFFF);
+                if (Z64OVL_SHOULD_RELOCATE(address)) {
+                    address = address - vramStart + allocatedAddress;
+                    /* The lo immediate is signed, so the hi has to be adjusted if it is negative */
+                    Z64Ovl_WriteWord(hiRefs[reg], (hiVals[reg] & 0xFFFF0000) |
+                                                      (((address >> 0x10) + ((address & 0x8000) ? 1 : 0)) & 0xFFFF));
+                    Z64Ovl_WriteWord(relocData, (word & 0xFFFF0000) | (address & 0xFFFF));
+                }
+            } break;
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Same as Z64Ovl_Relocate, but decodes Z64OVL_BATCH_SIZE relocs at a time into a list per type, and then applies each
+ * list in its own loop without branching on the type. R_MIPS_32 and R_MIPS_26 relocs are independent of each other and
+ * everything else, so only the HI16/LO16 list needs to stay in table order.
+ */
+bool Z64Ovl_RelocateBatched(uint8_t* image, size_t imageSize, const Z64OvlInfo* info, uint32_t vramStart,
+                            uint32_t allocatedAddress) {
+    /* Which list each reloc type goes in, 3 for invalid. LO16s go in the HI16 list with the bottom bit set. */
+    static const uint8_t typeLists[0x40] = {
+        3, 3, 0, 3, 1, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    };
+    uint32_t lists[4][Z64OVL_BATCH_SIZE]; /* R_MIPS_32, R_MIPS_26, HI16/LO16, invalid */
+    uint32_t sectionStarts[4];
+    uint8_t* hiRefs[32] = { NULL };
+    uint32_t hiVals[32] = { 0 };
+    uint32_t delta = allocatedAddress - vramStart;
+    uint32_t batchStart;
+
+    sectionStarts[Z64OVL_SECTION_NONE] = 0;
+    sectionStarts[Z64OVL_SECTION_TEXT] = 0;
+    sectionStarts[Z64OVL_SECTION_DATA] = info->textSize;
+    sectionStarts[Z64OVL_SECTION_RODATA] = info->textSize + info->dataSize;
+
+    for (batchStart = 0; batchStart < info->relocCount; batchStart += Z64OVL_BATCH_SIZE) {
+        uint32_t batchEnd = batchStart + Z64OVL_BATCH_SIZE;
+        size_t counts[4] = { 0 };
+        bool valid = true;
+        uint32_t i;
+        size_t j;
+
+        if (batchEnd > info->relocCount) {
+            batchEnd = info->relocCount;
+        }
+
+        /* Decode */
+        for (i = batchStart; i < batchEnd; i++) {
+            uint32_t reloc = Z64Ovl_ReadWord(&info->relocs[4 * i]);
+            uint32_t type = Z64OVL_RELOC_TYPE(reloc);
+            size_t offset = sectionStarts[Z64OVL_RELOC_SECTION(reloc)] + Z64OVL_RELOC_OFFSET(reloc);
+            size_t list = typeLists[type];
+
+            valid &= (Z64OVL_RELOC_SECTION(reloc) != Z64OVL_SECTION_NONE) & ((offset % 4) == 0) &
+                     (offset + 4 <= imageSize);
+            lists[list][counts[list]++] = offset | (type == R_MIPS_LO16);
+        }
+        if (!valid || counts[3] != 0) {
+            return false;
+        }
+
+        /* Apply */
+        for (j = 0; j < counts[0]; j++) {
+            uint8_t* relocData = &image[lists[0][j]];
+            uint32_t word = Z64Ovl_ReadWord(relocData);
+            uint32_t mask = -(uint32_t)Z64OVL_SHOULD_RELOCATE(word);
+
+            Z64Ovl_WriteWord(relocData, word + (delta & mask));
+        }
+
+        for (j = 0; j < counts[1]; j++) {
+            uint8_t* relocData = &image[lists[1][j]];
+            uint32_t word = Z64Ovl_ReadWord(relocData);
+            uint32_t address = (0x80000000 | ((word & 0x03FFFFFF) << 2)) + delta;
+
+            Z64Ovl_WriteWord(relocData, (word & 0xFC000000) | ((address & 0x0FFFFFFF) >> 2));
+        }
+
+        for (j = 0; j < counts[2]; j++) {
+            uint8_t* relocData = &image[lists[2][j] & ~1];
+            uint32_t word = Z64Ovl_ReadWord(relocData);
+            uint32_t reg;
+            uint32_t address;
+
+            if (!(lists[2][j] & 1)) {
+                hiRefs[(word >> 0x10) & 0x1F] = relocData;
+                hiVals[(word >> 0x10) & 0x1F] = word;
+                continue;
+            }
+
+            reg = (word >> 0x15) & 0x1F;
+            if (hiRefs[reg] == NULL) {
+                return false;
+            }
+
+            address = (hiVals[reg] << 0x10) + (int16_t)(word & 0xFFFF);
+            if (Z64OVL_SHOULD_RELOCATE(address)) {
+                address += delta;
+                Z64Ovl_WriteWord(hiRefs[reg], (hiVals[reg] & 0xFFFF0000) |
+                                                  (((address >> 0x10) + ((address & 0x8000) ? 1 : 0)) & 0xFFFF));
+                Z64Ovl_WriteWord(relocData, (word & 0xFFFF0000) | (address & 0xFFFF));
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,41 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Reloc entry bitpacking, see z64_relocation_section_format.md */
+#define Z64OVL_RELOC_SECTION(reloc) ((reloc) >> 0x1E)
+#define Z64OVL_RELOC_TYPE(reloc) (((reloc) >> 0x18) & 0x3F)
+#define Z64OVL_RELOC_OFFSET(reloc) ((reloc)&0xFFFFFF)
+#define Z64OVL_MAKE_RELOC(section, type, offset) \
+    ((((uint32_t)(section)&3) << 0x1E) | (((uint32_t)(type)&0x3F) << 0x18) | ((uint32_t)(offset)&0xFFFFFF))
+
+typedef enum {
+    Z64OVL_SECTION_NONE,
+    Z64OVL_SECTION_TEXT,
+    Z64OVL_SECTION_DATA,
+    Z64OVL_SECTION_RODATA //,
+} Z64OvlSection;
+
+typedef struct {
+    uint32_t textSize;
+    uint32_t dataSize;
+    uint32_t rodataSize;
+    uint32_t bssSize;
+    uint32_t relocCount;
+    const uint8_t* relocs; /* relocCount big-endian words */
+    uint32_t infoOffset;   /* The final word of the .ovl section, its offset from the end of the overlay */
+} Z64OvlInfo;
+
+uint32_t Z64Ovl_ReadWord(const uint8_t* data);
+void Z64Ovl_WriteWord(uint8_t* data, uint32_t word);
+
+bool Z64Ovl_ReadOverlayInfo(Z64OvlInfo* info, const uint8_t* image, size_t imageSize);
+
+bool Z64Ovl_Relocate(uint8_t* image, size_t imageSize, const Z64OvlInfo* info, uint32_t vramStart,
+                     uint32_t allocatedAddress);
+bool Z64Ovl_RelocateBatched(uint8_t* image, size_t imageSize, const Z64OvlInfo* info, uint32_t vramStart,
+                            uint32_t allocatedAddress);
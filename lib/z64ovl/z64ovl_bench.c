@@ -0,0 +1,134 @@
+/**
+ * Throughput benchmark comparing Z64Ovl_Relocate with Z64Ovl_RelocateBatched on synthetic overlays
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 199309L
+#include "z64ovl.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mips_elf.h"
+
+#define BENCH_VRAM 0x80800000
+#define BENCH_TARGET 0x80A1F9C0
+#define BENCH_TOTAL_RELOCS 20000000 /* Per measurement, spread over as many iterations as necessary */
+
+typedef bool (*RelocateFunc)(uint8_t*, size_t, const Z64OvlInfo*, uint32_t, uint32_t);
+
+static uint64_t Bench_Now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * Build an overlay with a reloc mix similar to a real actor: mostly HI/LO pairs (some sharing a HI), with jals in the
+ * text and pointers in the data. Returns the image size.
+ */
+static size_t Bench_MakeOverlay(uint8_t** imageOut, uint32_t groups) {
+    uint32_t textSize = groups * 0x10;
+    uint32_t dataSize = (groups / 2) * 4;
+    uint32_t relocCount = groups * 4 + groups / 2;
+    uint32_t ovlSize = (4 * (relocCount + 6) + 0xF) & ~0xF;
+    size_t size = textSize + dataSize + ovlSize;
+    uint8_t* image = calloc(size, 1);
+    uint8_t* ovl = &image[textSize + dataSize];
+    uint32_t relocIndex = 0;
+    uint32_t i;
+
+    for (i = 0; i < groups; i++) {
+        uint32_t offset = i * 0x10;
+        uint32_t target = BENCH_VRAM + textSize + (i % (dataSize / 4 + 1)) * 4;
+        uint32_t hi = ((target >> 16) + ((target & 0x8000) ? 1 : 0)) & 0xFFFF;
+
+        Z64Ovl_WriteWord(&image[offset + 0x0], 0x3C010000 | hi);                      /* lui at, %hi(target) */
+        Z64Ovl_WriteWord(&image[offset + 0x4], 0x8C280000 | (target & 0xFFFF));       /* lw t0, %lo(target)(at) */
+        Z64Ovl_WriteWord(&image[offset + 0x8], 0x24280000 | (target & 0xFFFF));       /* addiu t0, at, %lo(target) */
+        Z64Ovl_WriteWord(&image[offset + 0xC], 0x0C000000 | ((BENCH_VRAM & 0x0FFFFFFF) >> 2)); /* jal text */
+
+        Z64Ovl_WriteWord(&ovl[0x14 + 4 * relocIndex++], Z64OVL_MAKE_RELOC(Z64OVL_SECTION_TEXT, R_MIPS_HI16, offset));
+        Z64Ovl_WriteWord(&ovl[0x14 + 4 * relocIndex++],
+                         Z64OVL_MAKE_RELOC(Z64OVL_SECTION_TEXT, R_MIPS_LO16, offset + 0x4));
+        Z64Ovl_WriteWord(&ovl[0x14 + 4 * relocIndex++],
+                         Z64OVL_MAKE_RELOC(Z64OVL_SECTION_TEXT, R_MIPS_LO16, offset + 0x8));
+        Z64Ovl_WriteWord(&ovl[0x14 + 4 * relocIndex++],
+                         Z64OVL_MAKE_RELOC(Z64OVL_SECTION_TEXT, R_MIPS_26, offset + 0xC));
+    }
+    for (i = 0; i < dataSize / 4; i++) {
+        Z64Ovl_WriteWord(&image[textSize + 4 * i], BENCH_VRAM + 0x10 * i);
+        Z64Ovl_WriteWord(&ovl[0x14 + 4 * relocIndex++], Z64OVL_MAKE_RELOC(Z64OVL_SECTION_DATA, R_MIPS_32, 4 * i));
+    }
+
+    Z64Ovl_WriteWord(&ovl[0x0], textSize);
+    Z64Ovl_WriteWord(&ovl[0x4], dataSize);
+    Z64Ovl_WriteWord(&ovl[0x10], relocCount);
+    Z64Ovl_WriteWord(&ovl[ovlSize - 4], ovlSize);
+
+    *imageOut = image;
+    return size;
+}
+
+/* Returns nanoseconds per reloc */
+static double Bench_Run(RelocateFunc relocate, const uint8_t* pristine, uint8_t* work, size_t size) {
+    Z64OvlInfo info;
+    uint64_t elapsed = 0;
+    uint32_t iterations;
+    uint32_t i;
+
+    Z64Ovl_ReadOverlayInfo(&info, work, size);
+    iterations = BENCH_TOTAL_RELOCS / info.relocCount + 1;
+
+    for (i = 0; i < iterations; i++) {
+        uint64_t start;
+
+        memcpy(work, pristine, size);
+        start = Bench_Now();
+        if (!relocate(work, size, &info, BENCH_VRAM, BENCH_TARGET)) {
+            fprintf(stderr, "error: relocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        elapsed += Bench_Now() - start;
+    }
+
+    return (double)elapsed / ((double)iterations * info.relocCount);
+}
+
+int main(void) {
+    static const uint32_t groupCounts[] = { 0x40, 0x400, 0x4000, 0x10000 };
+    size_t i;
+
+    printf("relocs,scalar_ns_per_reloc,batched_ns_per_reloc,speedup\n");
+    for (i = 0; i < sizeof(groupCounts) / sizeof(groupCounts[0]); i++) {
+        uint8_t* pristine;
+        size_t size = Bench_MakeOverlay(&pristine, groupCounts[i]);
+        uint8_t* work = malloc(size);
+        uint8_t* check = malloc(size);
+        Z64OvlInfo info;
+        double scalar;
+        double batched;
+
+        memcpy(work, pristine, size);
+        Z64Ovl_ReadOverlayInfo(&info, work, size);
+
+        scalar = Bench_Run(Z64Ovl_Relocate, pristine, work, size);
+        memcpy(check, work, size);
+        batched = Bench_Run(Z64Ovl_RelocateBatched, pristine, work, size);
+        if (memcmp(check, work, size) != 0) {
+            fprintf(stderr, "error: scalar and batched relocation results differ\n");
+            return EXIT_FAILURE;
+        }
+
+        printf("%u,%.3f,%.3f,%.2f\n", info.relocCount, scalar, batched, scalar / batched);
+
+        free(check);
+        free(work);
+        free(pristine);
+    }
+
+    return EXIT_SUCCESS;
+}
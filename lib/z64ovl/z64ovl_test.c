@@ -0,0 +1,241 @@
+/**
+ * Tests for the reference overlay relocator: an overlay linked at one address and relocated to another must be
+ * identical to the same overlay linked at the second address.
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include "z64ovl.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mips_elf.h"
+
+#define ASSERT_EQ(expected, actual)                                                                         \
+    do {                                                                                                    \
+        if ((expected) != (actual)) {                                                                       \
+            fprintf(stderr, "Failed line %u. Expected: 0x%" PRIXMAX ". Actual: 0x%" PRIXMAX ".\n", __LINE__, \
+                    (uintmax_t)(expected), (uintmax_t)(actual));                                            \
+            abort();                                                                                        \
+        }                                                                                                   \
+    } while (0)
+
+#define ASSERT_TRUE(actual) ASSERT_EQ(true, (actual))
+#define ASSERT_FALSE(actual) ASSERT_EQ(false, (actual))
+
+/* Instruction encodings */
+#define LUI(rt, imm) (0x3C000000 | (rt) << 16 | ((imm)&0xFFFF))
+#define ADDIU(rt, rs, imm) (0x24000000 | (rs) << 21 | (rt) << 16 | ((imm)&0xFFFF))
+#define LW(rt, imm, rs) (0x8C000000 | (rs) << 21 | (rt) << 16 | ((imm)&0xFFFF))
+#define LWC1(ft, imm, rs) (0xC4000000 | (rs) << 21 | (ft) << 16 | ((imm)&0xFFFF))
+#define SW(rt, imm, rs) (0xAC000000 | (rs) << 21 | (rt) << 16 | ((imm)&0xFFFF))
+#define JAL(target) (0x0C000000 | (((target)&0x0FFFFFFF) >> 2))
+#define JR_RA 0x03E00008
+#define NOP 0
+
+#define HI(addr) ((((addr) >> 16) + (((addr)&0x8000) ? 1 : 0)) & 0xFFFF)
+#define LO(addr) ((addr)&0xFFFF)
+
+#define REG_AT 1
+#define REG_V0 2
+#define REG_A0 4
+#define REG_T0 8
+
+#define TEST_JAL_COUNT 63 /* Enough to put the first HI/LO pair across a batch boundary */
+#define TEST_POINTER_COUNT 100
+#define TEST_TEXT_SIZE 0x130
+#define TEST_DATA_SIZE 0x1A0
+#define TEST_RODATA_SIZE 0x10
+#define TEST_BSS_SIZE 0x8000
+#define TEST_MAX_RELOCS 0x100
+
+typedef struct {
+    uint8_t image[0x800];
+    size_t size;
+    uint32_t relocs[TEST_MAX_RELOCS];
+    uint32_t relocCount;
+} TestOverlay;
+
+static void Test_Emit(TestOverlay* ovl, uint32_t* offset, uint32_t word, Z64OvlSection section, uint32_t type) {
+    Z64Ovl_WriteWord(&ovl->image[*offset], word);
+    if (type != R_MIPS_NONE) {
+        uint32_t sectionStart = (section == Z64OVL_SECTION_TEXT)   ? 0
+                                : (section == Z64OVL_SECTION_DATA) ? TEST_TEXT_SIZE
+                                                                   : TEST_TEXT_SIZE + TEST_DATA_SIZE;
+
+        ovl->relocs[ovl->relocCount++] = Z64OVL_MAKE_RELOC(section, type, *offset - sectionStart);
+    }
+    *offset += 4;
+}
+
+/**
+ * "Statically link" a small overlay at vram, recording its relocs in a .ovl section laid out as Fado does.
+ */
+static void Test_LinkOverlay(TestOverlay* ovl, uint32_t vram) {
+    uint32_t textStart = vram;
+    uint32_t dataStart = textStart + TEST_TEXT_SIZE;
+    uint32_t rodataStart = dataStart + TEST_DATA_SIZE;
+    uint32_t bssStart = rodataStart + TEST_RODATA_SIZE;
+    uint32_t func = textStart + 4 * TEST_JAL_COUNT;
+    uint32_t offset = 0;
+    uint32_t i;
+
+    memset(ovl, 0, sizeof(*ovl));
+
+    /* text */
+    for (i = 0; i < TEST_JAL_COUNT; i++) {
+        Test_Emit(ovl, &offset, JAL(func), Z64OVL_SECTION_TEXT, R_MIPS_26);
+    }
+    Test_Emit(ovl, &offset, JR_RA, Z64OVL_SECTION_TEXT, R_MIPS_NONE);
+    Test_Emit(ovl, &offset, LUI(REG_A0, HI(dataStart + 0x10)), Z64OVL_SECTION_TEXT, R_MIPS_HI16);
+    Test_Emit(ovl, &offset, ADDIU(REG_A0, REG_A0, LO(dataStart + 0x10)), Z64OVL_SECTION_TEXT, R_MIPS_LO16);
+    /* Two LOs sharing a HI */
+    Test_Emit(ovl, &offset, LUI(REG_AT, HI(rodataStart + 0x8)), Z64OVL_SECTION_TEXT, R_MIPS_HI16);
+    Test_Emit(ovl, &offset, LW(REG_T0, LO(rodataStart + 0x8), REG_AT), Z64OVL_SECTION_TEXT, R_MIPS_LO16);
+    Test_Emit(ovl, &offset, LWC1(4, LO(rodataStart + 0xC), REG_AT), Z64OVL_SECTION_TEXT, R_MIPS_LO16);
+    /* A HI/LO pair whose LO is negative, with something else in between */
+    Test_Emit(ovl, &offset, LUI(REG_V0, HI(bssStart + 0x7FF0)), Z64OVL_SECTION_TEXT, R_MIPS_HI16);
+    Test_Emit(ovl, &offset, JAL(func), Z64OVL_SECTION_TEXT, R_MIPS_26);
+    Test_Emit(ovl, &offset, SW(0, LO(bssStart + 0x7FF0), REG_V0), Z64OVL_SECTION_TEXT, R_MIPS_LO16);
+    while (offset < TEST_TEXT_SIZE) {
+        Test_Emit(ovl, &offset, NOP, Z64OVL_SECTION_TEXT, R_MIPS_NONE);
+    }
+
+    /* data */
+    Test_Emit(ovl, &offset, 0x06001234, Z64OVL_SECTION_DATA, R_MIPS_32); /* Segmented, so not relocated */
+    for (i = 0; i < TEST_POINTER_COUNT; i++) {
+        Test_Emit(ovl, &offset, textStart + 4 * (i % TEST_JAL_COUNT), Z64OVL_SECTION_DATA, R_MIPS_32);
+    }
+    while (offset < TEST_TEXT_SIZE + TEST_DATA_SIZE) {
+        Test_Emit(ovl, &offset, 0, Z64OVL_SECTION_DATA, R_MIPS_NONE);
+    }
+
+    /* rodata: a jumptable and a float */
+    Test_Emit(ovl, &offset, func, Z64OVL_SECTION_RODATA, R_MIPS_32);
+    Test_Emit(ovl, &offset, func + 4, Z64OVL_SECTION_RODATA, R_MIPS_32);
+    Test_Emit(ovl, &offset, 0x3F800000, Z64OVL_SECTION_RODATA, R_MIPS_NONE);
+    Test_Emit(ovl, &offset, 0, Z64OVL_SECTION_RODATA, R_MIPS_NONE);
+
+    /* .ovl */
+    {
+        uint32_t ovlStart = offset;
+
+        Z64Ovl_WriteWord(&ovl->image[offset], TEST_TEXT_SIZE);
+        Z64Ovl_WriteWord(&ovl->image[offset + 0x4], TEST_DATA_SIZE);
+        Z64Ovl_WriteWord(&ovl->image[offset + 0x8], TEST_RODATA_SIZE);
+        Z64Ovl_WriteWord(&ovl->image[offset + 0xC], TEST_BSS_SIZE);
+        Z64Ovl_WriteWord(&ovl->image[offset + 0x10], ovl->relocCount);
+        offset += 0x14;
+        for (i = 0; i < ovl->relocCount; i++) {
+            Z64Ovl_WriteWord(&ovl->image[offset], ovl->relocs[i]);
+            offset += 4;
+        }
+        offset = (offset + 4 + 0xF) & ~0xF;
+        Z64Ovl_WriteWord(&ovl->image[offset - 4], offset - ovlStart);
+    }
+
+    ovl->size = offset;
+}
+
+void Test_ReadOverlayInfo(void) {
+    TestOverlay ovl;
+    Z64OvlInfo info;
+
+    Test_LinkOverlay(&ovl, 0x80800000);
+    ASSERT_TRUE(Z64Ovl_ReadOverlayInfo(&info, ovl.image, ovl.size));
+    ASSERT_EQ(TEST_TEXT_SIZE, info.textSize);
+    ASSERT_EQ(TEST_DATA_SIZE, info.dataSize);
+    ASSERT_EQ(TEST_RODATA_SIZE, info.rodataSize);
+    ASSERT_EQ(TEST_BSS_SIZE, info.bssSize);
+    ASSERT_EQ(ovl.relocCount, info.relocCount);
+    ASSERT_EQ(ovl.relocs[0], Z64Ovl_ReadWord(info.relocs));
+    ASSERT_EQ(0, (info.infoOffset & 0xF));
+    ASSERT_EQ(ovl.size, TEST_TEXT_SIZE + TEST_DATA_SIZE + TEST_RODATA_SIZE + info.infoOffset);
+
+    /* Truncated */
+    ASSERT_FALSE(Z64Ovl_ReadOverlayInfo(&info, ovl.image, ovl.size - 4));
+    ASSERT_FALSE(Z64Ovl_ReadOverlayInfo(&info, ovl.image, 0x10));
+
+    printf("%s passed.\n", __func__);
+}
+
+static void Test_RelocateTo(bool batched, uint32_t linkedVram, uint32_t targetVram) {
+    TestOverlay ovl;
+    TestOverlay expected;
+    Z64OvlInfo info;
+
+    Test_LinkOverlay(&ovl, linkedVram);
+    Test_LinkOverlay(&expected, targetVram);
+    ASSERT_TRUE(Z64Ovl_ReadOverlayInfo(&info, ovl.image, ovl.size));
+
+    if (batched) {
+        ASSERT_TRUE(Z64Ovl_RelocateBatched(ovl.image, ovl.size, &info, linkedVram, targetVram));
+    } else {
+        ASSERT_TRUE(Z64Ovl_Relocate(ovl.image, ovl.size, &info, linkedVram, targetVram));
+    }
+
+    ASSERT_EQ(expected.size, ovl.size);
+    ASSERT_EQ(0, memcmp(expected.image, ovl.image, ovl.size));
+}
+
+void Test_Relocate(void) {
+    size_t batched;
+
+    for (batched = 0; batched < 2; batched++) {
+        Test_RelocateTo(batched, 0x80800000, 0x80800000);
+        Test_RelocateTo(batched, 0x80800000, 0x80A1F9C0);
+        Test_RelocateTo(batched, 0x80A1F9C0, 0x80800000);
+        Test_RelocateTo(batched, 0x80ABCDE0, 0x8012FFF0);
+    }
+
+    printf("%s passed.\n", __func__);
+}
+
+void Test_RelocateMalformed(void) {
+    TestOverlay ovl;
+    Z64OvlInfo info;
+    size_t batched;
+
+    for (batched = 0; batched < 2; batched++) {
+        bool (*relocate)(uint8_t*, size_t, const Z64OvlInfo*, uint32_t, uint32_t) =
+            batched ? Z64Ovl_RelocateBatched : Z64Ovl_Relocate;
+        uint8_t* firstReloc;
+
+        Test_LinkOverlay(&ovl, 0x80800000);
+        ASSERT_TRUE(Z64Ovl_ReadOverlayInfo(&info, ovl.image, ovl.size));
+        firstReloc = &ovl.image[info.relocs - ovl.image];
+
+        /* No section */
+        Z64Ovl_WriteWord(firstReloc, Z64OVL_MAKE_RELOC(Z64OVL_SECTION_NONE, R_MIPS_26, 0));
+        ASSERT_FALSE(relocate(ovl.image, ovl.size, &info, 0x80800000, 0x80900000));
+
+        /* Outside the image */
+        Z64Ovl_WriteWord(firstReloc, Z64OVL_MAKE_RELOC(Z64OVL_SECTION_RODATA, R_MIPS_32, 0x1000));
+        ASSERT_FALSE(relocate(ovl.image, ovl.size, &info, 0x80800000, 0x80900000));
+
+        /* Unaligned */
+        Z64Ovl_WriteWord(firstReloc, Z64OVL_MAKE_RELOC(Z64OVL_SECTION_TEXT, R_MIPS_26, 2));
+        ASSERT_FALSE(relocate(ovl.image, ovl.size, &info, 0x80800000, 0x80900000));
+
+        /* Unsupported type */
+        Z64Ovl_WriteWord(firstReloc, Z64OVL_MAKE_RELOC(Z64OVL_SECTION_TEXT, R_MIPS_GPREL16, 0));
+        ASSERT_FALSE(relocate(ovl.image, ovl.size, &info, 0x80800000, 0x80900000));
+
+        /* LO16 without a HI16 */
+        Z64Ovl_WriteWord(firstReloc, Z64OVL_MAKE_RELOC(Z64OVL_SECTION_TEXT, R_MIPS_LO16, 4 * (TEST_JAL_COUNT + 2)));
+        ASSERT_FALSE(relocate(ovl.image, ovl.size, &info, 0x80800000, 0x80900000));
+    }
+
+    printf("%s passed.\n", __func__);
+}
+
+int main(void) {
+    Test_ReadOverlayInfo();
+    Test_Relocate();
+    Test_RelocateMalformed();
+    printf("Tests passed.\n");
+    return 0;
+}
@@ -3,6 +3,7 @@
  */
 /* Copyright (C) 2021 Elliptic Ellipsis */
 /* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* fmemopen */
 #include "fado.h"
 
 #include <assert.h>
@@ -11,36 +12,43 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "fado_stats.h"
 #include "fairy/fairy.h"
 #include "macros.h"
-#include "vc_vector/vc_vector.h"
+#include "vc_vector/vc_vector_typed.h"
+#include "z64ovl/z64ovl.h"
+
+VC_VECTOR_DECLARE_NAMED(str, char*);
 
 /* String-finding-related functions */
 
 /**
  * For each input file, construct a vector of pointers to the starts of the strings defined in that file.
  */
-void Fado_ConstructStringVectors(vc_vector** stringVectors, FairyFileInfo* fileInfo, int numFiles) {
+void Fado_ConstructStringVectors(vc_vector_str* stringVectors, FairyFileInfo* fileInfo, int numFiles,
+                                 const vc_allocator* allocator) {
     int currentFile;
     size_t currentSym;
 
     for (currentFile = 0; currentFile < numFiles; currentFile++) {
         FairySym* symtab = fileInfo[currentFile].symtabInfo.sectionData;
 
-        stringVectors[currentFile] = vc_vector_create(0x40, sizeof(char**), NULL);
+        /* At most one entry per symbol, so reserving that many means the vector never grows */
+        assert(vc_vector_str_init_with_allocator(&stringVectors[currentFile],
+                                                 fileInfo[currentFile].symtabInfo.sectionEntryCount, allocator));
 
         /* Build a vector of pointers to defined symbols' names */
         for (currentSym = 0; currentSym < fileInfo[currentFile].symtabInfo.sectionEntryCount; currentSym++) {
             if (symtab[currentSym].st_shndx != STN_UNDEF) {
-                /* Have to pass a double pointer so it copies the pointer instead of the start of the string */
-                char* stringPtr = &fileInfo[currentFile].strtab[symtab[currentSym].st_name];
-                assert(vc_vector_push_back(stringVectors[currentFile], &stringPtr));
+                assert(vc_vector_str_push_back(&stringVectors[currentFile],
+                                               &fileInfo[currentFile].strtab[symtab[currentSym].st_name]));
             }
         }
     }
 }
 
-bool Fado_FindSymbolNameInOtherFiles(const char* name, int thisFile, vc_vector** stringVectors, int numFiles) {
+bool Fado_FindSymbolNameInOtherFiles(const FairyContext* context, const char* name, int thisFile,
+                                     vc_vector_str* stringVectors, int numFiles) {
     int currentFile;
     char** currentString;
 
@@ -48,39 +56,29 @@ bool Fado_FindSymbolNameInOtherFiles(const char* name, int thisFile, vc_vector**
         if (currentFile == thisFile) {
             continue;
         }
-        VC_FOREACH(currentString, stringVectors[currentFile]) {
+        VC_VECTOR_TYPED_FOREACH(currentString, &stringVectors[currentFile]) {
             if (strcmp(name, *currentString) == 0) {
-                FAIRY_DEBUG_PRINTF("Match found for %s\n", name);
+                FAIRY_DEBUG_PRINTF(context, "Match found for %s\n", name);
                 return true;
             }
         }
     }
-    FAIRY_DEBUG_PRINTF("No match found for %s\n", name);
+    FAIRY_DEBUG_PRINTF(context, "No match found for %s\n", name);
     return false;
 }
 
-void Fado_DestroyStringVectors(vc_vector** stringVectors, int numFiles) {
+void Fado_DestroyStringVectors(vc_vector_str* stringVectors, int numFiles, const vc_allocator* allocator) {
     int currentFile;
     for (currentFile = 0; currentFile < numFiles; currentFile++) {
-        vc_vector_release(stringVectors[currentFile]);
+        vc_vector_str_release(&stringVectors[currentFile]);
     }
-    free(stringVectors);
+    vc_allocator_free(allocator, stringVectors);
 }
 
-typedef struct {
-    size_t symbolIndex;
-    int file;
-    uint32_t relocWord;
-} FadoRelocInfo;
-
-/* Construct the Zelda64ovl-compatible reloc word from an ELF reloc */
-FadoRelocInfo Fado_MakeReloc(int file, FairySection section, FairyRela* data) {
-    FadoRelocInfo relocInfo = { 0 };
+/* The Zelda64ovl-compatible reloc word of an ELF reloc, relative to the start of the file's section */
+uint32_t Fado_MakeRelocWord(FairySection section, const FairyRela* data) {
     uint32_t sectionPrefix = 0;
 
-    relocInfo.symbolIndex = ELF32_R_SYM(data->r_info);
-    relocInfo.file = file;
-
     switch (section) {
         case FAIRY_SECTION_TEXT:
             sectionPrefix = 1;
@@ -98,13 +96,10 @@ FadoRelocInfo Fado_MakeReloc(int file, FairySection section, FairyRela* data) {
             fprintf(stderr, "warning: Relocation section is invalid.\n");
             break;
     }
-    relocInfo.relocWord =
-        ((sectionPrefix & 3) << 0x1E) | (ELF32_R_TYPE(data->r_info) << 0x18) | (data->r_offset & 0xFFFFFF);
-
-    return relocInfo;
+    return ((sectionPrefix & 3) << 0x1E) | (ELF32_R_TYPE(data->r_info) << 0x18) | (data->r_offset & 0xFFFFFF);
 }
 
-static const FairyDefineString relSectionNames[] = {
+const FairyDefineString relSectionNames[] = {
     FAIRY_DEF_STRING(FAIRY_SECTION_, TEXT),
     FAIRY_DEF_STRING(FAIRY_SECTION_, DATA),
     FAIRY_DEF_STRING(FAIRY_SECTION_, RODATA),
@@ -112,7 +107,7 @@ static const FairyDefineString relSectionNames[] = {
 };
 
 /* Taken from elf.h/mips_elf.h */
-static const FairyDefineString relTypeNames[] = {
+const FairyDefineString relTypeNames[] = {
     FAIRY_DEF_STRING(, R_MIPS_NONE),    /* No reloc */
     FAIRY_DEF_STRING(, R_MIPS_16),      /* Direct 16 bit */
     FAIRY_DEF_STRING(, R_MIPS_32),      /* Direct 32 bit */
@@ -165,133 +160,398 @@ static const FairyDefineString relTypeNames[] = {
     FAIRY_DEF_STRING(, R_MIPS_COPY),
     FAIRY_DEF_STRING(, R_MIPS_JUMP_SLOT),
     FAIRY_DEF_STRING(, R_MIPS_NUM),
+    { 0 },
 };
 
 /**
- * Find all the necessary relocations to retain (those defined in any input file), and print them in the appropriate
- * format.
+ * Size in bytes of the .ovl section for a given number of relocs: the five header words, the relocs, padding to 0x10
+ * alignment, and the final offset word.
  */
-void Fado_Relocs(FILE* outputFile, int inputFilesCount, FILE** inputFiles, const char* ovlName) {
+uint32_t Fado_GetOvlSectionSize(uint32_t relocCount) {
+    return ALIGN(4 * (relocCount + 6), 0x10);
+}
+
+const char* Fado_GetRelocSymbolName(const FadoOverlay* overlay, const FadoRelocInfo* relocInfo) {
+    const FairyFileInfo* fileInfo = &overlay->fileInfos[relocInfo->file];
+
+    return Fairy_GetSymbolName(fileInfo->symtabInfo.sectionData, fileInfo->strtab, relocInfo->symbolIndex);
+}
+
+/**
+ * Read the input files and find all the necessary relocations to retain (those defined in any input file). The results
+ * are stored in the overlay, which must be destroyed with Fado_DestroyOverlay. Files are read with the options of
+ * context (NULL for the defaults), which must outlive the overlay. The overlay's memory is taken from the allocator of
+ * its FadoMemoryCategory (NULL for libc).
+ */
+void Fado_ExtractRelocsWithAllocators(FadoOverlay* overlay, int inputFilesCount, FILE** inputFiles,
+                                      const FairyContext* context,
+                                      const vc_allocator* const allocators[FADO_MEMORY_MAX]) {
     /* General information structs */
-    FairyFileInfo* fileInfos = malloc(inputFilesCount * sizeof(FairyFileInfo));
+    FairyFileInfo* fileInfos =
+        vc_allocator_alloc(allocators[FADO_MEMORY_FILE_INFO], inputFilesCount * sizeof(FairyFileInfo));
+    FadoStats* stats = Fado_StatsOf(context);
+    int currentFile;
+
+    for (currentFile = 0; currentFile < inputFilesCount; currentFile++) {
+        FAIRY_INFO_PRINTF(context, "Begin initialising file %d info.\n", currentFile);
+        Fado_StatsBegin(stats, FADO_PHASE_READ);
+        /* Fairy's categories are the first of fado's */
+        Fairy_InitFileWithAllocators(&fileInfos[currentFile], inputFiles[currentFile], context, allocators);
+        Fado_StatsEndFile(stats, FADO_PHASE_READ, currentFile);
+        Fado_StatsAddBytesRead(stats, fileInfos[currentFile].bytesRead);
+        FAIRY_INFO_PRINTF(context, "Initialising file %d info complete.\n", currentFile);
+    }
+
+    Fado_ExtractRelocsFromFileInfos(overlay, inputFilesCount, fileInfos, context, allocators);
+    overlay->ownsFileInfos = true;
+}
+
+/**
+ * Whether the relocs of the input file with index file against its symbol symbolIndex are kept: those against a symbol
+ * it defines, or one that definedElsewhere finds in another file. The answer is remembered in symbolsKept, which has a
+ * FadoSymbolKept for each of the file's symbols and must be cleared to FADO_SYMBOL_UNKNOWN for each file, so that the
+ * other files are only searched at the first reloc against a symbol. A symbolIndex outside the symtab is not kept.
+ */
+bool Fado_IsSymbolKept(uint8_t* symbolsKept, const FairyFileInfo* fileInfo, int file, size_t symbolIndex,
+                       FadoDefinedElsewhereFunc definedElsewhere, const void* data) {
+    const FairySym* symtab = fileInfo->symtabInfo.sectionData;
+
+    if (symbolIndex >= fileInfo->symtabInfo.sectionEntryCount) {
+        fprintf(stderr, "warning: Reloc refers to symbol %zu, which is not in the symbol table.\n", symbolIndex);
+        return false;
+    }
+    if (symbolsKept[symbolIndex] == FADO_SYMBOL_UNKNOWN) {
+        bool kept = (symtab[symbolIndex].st_shndx != STN_UNDEF) ||
+                    definedElsewhere(&fileInfo->strtab[symtab[symbolIndex].st_name], file, data);
+
+        symbolsKept[symbolIndex] = kept ? FADO_SYMBOL_KEPT : FADO_SYMBOL_DROPPED;
+    }
+    return symbolsKept[symbolIndex] == FADO_SYMBOL_KEPT;
+}
+
+/* What Fado_ExtractRelocsFromFileInfos looks other files' symbols up in */
+typedef struct {
+    const FairyContext* context;
+    vc_vector_str* stringVectors;
+    int inputFilesCount;
+} FadoStringVectorsLookup;
 
-    /* Symbol tables for each file */
-    FairySym** symtabs = malloc(inputFilesCount * sizeof(FairySym*));
+static bool Fado_DefinedInStringVectors(const char* name, int file, const void* data) {
+    const FadoStringVectorsLookup* lookup = data;
 
+    return Fado_FindSymbolNameInOtherFiles(lookup->context, name, file, lookup->stringVectors,
+                                           lookup->inputFilesCount);
+}
+
+/**
+ * As Fado_ExtractRelocsWithAllocators, from input files already read into fileInfos. The overlay only borrows them, so
+ * they can be kept when it is destroyed and reused for another, e.g. after only some of the files have changed.
+ */
+void Fado_ExtractRelocsFromFileInfos(FadoOverlay* overlay, int inputFilesCount, FairyFileInfo* fileInfos,
+                                     const FairyContext* context,
+                                     const vc_allocator* const allocators[FADO_MEMORY_MAX]) {
     /* Lists of names of symbols defined in files of the overlay */
-    vc_vector** stringVectors = malloc(inputFilesCount * sizeof(vc_vector*));
+    vc_vector_str* stringVectors =
+        vc_allocator_alloc(allocators[FADO_MEMORY_STRING_VECTORS], inputFilesCount * sizeof(vc_vector_str));
 
-    /* The relocs in the format we will print */
-    vc_vector* relocList[FAIRY_SECTION_OTHER]; /* Maximum number of reloc sections */
+    /* Whether relocs against each symbol of the current file are kept, worked out at the first one */
+    uint8_t* symbolsKept;
+    size_t maxSymbolCount = 0;
+    FadoStringVectorsLookup lookup;
 
     /* Offset of current file's current section into the overlay's whole section */
     uint32_t sectionOffset[FAIRY_SECTION_OTHER] = { 0 };
 
-    /* Total number of relocs */
-    uint32_t relocCount = 0;
+    /* Number of relocs in the inputs, kept or not */
+    uint32_t inputRelocCount = 0;
+
+    FadoStats* stats = Fado_StatsOf(context);
 
     /* iterators */
     int currentFile;
     FairySection section;
     size_t relocIndex;
+    size_t i;
 
-    for (currentFile = 0; currentFile < inputFilesCount; currentFile++) {
-        FAIRY_INFO_PRINTF("Begin initialising file %d info.\n", currentFile);
-        Fairy_InitFile(&fileInfos[currentFile], inputFiles[currentFile]);
-        FAIRY_INFO_PRINTF("Initialising file %d info complete.\n", currentFile);
+    for (i = 0; i < FADO_MEMORY_MAX; i++) {
+        overlay->allocators[i] = allocators[i];
+    }
+    overlay->context = context;
+    overlay->inputFilesCount = inputFilesCount;
+    overlay->fileInfos = fileInfos;
+    overlay->ownsFileInfos = false;
+    overlay->relocCount = 0;
+    overlay->bssSize = 0;
 
-        symtabs[currentFile] = fileInfos[currentFile].symtabInfo.sectionData;
+    for (currentFile = 0; currentFile < inputFilesCount; currentFile++) {
+        overlay->bssSize += fileInfos[currentFile].bssSize;
+        if (fileInfos[currentFile].symtabInfo.sectionEntryCount > maxSymbolCount) {
+            maxSymbolCount = fileInfos[currentFile].symtabInfo.sectionEntryCount;
+        }
     }
+    symbolsKept = vc_allocator_alloc(allocators[FADO_MEMORY_FILE_INFO], maxSymbolCount + 1);
 
-    Fado_ConstructStringVectors(stringVectors, fileInfos, inputFilesCount);
-    FAIRY_INFO_PRINTF("%s", "symtabs set\n");
+    Fado_StatsBegin(stats, FADO_PHASE_STRINGS);
+    Fado_ConstructStringVectors(stringVectors, fileInfos, inputFilesCount, allocators[FADO_MEMORY_STRING_VECTORS]);
+    Fado_StatsEnd(stats, FADO_PHASE_STRINGS);
+    FAIRY_INFO_PRINTF(context, "%s", "symtabs set\n");
+    lookup.context = context;
+    lookup.stringVectors = stringVectors;
+    lookup.inputFilesCount = inputFilesCount;
 
-    /* Construct relocList of all relevant relocs */
+    /* Every reloc in the inputs is an upper bound for the retained ones, so the lists are never reallocated */
     for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
-        relocList[section] = vc_vector_create(0x100, sizeof(FadoRelocInfo), NULL);
+        size_t maxRelocCount = 0;
 
         for (currentFile = 0; currentFile < inputFilesCount; currentFile++) {
-            FairyRela* relSection = fileInfos[currentFile].relocTablesInfo[section].sectionData;
+            maxRelocCount += fileInfos[currentFile].relocTablesInfo[section].sectionEntryCount;
+        }
+        assert(vc_vector_FadoRelocInfo_init_with_allocator(&overlay->relocList[section], maxRelocCount,
+                                                           allocators[FADO_MEMORY_OUTPUT]));
+        inputRelocCount += maxRelocCount;
+    }
+
+    /*
+     * Construct relocList of all relevant relocs. Each file's reloc tables are all done together, so that its symtab
+     * and strtab are only brought into cache once, and each section's list still ends up in file order.
+     */
+    for (currentFile = 0; currentFile < inputFilesCount; currentFile++) {
+        memset(symbolsKept, FADO_SYMBOL_UNKNOWN, fileInfos[currentFile].symtabInfo.sectionEntryCount);
+
+        for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+            const FairyRela* relSection = fileInfos[currentFile].relocTablesInfo[section].sectionData;
+            size_t relocCount = fileInfos[currentFile].relocTablesInfo[section].sectionEntryCount;
+            vc_vector_FadoRelocInfo* relocList = &overlay->relocList[section];
+            /* Written in place, since the list has room for all of them */
+            FadoRelocInfo* nextReloc = &relocList->data[relocList->count];
 
+            Fado_StatsBegin(stats, FADO_PHASE_FILTER);
             if (relSection != NULL) {
-                for (relocIndex = 0; relocIndex < fileInfos[currentFile].relocTablesInfo[section].sectionEntryCount;
-                     relocIndex++) {
-                    FadoRelocInfo currentReloc = Fado_MakeReloc(currentFile, section, &relSection[relocIndex]);
-
-                    if ((symtabs[currentFile][currentReloc.symbolIndex].st_shndx != STN_UNDEF) ||
-                        Fado_FindSymbolNameInOtherFiles(
-                            &fileInfos[currentFile].strtab[symtabs[currentFile][currentReloc.symbolIndex].st_name],
-                            currentFile, stringVectors, inputFilesCount)) {
-
-                        currentReloc.relocWord += sectionOffset[section];
-                        FAIRY_DEBUG_PRINTF("current section offset: %d\n", sectionOffset[section]);
-                        vc_vector_push_back(relocList[section], &currentReloc);
-                        relocCount++;
+                for (relocIndex = 0; relocIndex < relocCount; relocIndex++) {
+                    size_t symbolIndex = ELF32_R_SYM(relSection[relocIndex].r_info);
+
+                    if (Fado_IsSymbolKept(symbolsKept, &fileInfos[currentFile], currentFile, symbolIndex,
+                                          Fado_DefinedInStringVectors, &lookup)) {
+                        nextReloc->symbolIndex = symbolIndex;
+                        nextReloc->file = currentFile;
+                        nextReloc->relocWord =
+                            Fado_MakeRelocWord(section, &relSection[relocIndex]) + sectionOffset[section];
+                        nextReloc++;
                     }
                 }
+                overlay->relocCount += nextReloc - &relocList->data[relocList->count];
+                relocList->count = nextReloc - relocList->data;
             } else {
-                FAIRY_INFO_PRINTF("%s", "Ignoring empty reloc section\n");
+                FAIRY_INFO_PRINTF(context, "%s", "Ignoring empty reloc section\n");
             }
 
             sectionOffset[section] += fileInfos[currentFile].progBitsSizes[section];
-            FAIRY_INFO_PRINTF("section offset: %d\n", sectionOffset[section]);
+            FAIRY_INFO_PRINTF(context, "section offset: %d\n", sectionOffset[section]);
+            Fado_StatsEndSection(stats, FADO_PHASE_FILTER, currentFile, section);
         }
     }
 
-    {
-        /* Write header */
-        fprintf(outputFile, ".section .ovl, \"a\"\n");
-        fprintf(outputFile, "# %sOverlayInfo\n", ovlName);
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        overlay->sectionSizes[section] = sectionOffset[section];
+    }
+    Fado_StatsSetRelocCounts(stats, overlay->relocCount, inputRelocCount - overlay->relocCount);
+
+    Fado_StatsBegin(stats, FADO_PHASE_TEARDOWN);
+    Fado_DestroyStringVectors(stringVectors, inputFilesCount, allocators[FADO_MEMORY_STRING_VECTORS]);
+    FAIRY_INFO_PRINTF(context, "%s", "Freed string vectors\n");
+    vc_allocator_free(allocators[FADO_MEMORY_FILE_INFO], symbolsKept);
+    Fado_StatsEnd(stats, FADO_PHASE_TEARDOWN);
+}
+
+/**
+ * As Fado_ExtractRelocsWithAllocators with the default options, taking all of the overlay's memory from allocator (NULL
+ * for libc)
+ */
+void Fado_ExtractRelocsWithAllocator(FadoOverlay* overlay, int inputFilesCount, FILE** inputFiles,
+                                     const vc_allocator* allocator) {
+    const vc_allocator* allocators[FADO_MEMORY_MAX];
+    size_t i;
+
+    for (i = 0; i < FADO_MEMORY_MAX; i++) {
+        allocators[i] = allocator;
+    }
+    Fado_ExtractRelocsWithAllocators(overlay, inputFilesCount, inputFiles, NULL, allocators);
+}
+
+void Fado_ExtractRelocs(FadoOverlay* overlay, int inputFilesCount, FILE** inputFiles) {
+    Fado_ExtractRelocsWithAllocator(overlay, inputFilesCount, inputFiles, NULL);
+}
+
+/**
+ * As Fado_ExtractRelocsWithAllocators, reading the objects from the inputFilesCount buffers instead of files. Nothing
+ * in the overlay points into the buffers, so they may be freed as soon as this returns. Returns false, with the
+ * overlay left empty, if the buffers cannot be opened.
+ */
+bool Fado_ExtractRelocsFromBuffers(FadoOverlay* overlay, int inputFilesCount, const void* const inputBuffers[],
+                                   const size_t inputSizes[], const FairyContext* context,
+                                   const vc_allocator* const allocators[FADO_MEMORY_MAX]) {
+    FILE** inputFiles = vc_allocator_alloc(allocators[FADO_MEMORY_FILE_INFO], inputFilesCount * sizeof(FILE*));
+    bool success = (inputFiles != NULL);
+    int opened;
+
+    for (opened = 0; success && (opened < inputFilesCount); opened++) {
+        /* Only ever read, so the cast is safe */
+        inputFiles[opened] = fmemopen((void*)inputBuffers[opened], inputSizes[opened], "rb");
+        if (inputFiles[opened] == NULL) {
+            success = false;
+            break;
+        }
+    }
+
+    if (success) {
+        Fado_ExtractRelocsWithAllocators(overlay, inputFilesCount, inputFiles, context, allocators);
+    } else {
+        memset(overlay, 0, sizeof(*overlay));
+    }
+
+    while (opened-- > 0) {
+        fclose(inputFiles[opened]);
+    }
+    vc_allocator_free(allocators[FADO_MEMORY_FILE_INFO], inputFiles);
+    return success;
+}
+
+/**
+ * The parts of the output of Fado_WriteRelocs, for writing the same from relocs that are not in a FadoOverlay: the
+ * header, the heading of each section with relocs, each reloc, and the padding and offset word at the end.
+ */
+void Fado_WriteRelocsHeader(FILE* outputFile, const uint32_t sectionSizes[FAIRY_SECTION_OTHER], uint32_t bssSize,
+                            uint32_t relocCount, const char* ovlName, bool literalSizes) {
+    fprintf(outputFile, ".section .ovl, \"a\"\n");
+    fprintf(outputFile, "# %sOverlayInfo\n", ovlName);
+    if (literalSizes) {
+        /* Sizes from the objects, so the section does not depend on the linker script */
+        fprintf(outputFile, ".word 0x%08X # _%sSegmentTextSize\n", sectionSizes[FAIRY_SECTION_TEXT], ovlName);
+        fprintf(outputFile, ".word 0x%08X # _%sSegmentDataSize\n", sectionSizes[FAIRY_SECTION_DATA], ovlName);
+        fprintf(outputFile, ".word 0x%08X # _%sSegmentRoDataSize\n", sectionSizes[FAIRY_SECTION_RODATA], ovlName);
+        fprintf(outputFile, ".word 0x%08X # _%sSegmentBssSize\n", bssSize, ovlName);
+    } else {
         fprintf(outputFile, ".word _%sSegmentTextSize\n", ovlName);
         fprintf(outputFile, ".word _%sSegmentDataSize\n", ovlName);
         fprintf(outputFile, ".word _%sSegmentRoDataSize\n", ovlName);
         fprintf(outputFile, ".word _%sSegmentBssSize\n", ovlName);
+    }
 
-        fprintf(outputFile, "\n.word %d # relocCount\n", relocCount);
+    fprintf(outputFile, "\n.word %d # relocCount\n", relocCount);
+}
 
-        /* Write reloc table */
-        for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
-            if (vc_vector_count(relocList[section]) == 0) {
-                FAIRY_INFO_PRINTF("%s", "Ignoring empty reloc section\n");
-                continue;
-            }
+void Fado_WriteRelocsSectionHeader(FILE* outputFile, FairySection section) {
+    fprintf(outputFile, "\n# %s RELOCS\n", Fairy_StringFromDefine(relSectionNames, section));
+}
 
-            fprintf(outputFile, "\n# %s RELOCS\n", Fairy_StringFromDefine(relSectionNames, section));
+void Fado_WriteReloc(FILE* outputFile, uint32_t relocWord, const char* symbolName) {
+    fprintf(outputFile, ".word 0x%X # %-11s 0x%06X %s\n", relocWord,
+            Fairy_StringFromDefine(relTypeNames, (relocWord >> 0x18) & 0x3F), relocWord & 0xFFFFFF, symbolName);
+}
 
-            {
-                FadoRelocInfo* currentReloc;
-                VC_FOREACH(currentReloc, relocList[section]) {
-                    fprintf(outputFile, ".word 0x%X # %-11s 0x%06X %s\n", currentReloc->relocWord,
-                            Fairy_StringFromDefine(relTypeNames, (currentReloc->relocWord >> 0x18) & 0x3F),
-                            currentReloc->relocWord & 0xFFFFFF,
-                            Fairy_GetSymbolName(symtabs[currentReloc->file], fileInfos[currentReloc->file].strtab,
-                                                currentReloc->symbolIndex));
-                }
-            }
+void Fado_WriteRelocsFooter(FILE* outputFile, uint32_t relocCount, const char* ovlName) {
+    /* print pads and section size */
+    for (relocCount += 5; ((relocCount + 1) & 3) != 0; relocCount++) {
+        fprintf(outputFile, ".word 0\n");
+    }
+    fprintf(outputFile, "\n.word 0x%08X # %sOverlayInfoOffset\n", 4 * (relocCount + 1), ovlName);
+}
+
+/**
+ * Print the relocations found by Fado_ExtractRelocs in the format of a Zelda64 .ovl section
+ */
+void Fado_WriteRelocs(FILE* outputFile, const FadoOverlay* overlay, const char* ovlName, bool literalSizes) {
+    FairySection section;
+
+    Fado_StatsBegin(Fado_StatsOf(overlay->context), FADO_PHASE_OUTPUT);
+
+    Fado_WriteRelocsHeader(outputFile, overlay->sectionSizes, overlay->bssSize, overlay->relocCount, ovlName,
+                           literalSizes);
+
+    /* Write reloc table */
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        FadoRelocInfo* currentReloc;
+
+        if (vc_vector_FadoRelocInfo_count(&overlay->relocList[section]) == 0) {
+            FAIRY_INFO_PRINTF(overlay->context, "%s", "Ignoring empty reloc section\n");
+            continue;
         }
 
-        /* print pads and section size */
-        for (relocCount += 5; ((relocCount + 1) & 3) != 0; relocCount++) {
-            fprintf(outputFile, ".word 0\n");
+        Fado_WriteRelocsSectionHeader(outputFile, section);
+        VC_VECTOR_TYPED_FOREACH(currentReloc, &overlay->relocList[section]) {
+            Fado_WriteReloc(outputFile, currentReloc->relocWord, Fado_GetRelocSymbolName(overlay, currentReloc));
         }
-        fprintf(outputFile, "\n.word 0x%08X # %sOverlayInfoOffset\n", 4 * (relocCount + 1), ovlName);
     }
 
-    for (currentFile = 0; currentFile < inputFilesCount; currentFile++) {
-        Fairy_DestroyFile(&fileInfos[currentFile]);
-        FAIRY_INFO_PRINTF("Freed file %d\n", currentFile);
+    Fado_WriteRelocsFooter(outputFile, overlay->relocCount, ovlName);
+
+    Fado_StatsEnd(Fado_StatsOf(overlay->context), FADO_PHASE_OUTPUT);
+}
+
+/**
+ * Write the overlay's .ovl section as it will appear in the overlay binary, big-endian, into buffer, which must have
+ * room for Fado_GetOvlSectionSize(overlay->relocCount) bytes. The header has the section sizes from the objects, as
+ * with the literalSizes option of Fado_WriteRelocs.
+ */
+void Fado_WriteOvlSection(uint8_t* buffer, const FadoOverlay* overlay) {
+    uint32_t sectionSize = Fado_GetOvlSectionSize(overlay->relocCount);
+    uint8_t* word = buffer;
+    FairySection section;
+
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        Z64Ovl_WriteWord(word, overlay->sectionSizes[section]);
+        word += 4;
     }
+    Z64Ovl_WriteWord(word, overlay->bssSize);
+    word += 4;
+    Z64Ovl_WriteWord(word, overlay->relocCount);
+    word += 4;
 
     for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
-        if (relocList[section] != NULL) {
-            vc_vector_release(relocList[section]);
+        FadoRelocInfo* currentReloc;
+
+        VC_VECTOR_TYPED_FOREACH(currentReloc, &overlay->relocList[section]) {
+            Z64Ovl_WriteWord(word, currentReloc->relocWord);
+            word += 4;
         }
-        FAIRY_INFO_PRINTF("Freed relocList[%d]\n", section);
     }
 
-    Fado_DestroyStringVectors(stringVectors, inputFilesCount);
-    FAIRY_INFO_PRINTF("%s", "Freed string vectors\n");
-    free(symtabs);
-    FAIRY_INFO_PRINTF("%s", "Freed symtabs\n");
-    free(fileInfos);
+    /* Padding, then the offset of the header from the end */
+    memset(word, 0, buffer + sectionSize - 4 - word);
+    Z64Ovl_WriteWord(buffer + sectionSize - 4, sectionSize);
+}
+
+void Fado_DestroyOverlay(FadoOverlay* overlay) {
+    int currentFile;
+    FairySection section;
+
+    Fado_StatsBegin(Fado_StatsOf(overlay->context), FADO_PHASE_TEARDOWN);
+
+    for (currentFile = 0; overlay->ownsFileInfos && (currentFile < overlay->inputFilesCount); currentFile++) {
+        Fairy_DestroyFile(&overlay->fileInfos[currentFile]);
+        FAIRY_INFO_PRINTF(overlay->context, "Freed file %d\n", currentFile);
+    }
+
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        vc_vector_FadoRelocInfo_release(&overlay->relocList[section]);
+        FAIRY_INFO_PRINTF(overlay->context, "Freed relocList[%d]\n", section);
+    }
+
+    if (overlay->ownsFileInfos) {
+        vc_allocator_free(overlay->allocators[FADO_MEMORY_FILE_INFO], overlay->fileInfos);
+    }
+
+    Fado_StatsEnd(Fado_StatsOf(overlay->context), FADO_PHASE_TEARDOWN);
+}
+
+/**
+ * Find all the necessary relocations to retain (those defined in any input file), and print them in the appropriate
+ * format.
+ */
+void Fado_Relocs(FILE* outputFile, int inputFilesCount, FILE** inputFiles, const char* ovlName) {
+    FadoOverlay overlay;
+
+    Fado_ExtractRelocs(&overlay, inputFilesCount, inputFiles);
+    Fado_WriteRelocs(outputFile, &overlay, ovlName, false);
+    Fado_DestroyOverlay(&overlay);
 }
@@ -0,0 +1,267 @@
+/**
+ * Reading the members of ar archives (static libraries) in place, so they can be inputs without being extracted first
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* fmemopen, strndup */
+#include "fado_archive.h"
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mips_elf.h"
+
+#define AR_MAGIC "!<arch>\n"
+#define AR_MAGIC_SIZE 8
+#define AR_THIN_MAGIC "!<thin>\n"
+
+/* The fixed-width ASCII fields of a member header */
+#define AR_HEADER_SIZE 60
+#define AR_NAME_SIZE 16
+#define AR_SIZE_OFFSET 48
+#define AR_SIZE_SIZE 10
+#define AR_END_OFFSET 58
+#define AR_END "`\n"
+
+/* A BSD member's name is the first LENGTH bytes of its data, after its header */
+#define AR_BSD_NAME_PREFIX "#1/"
+
+static size_t Fado_ArchiveParseDecimal(const unsigned char* field, size_t width, bool* valid) {
+    size_t value = 0;
+    size_t i;
+
+    *valid = false;
+    for (i = 0; (i < width) && (field[i] >= '0') && (field[i] <= '9'); i++) {
+        value = 10 * value + (field[i] - '0');
+        *valid = true;
+    }
+    for (; i < width; i++) {
+        if (field[i] != ' ') {
+            *valid = false;
+        }
+    }
+    return value;
+}
+
+static bool Fado_ArchiveError(const FadoArchive* archive, size_t offset, const char* message) {
+    fprintf(stderr, "error: %s: member at offset 0x%zX: %s\n", archive->fileName, offset, message);
+    return false;
+}
+
+/**
+ * Read the name of the member whose header is at headerOffset, adjusting its data for a BSD name. Returns NULL for the
+ * archive's own tables (the symbol index and the GNU long name table), which are not members.
+ */
+static char* Fado_ArchiveReadName(const FadoArchive* archive, size_t headerOffset, FadoArchiveMember* member,
+                                  const char* longNames, size_t longNamesSize, bool* valid) {
+    const char* field = (const char*)&archive->data[headerOffset];
+    size_t length;
+    bool numberValid;
+    char* name;
+
+    *valid = true;
+    if (strncmp(field, AR_BSD_NAME_PREFIX, strlen(AR_BSD_NAME_PREFIX)) == 0) {
+        length = Fado_ArchiveParseDecimal((const unsigned char*)field + strlen(AR_BSD_NAME_PREFIX),
+                                          AR_NAME_SIZE - strlen(AR_BSD_NAME_PREFIX), &numberValid);
+        if (!numberValid || (length > member->size)) {
+            *valid = Fado_ArchiveError(archive, headerOffset, "bad BSD name length");
+            return NULL;
+        }
+        field = (const char*)&archive->data[member->offset];
+        member->offset += length;
+        member->size -= length;
+        name = strndup(field, strnlen(field, length));
+        /* BSD's symbol index */
+        if ((strcmp(name, "__.SYMDEF") == 0) || (strcmp(name, "__.SYMDEF SORTED") == 0)) {
+            free(name);
+            return NULL;
+        }
+        return name;
+    }
+
+    if (field[0] == '/') {
+        size_t nameOffset;
+        const char* end;
+
+        /* GNU's symbol indexes and long name table */
+        if ((field[1] == ' ') || (field[1] == '/') || (strncmp(field, "/SYM64/", 7) == 0)) {
+            return NULL;
+        }
+        nameOffset = Fado_ArchiveParseDecimal((const unsigned char*)field + 1, AR_NAME_SIZE - 1, &numberValid);
+        if (!numberValid || (nameOffset >= longNamesSize)) {
+            *valid = Fado_ArchiveError(archive, headerOffset, "bad long name offset");
+            return NULL;
+        }
+        end = memchr(&longNames[nameOffset], '\n', longNamesSize - nameOffset);
+        length = ((end == NULL) ? longNamesSize : (size_t)(end - longNames)) - nameOffset;
+        /* Names end with a '/' in GNU archives */
+        if ((length != 0) && (longNames[nameOffset + length - 1] == '/')) {
+            length--;
+        }
+        return strndup(&longNames[nameOffset], length);
+    }
+
+    /* A short name, ended by '/' in GNU archives and padded with spaces */
+    for (length = 0; (length < AR_NAME_SIZE) && (field[length] != '/'); length++) {}
+    while ((length > 0) && (field[length - 1] == ' ')) {
+        length--;
+    }
+    return strndup(field, length);
+}
+
+static bool Fado_ArchiveReadMembers(FadoArchive* archive) {
+    const char* longNames = NULL;
+    size_t longNamesSize = 0;
+    size_t offset = AR_MAGIC_SIZE;
+
+    while (offset + AR_HEADER_SIZE <= archive->size) {
+        const unsigned char* header = &archive->data[offset];
+        FadoArchiveMember member;
+        size_t dataSize;
+        bool valid;
+
+        if (memcmp(&header[AR_END_OFFSET], AR_END, strlen(AR_END)) != 0) {
+            return Fado_ArchiveError(archive, offset, "bad member header");
+        }
+        member.offset = offset + AR_HEADER_SIZE;
+        dataSize = Fado_ArchiveParseDecimal(&header[AR_SIZE_OFFSET], AR_SIZE_SIZE, &valid);
+        if (!valid || (dataSize > archive->size - member.offset)) {
+            return Fado_ArchiveError(archive, offset, "bad member size");
+        }
+        member.size = dataSize;
+
+        if (memcmp(header, "// ", 3) == 0) {
+            longNames = (const char*)&archive->data[member.offset];
+            longNamesSize = member.size;
+            member.name = NULL;
+        } else {
+            member.name = Fado_ArchiveReadName(archive, offset, &member, longNames, longNamesSize, &valid);
+            if (!valid) {
+                return false;
+            }
+        }
+        if (member.name != NULL) {
+            vc_vector_FadoArchiveMember_push_back(&archive->members, member);
+        }
+
+        /* Members are aligned to 2 bytes */
+        offset += AR_HEADER_SIZE + dataSize;
+        offset += offset & 1;
+    }
+    return true;
+}
+
+/**
+ * Map the archive fileName into memory and read its list of members. Only archives with the members' data in them are
+ * supported, not thin ones. Returns false, with an error printed, if it cannot be read.
+ */
+bool Fado_ArchiveOpen(FadoArchive* archive, const char* fileName) {
+    int fd = open(fileName, O_RDONLY);
+    struct stat fileStat;
+    void* mapping;
+
+    archive->fileName = fileName;
+    archive->data = NULL;
+    archive->size = 0;
+
+    if ((fd < 0) || (fstat(fd, &fileStat) != 0)) {
+        fprintf(stderr, "error: unable to open archive '%s' for reading\n", fileName);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    archive->size = fileStat.st_size;
+    mapping = (archive->size == 0) ? MAP_FAILED : mmap(NULL, archive->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        fprintf(stderr, "error: unable to map archive '%s'\n", fileName);
+        archive->size = 0;
+        return false;
+    }
+    archive->data = mapping;
+    vc_vector_FadoArchiveMember_init(&archive->members, 0);
+
+    if ((archive->size < AR_MAGIC_SIZE) || (memcmp(archive->data, AR_MAGIC, AR_MAGIC_SIZE) != 0)) {
+        if ((archive->size >= AR_MAGIC_SIZE) && (memcmp(archive->data, AR_THIN_MAGIC, AR_MAGIC_SIZE) == 0)) {
+            fprintf(stderr, "error: '%s' is a thin archive, which is not supported\n", fileName);
+        } else {
+            fprintf(stderr, "error: '%s' is not an ar archive\n", fileName);
+        }
+        Fado_ArchiveClose(archive);
+        return false;
+    }
+    if (!Fado_ArchiveReadMembers(archive)) {
+        Fado_ArchiveClose(archive);
+        return false;
+    }
+    return true;
+}
+
+void Fado_ArchiveClose(FadoArchive* archive) {
+    FadoArchiveMember* member;
+
+    VC_VECTOR_TYPED_FOREACH(member, &archive->members) {
+        free(member->name);
+    }
+    vc_vector_FadoArchiveMember_release(&archive->members);
+    if (archive->data != NULL) {
+        munmap((void*)archive->data, archive->size);
+        archive->data = NULL;
+    }
+}
+
+/**
+ * The first member called name, or NULL if there is none
+ */
+const FadoArchiveMember* Fado_ArchiveFindMember(const FadoArchive* archive, const char* name) {
+    const FadoArchiveMember* member;
+
+    VC_VECTOR_TYPED_FOREACH(member, &archive->members) {
+        if (strcmp(member->name, name) == 0) {
+            return member;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Whether the member is an ELF file, rather than e.g. a text file some tools add to libraries
+ */
+bool Fado_ArchiveMemberIsObject(const FadoArchive* archive, const FadoArchiveMember* member) {
+    return (member->size >= SELFMAG) && (memcmp(&archive->data[member->offset], ELFMAG, SELFMAG) == 0);
+}
+
+/**
+ * Open the member's data, in the archive's mapping, for reading. The archive must stay open until it is closed.
+ */
+FILE* Fado_ArchiveOpenMember(const FadoArchive* archive, const FadoArchiveMember* member) {
+    /* Only ever read, so the cast is safe */
+    return fmemopen((void*)&archive->data[member->offset], member->size, "rb");
+}
+
+/**
+ * If input names an archive, "libfoo.a", or a member of one, "libfoo.a(member.o)", returns the archive's file name, to
+ * be freed, and sets *memberNameOut to the member's name, to be freed, or NULL for all of them. Returns NULL for other
+ * inputs.
+ */
+char* Fado_ArchiveSplitInput(const char* input, char** memberNameOut) {
+    size_t length = strlen(input);
+    const char* open = strchr(input, '(');
+
+    *memberNameOut = NULL;
+    if ((open != NULL) && (open != input) && (length > 2) && (input[length - 1] == ')') &&
+        (open < &input[length - 2])) {
+        *memberNameOut = strndup(open + 1, &input[length - 1] - (open + 1));
+        return strndup(input, open - input);
+    }
+    if ((length > 2) && (strcmp(&input[length - 2], ".a") == 0)) {
+        return strndup(input, length);
+    }
+    return NULL;
+}
@@ -0,0 +1,128 @@
+/**
+ * Estimating how long the games' overlay loader will spend on an overlay's relocations
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include "fado_cost.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fado.h"
+#include "fairy/fairy.h"
+#include "macros.h"
+#include "z64ovl/z64ovl.h"
+
+/**
+ * Very approximate VR4300 cycle costs of the loader loop (Overlay_Relocate/DoRelocation), from counting the
+ * instructions in the compiled loop and assuming every data cache miss costs a full line fill from RDRAM. They are only
+ * intended to rank overlays against each other, not to predict absolute load times.
+ */
+#define COST_LOOP_CYCLES 10         /* Fetching and decoding the reloc, computing the address, the switch */
+#define COST_R_MIPS_32_CYCLES 6     /* Check, subtract, add, store */
+#define COST_R_MIPS_26_CYCLES 9     /* Extract target, subtract, add, mask, shift, merge, store */
+#define COST_R_MIPS_HI16_CYCLES 5   /* Store the pointer and value in the register-indexed arrays */
+#define COST_R_MIPS_LO16_CYCLES 20  /* Fetch the HI, combine, check, relocate, carry, two merges, two stores */
+#define COST_LINE_MISS_CYCLES 40    /* Data cache line fill from RDRAM */
+#define COST_LINE_SIZE 0x10         /* VR4300 data cache line size */
+#define COST_DMA_CYCLES_PER_BYTE 18 /* Reading the table from the cartridge over the PI, ~5MB/s at 93.75MHz */
+#define COST_CPU_MHZ 93.75
+
+static int Fado_CompareWords(const void* a, const void* b) {
+    uint32_t wordA = *(const uint32_t*)a;
+    uint32_t wordB = *(const uint32_t*)b;
+
+    return (wordA > wordB) - (wordA < wordB);
+}
+
+/**
+ * Count the relocs in the overlay by type and section, and estimate the cycles the loader will take to relocate it
+ */
+void Fado_EstimateLoadCost(FadoLoadCost* cost, const FadoOverlay* overlay) {
+    static const uint32_t typeCycles[] = {
+        COST_R_MIPS_32_CYCLES,
+        COST_R_MIPS_26_CYCLES,
+        COST_R_MIPS_HI16_CYCLES,
+        COST_R_MIPS_LO16_CYCLES,
+    };
+    uint32_t* lines = malloc(overlay->relocCount * sizeof(uint32_t));
+    uint32_t lineCount = 0;
+    uint32_t sectionStart = 0;
+    FairySection section;
+    size_t i;
+
+    memset(cost, 0, sizeof(*cost));
+    cost->relocCount = overlay->relocCount;
+    cost->tableSize = Fado_GetOvlSectionSize(overlay->relocCount);
+
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        FadoRelocInfo* relocInfo;
+
+        cost->sectionCounts[section] = vc_vector_FadoRelocInfo_count(&overlay->relocList[section]);
+
+        VC_VECTOR_TYPED_FOREACH(relocInfo, &overlay->relocList[section]) {
+            switch (Z64OVL_RELOC_TYPE(relocInfo->relocWord)) {
+                case R_MIPS_32:
+                    cost->typeCounts[0]++;
+                    break;
+
+                case R_MIPS_26:
+                    cost->typeCounts[1]++;
+                    break;
+
+                case R_MIPS_HI16:
+                    cost->typeCounts[2]++;
+                    break;
+
+                case R_MIPS_LO16:
+                    cost->typeCounts[3]++;
+                    break;
+
+                default:
+                    break;
+            }
+            lines[lineCount++] = (sectionStart + Z64OVL_RELOC_OFFSET(relocInfo->relocWord)) / COST_LINE_SIZE;
+        }
+
+        sectionStart += overlay->sectionSizes[section];
+    }
+
+    /* Each distinct line of the overlay that is relocated misses once */
+    qsort(lines, lineCount, sizeof(uint32_t), Fado_CompareWords);
+    for (i = 0; i < lineCount; i++) {
+        if (i == 0 || lines[i] != lines[i - 1]) {
+            cost->linesTouched++;
+        }
+    }
+    free(lines);
+
+    cost->loopCycles = cost->relocCount * COST_LOOP_CYCLES;
+    for (i = 0; i < ARRAY_COUNTU(typeCycles); i++) {
+        cost->loopCycles += cost->typeCounts[i] * typeCycles[i];
+    }
+    /* The table is read sequentially, the relocated words are not */
+    cost->loopCycles += (ALIGN(4 * cost->relocCount, COST_LINE_SIZE) / COST_LINE_SIZE) * COST_LINE_MISS_CYCLES;
+    cost->loopCycles += cost->linesTouched * COST_LINE_MISS_CYCLES;
+
+    cost->dmaCycles = cost->tableSize * COST_DMA_CYCLES_PER_BYTE;
+}
+
+/**
+ * The report is tab-separated with one line per overlay, so reports from many overlays can be concatenated and then
+ * sorted on any column, e.g. `sort -t$'\t' -k14 -n -r`
+ */
+void Fado_WriteLoadCostHeader(FILE* outputFile) {
+    fprintf(outputFile, "#overlay\trelocs\ttext\tdata\trodata\tR_MIPS_32\tR_MIPS_26\tR_MIPS_HI16\tR_MIPS_LO16\t"
+                        "table_bytes\tlines_touched\tloop_cycles\tdma_cycles\ttotal_cycles\ttotal_us\n");
+}
+
+void Fado_WriteLoadCost(FILE* outputFile, const FadoLoadCost* cost, const char* ovlName) {
+    uint32_t totalCycles = cost->loopCycles + cost->dmaCycles;
+
+    fprintf(outputFile, "%s\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%.1f\n", ovlName, cost->relocCount,
+            cost->sectionCounts[FAIRY_SECTION_TEXT], cost->sectionCounts[FAIRY_SECTION_DATA],
+            cost->sectionCounts[FAIRY_SECTION_RODATA], cost->typeCounts[0], cost->typeCounts[1], cost->typeCounts[2],
+            cost->typeCounts[3], cost->tableSize, cost->linesTouched, cost->loopCycles, cost->dmaCycles, totalCycles,
+            totalCycles / COST_CPU_MHZ);
+}
@@ -0,0 +1,141 @@
+/**
+ * Reporting which symbols are responsible for the most relocs kept in an overlay
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include "fado_hotspots.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fado.h"
+#include "fairy/fairy.h"
+#include "json.h"
+#include "macros.h"
+#include "z64ovl/z64ovl.h"
+
+typedef struct {
+    const char* symbolName;
+    size_t sectionIndex; /* For unnamed section symbols */
+    uint32_t type;
+    int file;
+    size_t count;
+} FadoHotspot;
+
+static int Fado_CompareHotspotKeys(const void* a, const void* b) {
+    const FadoHotspot* hotspotA = a;
+    const FadoHotspot* hotspotB = b;
+    int cmp = strcmp(hotspotA->symbolName, hotspotB->symbolName);
+
+    if (cmp != 0) {
+        return cmp;
+    }
+    if (hotspotA->sectionIndex != hotspotB->sectionIndex) {
+        return (hotspotA->sectionIndex > hotspotB->sectionIndex) ? 1 : -1;
+    }
+    if (hotspotA->type != hotspotB->type) {
+        return (hotspotA->type > hotspotB->type) ? 1 : -1;
+    }
+    return hotspotA->file - hotspotB->file;
+}
+
+/* Most relocs first, then alphabetically for a stable order */
+static int Fado_CompareHotspotCounts(const void* a, const void* b) {
+    const FadoHotspot* hotspotA = a;
+    const FadoHotspot* hotspotB = b;
+
+    if (hotspotA->count != hotspotB->count) {
+        return (hotspotA->count < hotspotB->count) ? 1 : -1;
+    }
+    return Fado_CompareHotspotKeys(a, b);
+}
+
+static const char* Fado_GetHotspotName(char* buf, size_t bufSize, const FadoHotspot* hotspot) {
+    if (hotspot->symbolName[0] != '\0') {
+        return hotspot->symbolName;
+    }
+    snprintf(buf, bufSize, "(section %zu)", hotspot->sectionIndex);
+    return buf;
+}
+
+/**
+ * Aggregate the overlay's relocs by target symbol, type and the object they come from, and print the topCount largest
+ * groups with the number of bytes of the .ovl section they take up, either as text or as JSON.
+ */
+void Fado_WriteHotspots(FILE* outputFile, const FadoOverlay* overlay, const char* ovlName, char** inputFileNames,
+                        size_t topCount, bool json) {
+    FadoHotspot* hotspots = malloc(overlay->relocCount * sizeof(FadoHotspot));
+    size_t hotspotCount = 0;
+    FairySection section;
+    size_t i;
+
+    /* One entry per reloc, then merge identical ones */
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        FadoRelocInfo* relocInfo;
+
+        VC_VECTOR_TYPED_FOREACH(relocInfo, &overlay->relocList[section]) {
+            FairySym* symtab = overlay->fileInfos[relocInfo->file].symtabInfo.sectionData;
+            FadoHotspot* hotspot = &hotspots[hotspotCount++];
+
+            hotspot->symbolName = Fado_GetRelocSymbolName(overlay, relocInfo);
+            hotspot->sectionIndex = symtab[relocInfo->symbolIndex].st_shndx;
+            hotspot->type = Z64OVL_RELOC_TYPE(relocInfo->relocWord);
+            hotspot->file = relocInfo->file;
+            hotspot->count = 1;
+        }
+    }
+
+    qsort(hotspots, hotspotCount, sizeof(FadoHotspot), Fado_CompareHotspotKeys);
+    {
+        size_t merged = 0;
+
+        for (i = 0; i < hotspotCount; i++) {
+            if (merged != 0 && Fado_CompareHotspotKeys(&hotspots[merged - 1], &hotspots[i]) == 0) {
+                hotspots[merged - 1].count++;
+            } else {
+                hotspots[merged++] = hotspots[i];
+            }
+        }
+        hotspotCount = merged;
+    }
+    qsort(hotspots, hotspotCount, sizeof(FadoHotspot), Fado_CompareHotspotCounts);
+
+    if (topCount > hotspotCount) {
+        topCount = hotspotCount;
+    }
+
+    if (json) {
+        fprintf(outputFile, "{\n  \"overlay\": ");
+        Json_WriteString(outputFile, ovlName);
+        fprintf(outputFile, ",\n  \"relocs\": %u,\n  \"bytes\": %u,\n  \"hotspots\": [", overlay->relocCount,
+                4 * overlay->relocCount);
+
+        for (i = 0; i < topCount; i++) {
+            char nameBuf[32];
+
+            fprintf(outputFile, "%s\n    { \"symbol\": ", (i == 0) ? "" : ",");
+            Json_WriteString(outputFile, Fado_GetHotspotName(nameBuf, sizeof(nameBuf), &hotspots[i]));
+            fprintf(outputFile, ", \"type\": \"%s\", \"object\": ",
+                    Fairy_StringFromDefine(relTypeNames, hotspots[i].type));
+            Json_WriteString(outputFile, inputFileNames[hotspots[i].file]);
+            fprintf(outputFile, ", \"count\": %zu, \"bytes\": %zu }", hotspots[i].count, 4 * hotspots[i].count);
+        }
+        fprintf(outputFile, "\n  ]\n}\n");
+    } else {
+        fprintf(outputFile, "# Reloc hotspots in %s: %u relocs, %u bytes of .ovl\n", ovlName, overlay->relocCount,
+                4 * overlay->relocCount);
+        fprintf(outputFile, "%6s %6s  %-11s  %-31s %s\n", "count", "bytes", "type", "symbol", "object");
+
+        for (i = 0; i < topCount; i++) {
+            char nameBuf[32];
+
+            fprintf(outputFile, "%6zu %6zu  %-11s  %-31s %s\n", hotspots[i].count, 4 * hotspots[i].count,
+                    Fairy_StringFromDefine(relTypeNames, hotspots[i].type),
+                    Fado_GetHotspotName(nameBuf, sizeof(nameBuf), &hotspots[i]), inputFileNames[hotspots[i].file]);
+        }
+    }
+
+    free(hotspots);
+}
@@ -0,0 +1,600 @@
+/**
+ * Regenerating the output after some of the input files have changed by reading only those, for --incremental. A
+ * sidecar file records what each input contributed to the output: its section sizes, the names it defines, and the
+ * relocs kept from it, relative to its own sections. A changed file's relocs are worked out again, the later files'
+ * are moved by any change in its section sizes, and the output is put back together from the pieces.
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* getline, open_memstream, strdup, st_mtim */
+#include "fado_incremental.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "fado.h"
+#include "fairy/fairy.h"
+#include "mido.h"
+#include "vc_vector/vc_vector_typed.h"
+
+#define SIDECAR_MAGIC "fado-incremental 1"
+
+typedef struct {
+    uint32_t relocWord; /* Relative to the start of the file's section */
+    char* symbolName;
+} FadoSidecarReloc;
+
+VC_VECTOR_DECLARE(FadoSidecarReloc);
+VC_VECTOR_DECLARE_NAMED(str, char*);
+
+/* Enough to tell that a file has been written since, as make does with less */
+typedef struct {
+    uint64_t device;
+    uint64_t inode;
+    uint64_t size;
+    int64_t mtimeSec;
+    int64_t mtimeNsec;
+} FadoFileStamp;
+
+/* What one input file contributes to the output */
+typedef struct {
+    FadoFileStamp stamp;
+    uint32_t progBitsSizes[FAIRY_SECTION_OTHER];
+    uint32_t bssSize;
+    vc_vector_FadoSidecarReloc relocs[FAIRY_SECTION_OTHER]; /* Kept ones, in output order */
+    vc_vector_str definedNames; /* Sorted, each once, for the other files' undefined symbols to be looked up in */
+} FadoContribution;
+
+static const vc_allocator* const sIncrementalAllocators[FADO_MEMORY_MAX] = { NULL };
+
+static bool Fado_StampFile(FadoFileStamp* stamp, const char* fileName) {
+    struct stat status;
+
+    if (stat(fileName, &status) != 0) {
+        return false;
+    }
+    stamp->device = status.st_dev;
+    stamp->inode = status.st_ino;
+    stamp->size = status.st_size;
+    stamp->mtimeSec = status.st_mtim.tv_sec;
+    stamp->mtimeNsec = status.st_mtim.tv_nsec;
+    return true;
+}
+
+static bool Fado_StampsEqual(const FadoFileStamp* a, const FadoFileStamp* b) {
+    return (a->device == b->device) && (a->inode == b->inode) && (a->size == b->size) &&
+           (a->mtimeSec == b->mtimeSec) && (a->mtimeNsec == b->mtimeNsec);
+}
+
+static void Fado_InitContribution(FadoContribution* contribution) {
+    FairySection section;
+
+    memset(contribution, 0, sizeof(*contribution));
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        vc_vector_FadoSidecarReloc_init(&contribution->relocs[section], 0);
+    }
+    vc_vector_str_init(&contribution->definedNames, 0);
+}
+
+static void Fado_DestroyContribution(FadoContribution* contribution) {
+    FairySection section;
+    FadoSidecarReloc* reloc;
+    char** name;
+
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        VC_VECTOR_TYPED_FOREACH(reloc, &contribution->relocs[section]) {
+            free(reloc->symbolName);
+        }
+        vc_vector_FadoSidecarReloc_release(&contribution->relocs[section]);
+    }
+    VC_VECTOR_TYPED_FOREACH(name, &contribution->definedNames) {
+        free(*name);
+    }
+    vc_vector_str_release(&contribution->definedNames);
+}
+
+static int Fado_CompareNames(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+static bool Fado_ContributionDefines(const FadoContribution* contribution, const char* name) {
+    return bsearch(&name, vc_vector_str_begin(&contribution->definedNames),
+                   vc_vector_str_count(&contribution->definedNames), sizeof(char*), Fado_CompareNames) != NULL;
+}
+
+/**
+ * The sizes and defined names of a file, without its relocs. As in Fado_ConstructStringVectors, every symbol that is
+ * not undefined counts, local or not.
+ */
+static void Fado_ContributionFromFile(FadoContribution* contribution, const FairyFileInfo* fileInfo) {
+    const FairySym* symtab = fileInfo->symtabInfo.sectionData;
+    vc_vector_str* names = &contribution->definedNames;
+    size_t kept = 0;
+    size_t i;
+
+    memcpy(contribution->progBitsSizes, fileInfo->progBitsSizes, sizeof(contribution->progBitsSizes));
+    contribution->bssSize = fileInfo->bssSize;
+
+    for (i = 0; i < fileInfo->symtabInfo.sectionEntryCount; i++) {
+        if (symtab[i].st_shndx != STN_UNDEF) {
+            vc_vector_str_push_back(names, strdup(&fileInfo->strtab[symtab[i].st_name]));
+        }
+    }
+    qsort(vc_vector_str_begin(names), vc_vector_str_count(names), sizeof(char*), Fado_CompareNames);
+    for (i = 0; i < vc_vector_str_count(names); i++) {
+        char* name = *vc_vector_str_at(names, i);
+
+        if ((kept != 0) && (strcmp(name, *vc_vector_str_at(names, kept - 1)) == 0)) {
+            free(name);
+        } else {
+            *vc_vector_str_at(names, kept++) = name;
+        }
+    }
+    names->count = kept;
+}
+
+static bool Fado_ContributionsDefineSame(const FadoContribution* a, const FadoContribution* b) {
+    size_t i;
+
+    if (vc_vector_str_count(&a->definedNames) != vc_vector_str_count(&b->definedNames)) {
+        return false;
+    }
+    for (i = 0; i < vc_vector_str_count(&a->definedNames); i++) {
+        if (strcmp(*vc_vector_str_at(&a->definedNames, i), *vc_vector_str_at(&b->definedNames, i)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* What Fado_ContributionFilterRelocs looks other files' symbols up in */
+typedef struct {
+    const FadoContribution* contributions;
+    int inputFilesCount;
+} FadoContributionsLookup;
+
+static bool Fado_DefinedInContributions(const char* name, int file, const void* data) {
+    const FadoContributionsLookup* lookup = data;
+    int other;
+
+    for (other = 0; other < lookup->inputFilesCount; other++) {
+        if ((other != file) && Fado_ContributionDefines(&lookup->contributions[other], name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Keep the relocs of file that Fado_ExtractRelocsFromFileInfos would, by the same Fado_IsSymbolKept: those against its
+ * own symbols, and against symbols defined by another file
+ */
+static void Fado_ContributionFilterRelocs(FadoContribution* contributions, int inputFilesCount, int file,
+                                          const FairyFileInfo* fileInfo) {
+    const FairySym* symtab = fileInfo->symtabInfo.sectionData;
+    FadoContributionsLookup lookup = { contributions, inputFilesCount };
+    uint8_t* symbolsKept = calloc(fileInfo->symtabInfo.sectionEntryCount + 1, 1); /* All FADO_SYMBOL_UNKNOWN */
+    FairySection section;
+    size_t i;
+
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        const FairyRela* relocs = fileInfo->relocTablesInfo[section].sectionData;
+
+        for (i = 0; (relocs != NULL) && (i < fileInfo->relocTablesInfo[section].sectionEntryCount); i++) {
+            size_t symbolIndex = ELF32_R_SYM(relocs[i].r_info);
+
+            if (Fado_IsSymbolKept(symbolsKept, fileInfo, file, symbolIndex, Fado_DefinedInContributions, &lookup)) {
+                FadoSidecarReloc reloc = { Fado_MakeRelocWord(section, &relocs[i]),
+                                           strdup(&fileInfo->strtab[symtab[symbolIndex].st_name]) };
+
+                vc_vector_FadoSidecarReloc_push_back(&contributions[file].relocs[section], reloc);
+            }
+        }
+    }
+    free(symbolsKept);
+}
+
+/**
+ * Split the relocs of a whole overlay up by the file they came from
+ */
+static void Fado_ContributionsFromOverlay(FadoContribution* contributions, const FadoOverlay* overlay) {
+    FairySection section;
+
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        uint32_t* sectionOffsets = malloc(overlay->inputFilesCount * sizeof(uint32_t));
+        uint32_t sectionOffset = 0;
+        FadoRelocInfo* reloc;
+        int file;
+
+        for (file = 0; file < overlay->inputFilesCount; file++) {
+            sectionOffsets[file] = sectionOffset;
+            sectionOffset += overlay->fileInfos[file].progBitsSizes[section];
+        }
+        VC_VECTOR_TYPED_FOREACH(reloc, &overlay->relocList[section]) {
+            FadoSidecarReloc sidecarReloc = { reloc->relocWord - sectionOffsets[reloc->file],
+                                              strdup(Fado_GetRelocSymbolName(overlay, reloc)) };
+
+            vc_vector_FadoSidecarReloc_push_back(&contributions[reloc->file].relocs[section], sidecarReloc);
+        }
+        free(sectionOffsets);
+    }
+}
+
+/**
+ * Write the output as Fado_WriteRelocs would for the overlay the contributions are from, each file's relocs moved
+ * along by the sizes of the files before it
+ */
+static void Fado_WriteContributions(FILE* stream, const FadoContribution* contributions,
+                                    const FadoIncrementalOptions* options) {
+    uint32_t sectionSizes[FAIRY_SECTION_OTHER] = { 0 };
+    uint32_t relocCounts[FAIRY_SECTION_OTHER] = { 0 };
+    uint32_t bssSize = 0;
+    FairySection section;
+    int file;
+
+    for (file = 0; file < options->inputFilesCount; file++) {
+        for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+            sectionSizes[section] += contributions[file].progBitsSizes[section];
+            relocCounts[section] += vc_vector_FadoSidecarReloc_count(&contributions[file].relocs[section]);
+        }
+        bssSize += contributions[file].bssSize;
+    }
+
+    Fado_WriteRelocsHeader(stream, sectionSizes, bssSize,
+                           relocCounts[FAIRY_SECTION_TEXT] + relocCounts[FAIRY_SECTION_DATA] +
+                               relocCounts[FAIRY_SECTION_RODATA],
+                           options->ovlName, options->literalSizes);
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        uint32_t sectionOffset = 0;
+
+        if (relocCounts[section] == 0) {
+            continue;
+        }
+        Fado_WriteRelocsSectionHeader(stream, section);
+        for (file = 0; file < options->inputFilesCount; file++) {
+            FadoSidecarReloc* reloc;
+
+            VC_VECTOR_TYPED_FOREACH(reloc, &contributions[file].relocs[section]) {
+                Fado_WriteReloc(stream, reloc->relocWord + sectionOffset, reloc->symbolName);
+            }
+            sectionOffset += contributions[file].progBitsSizes[section];
+        }
+    }
+    Fado_WriteRelocsFooter(
+        stream, relocCounts[FAIRY_SECTION_TEXT] + relocCounts[FAIRY_SECTION_DATA] + relocCounts[FAIRY_SECTION_RODATA],
+        options->ovlName);
+}
+
+/* The sidecar file */
+
+static const char* Fado_SidecarOvlName(const FadoIncrementalOptions* options) {
+    return (options->ovlName != NULL) ? options->ovlName : "";
+}
+
+/**
+ * The sidecar is text: a header with the options that affect the output, then for each input file a line with its
+ * stamp, section sizes, reloc counts, defined name count and name, followed by its relocs and its defined names, one
+ * to a line. It ends with "end", so that a truncated one is not mistaken for a whole one.
+ */
+static bool Fado_WriteSidecar(const FadoContribution* contributions, const FadoIncrementalOptions* options) {
+    char* contents = NULL;
+    size_t size = 0;
+    FILE* stream = open_memstream(&contents, &size);
+    bool success;
+    int file;
+
+    if (stream == NULL) {
+        fprintf(stderr, "error: unable to write sidecar file '%s'\n", options->sidecarFileName);
+        return false;
+    }
+    fprintf(stream, "%s\n", SIDECAR_MAGIC);
+    fprintf(stream, "overlay %s\n", Fado_SidecarOvlName(options));
+    fprintf(stream, "literal-sizes %d\n", options->literalSizes);
+    fprintf(stream, "alignment %d\n", (options->context != NULL) && options->context->useElfAlignment);
+    fprintf(stream, "files %d\n", options->inputFilesCount);
+
+    for (file = 0; file < options->inputFilesCount; file++) {
+        const FadoContribution* contribution = &contributions[file];
+        const FadoFileStamp* stamp = &contribution->stamp;
+        FairySection section;
+        FadoSidecarReloc* reloc;
+        char** name;
+
+        fprintf(stream,
+                "file %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRId64 " %" PRId64 " %u %u %u %u %zu %zu %zu %zu %s\n",
+                stamp->device, stamp->inode, stamp->size, stamp->mtimeSec, stamp->mtimeNsec,
+                contribution->progBitsSizes[FAIRY_SECTION_TEXT], contribution->progBitsSizes[FAIRY_SECTION_DATA],
+                contribution->progBitsSizes[FAIRY_SECTION_RODATA], contribution->bssSize,
+                vc_vector_FadoSidecarReloc_count(&contribution->relocs[FAIRY_SECTION_TEXT]),
+                vc_vector_FadoSidecarReloc_count(&contribution->relocs[FAIRY_SECTION_DATA]),
+                vc_vector_FadoSidecarReloc_count(&contribution->relocs[FAIRY_SECTION_RODATA]),
+                vc_vector_str_count(&contribution->definedNames), options->inputFileNames[file]);
+        for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+            VC_VECTOR_TYPED_FOREACH(reloc, &contribution->relocs[section]) {
+                fprintf(stream, "0x%08X %s\n", reloc->relocWord, reloc->symbolName);
+            }
+        }
+        VC_VECTOR_TYPED_FOREACH(name, &contribution->definedNames) {
+            fprintf(stream, "%s\n", *name);
+        }
+    }
+    fprintf(stream, "end\n");
+    fclose(stream);
+
+    success = (Mido_WriteFileIfChanged(options->sidecarFileName, contents, size) >= 0);
+    if (!success) {
+        fprintf(stderr, "error: unable to write sidecar file '%s'\n", options->sidecarFileName);
+    }
+    free(contents);
+    return success;
+}
+
+/* The next line of the sidecar without its newline, or NULL at the end of the file */
+static char* Fado_SidecarLine(FILE* file, char** line, size_t* lineSize) {
+    ssize_t length = getline(line, lineSize, file);
+
+    if (length <= 0) {
+        return NULL;
+    }
+    if ((*line)[length - 1] == '\n') {
+        (*line)[length - 1] = '\0';
+    }
+    return *line;
+}
+
+/**
+ * Read the sidecar into contributions, which must be initialised and empty. Returns false, leaving contributions
+ * to be destroyed, if there is none or it is not for the same overlay, inputs and options.
+ */
+static bool Fado_ReadSidecar(FadoContribution* contributions, const FadoIncrementalOptions* options) {
+    FILE* file = fopen(options->sidecarFileName, "r");
+    char* line = NULL;
+    size_t lineSize = 0;
+    char expected[64];
+    bool valid;
+    int fileIndex;
+
+    if (file == NULL) {
+        FAIRY_INFO_PRINTF(options->context, "No sidecar file %s\n", options->sidecarFileName);
+        return false;
+    }
+
+    valid = (Fado_SidecarLine(file, &line, &lineSize) != NULL) && (strcmp(line, SIDECAR_MAGIC) == 0) &&
+            (Fado_SidecarLine(file, &line, &lineSize) != NULL) && (strncmp(line, "overlay ", 8) == 0) &&
+            (strcmp(line + 8, Fado_SidecarOvlName(options)) == 0);
+    sprintf(expected, "literal-sizes %d", options->literalSizes);
+    valid = valid && (Fado_SidecarLine(file, &line, &lineSize) != NULL) && (strcmp(line, expected) == 0);
+    sprintf(expected, "alignment %d", (options->context != NULL) && options->context->useElfAlignment);
+    valid = valid && (Fado_SidecarLine(file, &line, &lineSize) != NULL) && (strcmp(line, expected) == 0);
+    sprintf(expected, "files %d", options->inputFilesCount);
+    valid = valid && (Fado_SidecarLine(file, &line, &lineSize) != NULL) && (strcmp(line, expected) == 0);
+
+    for (fileIndex = 0; valid && (fileIndex < options->inputFilesCount); fileIndex++) {
+        FadoContribution* contribution = &contributions[fileIndex];
+        FadoFileStamp* stamp = &contribution->stamp;
+        size_t relocCounts[FAIRY_SECTION_OTHER];
+        size_t definedCount;
+        FairySection section;
+        int nameStart = 0;
+        size_t i;
+
+        valid = (Fado_SidecarLine(file, &line, &lineSize) != NULL) &&
+                (sscanf(line,
+                        "file %" SCNu64 " %" SCNu64 " %" SCNu64 " %" SCNd64 " %" SCNd64 " %u %u %u %u %zu %zu %zu %zu "
+                        "%n",
+                        &stamp->device, &stamp->inode, &stamp->size, &stamp->mtimeSec, &stamp->mtimeNsec,
+                        &contribution->progBitsSizes[FAIRY_SECTION_TEXT],
+                        &contribution->progBitsSizes[FAIRY_SECTION_DATA],
+                        &contribution->progBitsSizes[FAIRY_SECTION_RODATA], &contribution->bssSize,
+                        &relocCounts[FAIRY_SECTION_TEXT], &relocCounts[FAIRY_SECTION_DATA],
+                        &relocCounts[FAIRY_SECTION_RODATA], &definedCount, &nameStart) == 13) &&
+                (nameStart != 0) && (strcmp(line + nameStart, options->inputFileNames[fileIndex]) == 0);
+
+        for (section = FAIRY_SECTION_TEXT; valid && (section < FAIRY_SECTION_OTHER); section++) {
+            for (i = 0; valid && (i < relocCounts[section]); i++) {
+                FadoSidecarReloc reloc;
+                int symbolStart = 0;
+
+                valid = (Fado_SidecarLine(file, &line, &lineSize) != NULL) &&
+                        (sscanf(line, "0x%X %n", &reloc.relocWord, &symbolStart) == 1) && (symbolStart == 11);
+                if (valid) {
+                    reloc.symbolName = strdup(line + symbolStart);
+                    vc_vector_FadoSidecarReloc_push_back(&contribution->relocs[section], reloc);
+                }
+            }
+        }
+        for (i = 0; valid && (i < definedCount); i++) {
+            valid = (Fado_SidecarLine(file, &line, &lineSize) != NULL);
+            if (valid) {
+                vc_vector_str_push_back(&contribution->definedNames, strdup(line));
+            }
+        }
+    }
+    valid = valid && (Fado_SidecarLine(file, &line, &lineSize) != NULL) && (strcmp(line, "end") == 0);
+
+    if (!valid) {
+        FAIRY_INFO_PRINTF(options->context, "Sidecar file %s is not for these inputs and options\n",
+                          options->sidecarFileName);
+    }
+    free(line);
+    fclose(file);
+    return valid;
+}
+
+/**
+ * Read an input file into fileInfo. Returns false, with an error printed, if it cannot be read.
+ */
+static bool Fado_IncrementalReadFile(const FadoIncrementalOptions* options, FairyFileInfo* fileInfo,
+                                     const char* fileName) {
+    FILE* file = fopen(fileName, "rb");
+    FairyFileHeader header;
+
+    if (file == NULL) {
+        fprintf(stderr, "error: unable to open input file '%s' for reading\n", fileName);
+        return false;
+    }
+    if (Fairy_ReadFileHeader(&header, file) == NULL) {
+        fprintf(stderr, "error: input file '%s' is not a relocatable object\n", fileName);
+        fclose(file);
+        return false;
+    }
+    Fairy_InitFileWithAllocators(fileInfo, file, options->context, sIncrementalAllocators);
+    fclose(file);
+    return true;
+}
+
+/**
+ * Bring the contributions read from the sidecar up to date by reading the files whose stamps have changed. Returns
+ * false if the whole overlay has to be read again, because a changed file defines different names and so may change
+ * which of the other files' relocs are kept. *error is set if a file cannot be read at all.
+ */
+static bool Fado_UpdateContributions(FadoContribution* contributions, const FadoFileStamp* stamps,
+                                     FairyFileInfo* fileInfos, bool* isRead, const FadoIncrementalOptions* options,
+                                     bool* error) {
+    int changedCount = 0;
+    bool sameNames = true;
+    int file;
+
+    for (file = 0; file < options->inputFilesCount; file++) {
+        FadoContribution updated;
+
+        if (Fado_StampsEqual(&stamps[file], &contributions[file].stamp)) {
+            continue;
+        }
+        changedCount++;
+        FAIRY_INFO_PRINTF(options->context, "Reading changed input file %s\n", options->inputFileNames[file]);
+        if (!Fado_IncrementalReadFile(options, &fileInfos[file], options->inputFileNames[file])) {
+            *error = true;
+            return false;
+        }
+        isRead[file] = true;
+
+        Fado_InitContribution(&updated);
+        Fado_ContributionFromFile(&updated, &fileInfos[file]);
+        if (!Fado_ContributionsDefineSame(&updated, &contributions[file])) {
+            FAIRY_INFO_PRINTF(options->context, "%s defines different symbols\n", options->inputFileNames[file]);
+            sameNames = false;
+        }
+        updated.stamp = stamps[file];
+        Fado_DestroyContribution(&contributions[file]);
+        contributions[file] = updated;
+    }
+    if (!sameNames) {
+        return false;
+    }
+
+    /* Only now that every other file's names are known to be the same */
+    for (file = 0; file < options->inputFilesCount; file++) {
+        if (isRead[file]) {
+            Fado_ContributionFilterRelocs(contributions, options->inputFilesCount, file, &fileInfos[file]);
+        }
+    }
+    FAIRY_INFO_PRINTF(options->context, "%d of %d input files changed\n", changedCount, options->inputFilesCount);
+    return true;
+}
+
+/**
+ * Read every input file not already read and write the output as a normal run would, with the contributions of all
+ * of them
+ */
+static bool Fado_RegenerateAll(FILE* stream, FadoContribution* contributions, const FadoFileStamp* stamps,
+                               FairyFileInfo* fileInfos, bool* isRead, const FadoIncrementalOptions* options) {
+    FadoOverlay overlay;
+    int file;
+
+    FAIRY_INFO_PRINTF(options->context, "%s", "Regenerating from all the input files\n");
+    for (file = 0; file < options->inputFilesCount; file++) {
+        if (!isRead[file]) {
+            if (!Fado_IncrementalReadFile(options, &fileInfos[file], options->inputFileNames[file])) {
+                return false;
+            }
+            isRead[file] = true;
+        }
+    }
+
+    Fado_ExtractRelocsFromFileInfos(&overlay, options->inputFilesCount, fileInfos, options->context,
+                                    sIncrementalAllocators);
+    Fado_WriteRelocs(stream, &overlay, options->ovlName, options->literalSizes);
+    for (file = 0; file < options->inputFilesCount; file++) {
+        Fado_DestroyContribution(&contributions[file]);
+        Fado_InitContribution(&contributions[file]);
+        Fado_ContributionFromFile(&contributions[file], &fileInfos[file]);
+        contributions[file].stamp = stamps[file];
+    }
+    Fado_ContributionsFromOverlay(contributions, &overlay);
+    Fado_DestroyOverlay(&overlay);
+    return true;
+}
+
+/**
+ * Write the output file for the input files, reading only those that have changed since the sidecar file was written
+ * if it allows, and otherwise all of them; either way the output is the same as a normal run's. The output file is
+ * only written if its contents change, and the sidecar is brought up to date. Returns false on error.
+ */
+bool Fado_Incremental(const FadoIncrementalOptions* options) {
+    int count = options->inputFilesCount;
+    FadoContribution* contributions = malloc(count * sizeof(FadoContribution));
+    FadoFileStamp* stamps = malloc(count * sizeof(FadoFileStamp));
+    FairyFileInfo* fileInfos = malloc(count * sizeof(FairyFileInfo));
+    bool* isRead = calloc(count, sizeof(bool));
+    char* contents = NULL;
+    size_t size = 0;
+    FILE* stream = open_memstream(&contents, &size);
+    bool success = (stream != NULL);
+    bool error = false;
+    int file;
+
+    for (file = 0; file < count; file++) {
+        Fado_InitContribution(&contributions[file]);
+    }
+    /* Stamped before being read, so that a file written meanwhile is read again next time */
+    for (file = 0; success && (file < count); file++) {
+        if (!Fado_StampFile(&stamps[file], options->inputFileNames[file])) {
+            fprintf(stderr, "error: unable to open input file '%s' for reading\n", options->inputFileNames[file]);
+            success = false;
+        }
+    }
+
+    if (success) {
+        if (Fado_ReadSidecar(contributions, options) &&
+            Fado_UpdateContributions(contributions, stamps, fileInfos, isRead, options, &error)) {
+            Fado_WriteContributions(stream, contributions, options);
+        } else {
+            success = !error && Fado_RegenerateAll(stream, contributions, stamps, fileInfos, isRead, options);
+        }
+    }
+    if (stream != NULL) {
+        fclose(stream);
+    }
+
+    if (success) {
+        success = (Mido_WriteFileIfChanged(options->outputFileName, contents, size) >= 0);
+        if (!success) {
+            fprintf(stderr, "error: unable to write output file '%s'\n", options->outputFileName);
+        }
+    }
+    /* A sidecar that no longer matches the output must not be used */
+    if (success) {
+        success = Fado_WriteSidecar(contributions, options);
+    }
+    if (!success) {
+        remove(options->sidecarFileName);
+    }
+
+    for (file = 0; file < count; file++) {
+        if (isRead[file]) {
+            Fairy_DestroyFile(&fileInfos[file]);
+        }
+        Fado_DestroyContribution(&contributions[file]);
+    }
+    free(contents);
+    free(isRead);
+    free(fileInfos);
+    free(stamps);
+    free(contributions);
+    return success;
+}
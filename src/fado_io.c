@@ -0,0 +1,702 @@
+/**
+ * Reading the parts of the input files that Fairy needs in a few batches, all files at once, rather than one seek and
+ * read at a time per file. Batches are submitted together through io_uring where the kernel allows it, or read one
+ * after another with pread otherwise. Fairy then reads from memory through ordinary FILEs.
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _GNU_SOURCE /* fopencookie */
+#include "fado_io.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include "mips_elf.h"
+#include "vc_vector/vc_vector_typed.h"
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+/* Sizes of the ELF structures in the file, independent of the host's */
+#define IO_ELF_HEADER_SIZE 0x34
+#define IO_SECTION_HEADER_SIZE 0x28
+
+/* Entries in the io_uring queues: a batch larger than this is submitted in parts */
+#define IO_URING_ENTRIES 64
+
+typedef struct {
+    int fd;
+    off_t offset;
+    size_t size;
+    uint8_t* data;
+    bool done; /* Read in full */
+} FadoIoRequest;
+
+/* What a FILE returned by Fado_OpenInputFiles reads from */
+typedef struct {
+    int fd;
+    off_t size;
+    off_t position;
+    FadoIoRequest* ranges; /* Prefetched parts of the file, owned */
+    size_t rangeCount;
+} FadoIoFile;
+
+VC_VECTOR_DECLARE_NAMED(ioRequest, FadoIoRequest);
+
+/* File reading */
+
+/**
+ * Find the prefetched range that offset is in, returning how much of it is left from there, or 0 if there is none
+ */
+static size_t Fado_IoFindRange(const FadoIoFile* ioFile, off_t offset, const uint8_t** dataOut) {
+    size_t i;
+
+    for (i = 0; i < ioFile->rangeCount; i++) {
+        const FadoIoRequest* range = &ioFile->ranges[i];
+
+        if (range->done && (offset >= range->offset) && (offset < range->offset + (off_t)range->size)) {
+            *dataOut = range->data + (offset - range->offset);
+            return range->size - (offset - range->offset);
+        }
+    }
+    return 0;
+}
+
+static ssize_t Fado_IoRead(void* cookie, char* buffer, size_t size) {
+    FadoIoFile* ioFile = cookie;
+    const uint8_t* data;
+    size_t available;
+    ssize_t count;
+
+    if (ioFile->position >= ioFile->size) {
+        return 0;
+    }
+    if (size > (size_t)(ioFile->size - ioFile->position)) {
+        size = ioFile->size - ioFile->position;
+    }
+
+    /*
+     * Reads stop at the end of a prefetched range, so stdio filling its buffer does not read past what Fairy wants.
+     * Anything Fairy reads that was not prefetched is read now.
+     */
+    available = Fado_IoFindRange(ioFile, ioFile->position, &data);
+    if (available != 0) {
+        count = (size < available) ? size : available;
+        memcpy(buffer, data, count);
+    } else {
+        count = pread(ioFile->fd, buffer, size, ioFile->position);
+        if (count < 0) {
+            return -1;
+        }
+    }
+    ioFile->position += count;
+    return count;
+}
+
+static int Fado_IoSeek(void* cookie, off64_t* offset, int whence) {
+    FadoIoFile* ioFile = cookie;
+    off_t position;
+
+    switch (whence) {
+        case SEEK_SET:
+            position = *offset;
+            break;
+
+        case SEEK_CUR:
+            position = ioFile->position + *offset;
+            break;
+
+        case SEEK_END:
+            position = ioFile->size + *offset;
+            break;
+
+        default:
+            return -1;
+    }
+    if (position < 0) {
+        return -1;
+    }
+    ioFile->position = position;
+    *offset = position;
+    return 0;
+}
+
+static int Fado_IoClose(void* cookie) {
+    FadoIoFile* ioFile = cookie;
+    size_t i;
+
+    for (i = 0; i < ioFile->rangeCount; i++) {
+        free(ioFile->ranges[i].data);
+    }
+    free(ioFile->ranges);
+    close(ioFile->fd);
+    free(ioFile);
+    return 0;
+}
+
+/* Batches of reads */
+
+static void Fado_IoPreadBatch(FadoIoRequest* requests, size_t count) {
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        requests[i].done = (pread(requests[i].fd, requests[i].data, requests[i].size, requests[i].offset) ==
+                            (ssize_t)requests[i].size);
+    }
+}
+
+#ifdef __linux__
+/* A minimal io_uring, set up with the raw system calls so as not to depend on liburing */
+typedef struct {
+    int fd;
+    void* sqRing;
+    size_t sqRingSize;
+    void* cqRing;
+    size_t cqRingSize;
+    struct io_uring_sqe* sqes;
+    size_t sqesSize;
+    unsigned* sqTail;
+    unsigned* sqMask;
+    unsigned* sqArray;
+    unsigned* cqHead;
+    unsigned* cqTail;
+    unsigned* cqMask;
+    struct io_uring_cqe* cqes;
+} FadoIoRing;
+
+static bool Fado_IoRingInit(FadoIoRing* ring) {
+    struct io_uring_params params;
+
+    memset(&params, 0, sizeof(params));
+    ring->fd = syscall(__NR_io_uring_setup, IO_URING_ENTRIES, &params);
+    if (ring->fd < 0) {
+        return false;
+    }
+
+    ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                        IORING_OFF_SQ_RING);
+    ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                        IORING_OFF_CQ_RING);
+    ring->sqes = mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                      IORING_OFF_SQES);
+    if ((ring->sqRing == MAP_FAILED) || (ring->cqRing == MAP_FAILED) || (ring->sqes == MAP_FAILED)) {
+        if (ring->sqRing != MAP_FAILED) {
+            munmap(ring->sqRing, ring->sqRingSize);
+        }
+        if (ring->cqRing != MAP_FAILED) {
+            munmap(ring->cqRing, ring->cqRingSize);
+        }
+        if (ring->sqes != MAP_FAILED) {
+            munmap(ring->sqes, ring->sqesSize);
+        }
+        close(ring->fd);
+        return false;
+    }
+
+    ring->sqTail = (unsigned*)((char*)ring->sqRing + params.sq_off.tail);
+    ring->sqMask = (unsigned*)((char*)ring->sqRing + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned*)((char*)ring->sqRing + params.sq_off.array);
+    ring->cqHead = (unsigned*)((char*)ring->cqRing + params.cq_off.head);
+    ring->cqTail = (unsigned*)((char*)ring->cqRing + params.cq_off.tail);
+    ring->cqMask = (unsigned*)((char*)ring->cqRing + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)((char*)ring->cqRing + params.cq_off.cqes);
+    return true;
+}
+
+static void Fado_IoRingDestroy(FadoIoRing* ring) {
+    munmap(ring->sqes, ring->sqesSize);
+    munmap(ring->cqRing, ring->cqRingSize);
+    munmap(ring->sqRing, ring->sqRingSize);
+    close(ring->fd);
+}
+
+/**
+ * Submit up to IO_URING_ENTRIES reads at once and wait for them all. Reads that fail or come up short are left not
+ * done, to be read on demand. Returns false if the ring itself fails, in which case the rest should be read otherwise.
+ */
+static bool Fado_IoRingBatch(FadoIoRing* ring, FadoIoRequest* requests, size_t count) {
+    size_t start;
+
+    for (start = 0; start < count; start += IO_URING_ENTRIES) {
+        size_t part = ((count - start) < IO_URING_ENTRIES) ? (count - start) : IO_URING_ENTRIES;
+        unsigned tail = *ring->sqTail;
+        size_t submitted = 0;
+        size_t completed = 0;
+        size_t i;
+
+        for (i = 0; i < part; i++) {
+            unsigned index = (tail + i) & *ring->sqMask;
+            struct io_uring_sqe* sqe = &ring->sqes[index];
+
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = requests[start + i].fd;
+            sqe->off = requests[start + i].offset;
+            sqe->addr = (uintptr_t)requests[start + i].data;
+            sqe->len = requests[start + i].size;
+            sqe->user_data = start + i;
+            ring->sqArray[index] = index;
+        }
+        /* The kernel must see the entries before the new tail */
+        __atomic_store_n(ring->sqTail, tail + part, __ATOMIC_RELEASE);
+
+        while (completed < part) {
+            unsigned head = *ring->cqHead;
+            unsigned cqTail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+
+            if (head == cqTail) {
+                /* Submits anything not yet submitted and waits for what is left */
+                long entered = syscall(__NR_io_uring_enter, ring->fd, part - submitted, part - completed,
+                                       IORING_ENTER_GETEVENTS, NULL, 0);
+
+                if (entered < 0) {
+                    if (errno != EINTR) {
+                        return false;
+                    }
+                } else {
+                    submitted += entered;
+                }
+                continue;
+            }
+            for (; head != cqTail; head++) {
+                const struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cqMask];
+                FadoIoRequest* request = &requests[cqe->user_data];
+
+                request->done = (cqe->res == (int32_t)request->size);
+                completed++;
+            }
+            __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+        }
+    }
+    return true;
+}
+#endif
+
+typedef struct {
+    bool haveRing;
+#ifdef __linux__
+    FadoIoRing ring;
+#endif
+    FadoIoStats* stats;
+} FadoIoBatcher;
+
+static void Fado_IoBatch(FadoIoBatcher* batcher, FadoIoRequest* requests, size_t count) {
+    size_t i;
+
+    if (count == 0) {
+        return;
+    }
+    batcher->stats->batches++;
+    batcher->stats->reads += count;
+    for (i = 0; i < count; i++) {
+        batcher->stats->bytesPrefetched += requests[i].size;
+    }
+
+#ifdef __linux__
+    if (batcher->haveRing && Fado_IoRingBatch(&batcher->ring, requests, count)) {
+        return;
+    }
+    if (batcher->haveRing) {
+        Fado_IoRingDestroy(&batcher->ring);
+        batcher->haveRing = false;
+        batcher->stats->usedIoUring = false;
+    }
+#endif
+    Fado_IoPreadBatch(requests, count);
+}
+
+static FadoIoRequest Fado_IoMakeRequest(int fd, off_t offset, size_t size) {
+    FadoIoRequest request;
+
+    request.fd = fd;
+    request.offset = offset;
+    request.size = size;
+    request.data = malloc(size);
+    request.done = false;
+    return request;
+}
+
+/* Reading the ELF structures, which are big-endian */
+
+static uint16_t Fado_IoReadHalf(const uint8_t* data) {
+    return data[0] << 8 | data[1];
+}
+
+static uint32_t Fado_IoReadWord(const uint8_t* data) {
+    return (uint32_t)data[0] << 24 | data[1] << 16 | data[2] << 8 | data[3];
+}
+
+/**
+ * Add the ranges that Fairy reads to ioFile and requests: the section name string table, the symbol and string tables,
+ * and the reloc sections of allocated sections, found from the section table range
+ */
+static void Fado_IoAddSectionRequests(FadoIoFile* ioFile, const FadoIoRequest* sectionTable, uint16_t shstrndx,
+                                      vc_vector_ioRequest* requests) {
+    size_t sectionCount = sectionTable->size / IO_SECTION_HEADER_SIZE;
+    size_t i;
+
+    for (i = 0; i < sectionCount; i++) {
+        const uint8_t* header = sectionTable->data + i * IO_SECTION_HEADER_SIZE;
+        uint32_t type = Fado_IoReadWord(header + 0x4);
+        uint32_t offset = Fado_IoReadWord(header + 0x10);
+        uint32_t size = Fado_IoReadWord(header + 0x14);
+        uint32_t info = Fado_IoReadWord(header + 0x1C);
+        bool needed = (i == shstrndx) || (type == SHT_SYMTAB) || (type == SHT_STRTAB);
+
+        if (((type == SHT_REL) || (type == SHT_RELA)) && (info < sectionCount)) {
+            needed = (Fado_IoReadWord(sectionTable->data + info * IO_SECTION_HEADER_SIZE + 0x8) & SHF_ALLOC) != 0;
+        }
+        if (needed && (size != 0) && ((off_t)offset + size <= ioFile->size)) {
+            vc_vector_ioRequest_push_back(requests, Fado_IoMakeRequest(ioFile->fd, offset, size));
+        }
+    }
+}
+
+/**
+ * Open the input files for Fairy to read, with everything it will read from them already read in three batches of
+ * reads across all the files: the ELF headers, then the section tables, then the sections it needs. Any other reads
+ * are done when Fairy asks. The FILEs read from memory and must be closed with fclose. Returns false, with none left
+ * open, if any file cannot be opened.
+ */
+bool Fado_OpenInputFiles(FILE** inputFiles, int inputFilesCount, char** fileNames, bool useIoUring,
+                         FadoIoStats* stats) {
+    static const cookie_io_functions_t ioFunctions = { Fado_IoRead, NULL, Fado_IoSeek, Fado_IoClose };
+    FadoIoFile** ioFiles = calloc(inputFilesCount, sizeof(FadoIoFile*));
+    FadoIoRequest* headers = calloc(inputFilesCount, sizeof(FadoIoRequest));
+    FadoIoRequest* sectionTables = calloc(inputFilesCount, sizeof(FadoIoRequest));
+    vc_vector_ioRequest sections;
+    FadoIoBatcher batcher;
+    size_t requestCount;
+    size_t sectionIndex;
+    int opened;
+    int i;
+
+    memset(stats, 0, sizeof(*stats));
+    batcher.stats = stats;
+    batcher.haveRing = false;
+#ifdef __linux__
+    batcher.haveRing = useIoUring && Fado_IoRingInit(&batcher.ring);
+#else
+    (void)useIoUring;
+#endif
+    stats->usedIoUring = batcher.haveRing;
+
+    for (opened = 0; opened < inputFilesCount; opened++) {
+        int fd = open(fileNames[opened], O_RDONLY | O_CLOEXEC);
+        struct stat fileStat;
+
+        if ((fd < 0) || (fstat(fd, &fileStat) != 0)) {
+            fprintf(stderr, "error: unable to open input file '%s' for reading\n", fileNames[opened]);
+            if (fd >= 0) {
+                close(fd);
+            }
+            break;
+        }
+        ioFiles[opened] = calloc(1, sizeof(FadoIoFile));
+        ioFiles[opened]->fd = fd;
+        ioFiles[opened]->size = fileStat.st_size;
+        headers[opened] = Fado_IoMakeRequest(fd, 0, IO_ELF_HEADER_SIZE);
+    }
+
+    if (opened == inputFilesCount) {
+        Fado_IoBatch(&batcher, headers, inputFilesCount);
+
+        /* Files that are not big-endian 32-bit ELF are left for Fairy to complain about */
+        requestCount = 0;
+        for (i = 0; i < inputFilesCount; i++) {
+            const uint8_t* header = headers[i].data;
+
+            if (headers[i].done && (memcmp(header, ELFMAG, SELFMAG) == 0) && (header[EI_CLASS] == ELFCLASS32) &&
+                (header[EI_DATA] == ELFDATA2MSB) && (Fado_IoReadHalf(header + 0x2E) == IO_SECTION_HEADER_SIZE)) {
+                uint32_t tableOffset = Fado_IoReadWord(header + 0x20);
+                size_t tableSize = Fado_IoReadHalf(header + 0x30) * IO_SECTION_HEADER_SIZE;
+
+                if ((tableSize != 0) && ((off_t)tableOffset + (off_t)tableSize <= ioFiles[i]->size)) {
+                    sectionTables[requestCount++] = Fado_IoMakeRequest(ioFiles[i]->fd, tableOffset, tableSize);
+                }
+            }
+        }
+        Fado_IoBatch(&batcher, sectionTables, requestCount);
+
+        vc_vector_ioRequest_init(&sections, 8 * inputFilesCount);
+        sectionIndex = 0;
+        for (i = 0; i < inputFilesCount; i++) {
+            if ((sectionIndex < requestCount) && (sectionTables[sectionIndex].fd == ioFiles[i]->fd)) {
+                if (sectionTables[sectionIndex].done) {
+                    Fado_IoAddSectionRequests(ioFiles[i], &sectionTables[sectionIndex],
+                                              Fado_IoReadHalf(headers[i].data + 0x32), &sections);
+                }
+                sectionIndex++;
+            }
+        }
+        Fado_IoBatch(&batcher, vc_vector_ioRequest_begin(&sections), vc_vector_ioRequest_count(&sections));
+
+        /* Give each file its ranges. Requests are in file order, so each file's are together. */
+        {
+            FadoIoRequest* sectionRequests = vc_vector_ioRequest_begin(&sections);
+            size_t sectionCount = vc_vector_ioRequest_count(&sections);
+            size_t next = 0;
+
+            sectionIndex = 0;
+            for (i = 0; i < inputFilesCount; i++) {
+                FadoIoFile* ioFile = ioFiles[i];
+                size_t first = next;
+                bool haveTable = (sectionIndex < requestCount) && (sectionTables[sectionIndex].fd == ioFile->fd);
+
+                while ((next < sectionCount) && (sectionRequests[next].fd == ioFile->fd)) {
+                    next++;
+                }
+                ioFile->rangeCount = 1 + haveTable + (next - first);
+                ioFile->ranges = malloc(ioFile->rangeCount * sizeof(FadoIoRequest));
+                ioFile->ranges[0] = headers[i];
+                if (haveTable) {
+                    ioFile->ranges[1] = sectionTables[sectionIndex++];
+                }
+                memcpy(&ioFile->ranges[1 + haveTable], &sectionRequests[first], (next - first) * sizeof(FadoIoRequest));
+            }
+        }
+        vc_vector_ioRequest_release(&sections);
+
+        for (i = 0; i < inputFilesCount; i++) {
+            inputFiles[i] = fopencookie(ioFiles[i], "rb", ioFunctions);
+            if (inputFiles[i] == NULL) {
+                fprintf(stderr, "error: unable to open input file '%s' for reading\n", fileNames[i]);
+                break;
+            }
+        }
+        if (i < inputFilesCount) {
+            opened = i;
+            while (i < inputFilesCount) {
+                Fado_IoClose(ioFiles[i++]);
+            }
+            while (opened-- > 0) {
+                fclose(inputFiles[opened]);
+            }
+            opened = -1;
+        }
+    } else {
+        for (i = 0; i < opened; i++) {
+            free(headers[i].data);
+            close(ioFiles[i]->fd);
+            free(ioFiles[i]);
+        }
+    }
+
+#ifdef __linux__
+    if (batcher.haveRing) {
+        Fado_IoRingDestroy(&batcher.ring);
+    }
+#endif
+    free(sectionTables);
+    free(headers);
+    free(ioFiles);
+    return opened == inputFilesCount;
+}
+
+/* Inputs, with archives */
+
+static void Fado_InputsAddPath(FadoInputs* inputs, char* path) {
+    int i;
+
+    for (i = 0; i < inputs->pathCount; i++) {
+        if (strcmp(inputs->paths[i], path) == 0) {
+            free(path);
+            return;
+        }
+    }
+    inputs->paths[inputs->pathCount++] = path;
+}
+
+static void Fado_InputsAdd(FadoInputs* inputs, char* name, FadoArchive* archive, const FadoArchiveMember* member,
+                           int* capacity) {
+    if (inputs->count == *capacity) {
+        *capacity *= 2;
+        inputs->names = realloc(inputs->names, *capacity * sizeof(char*));
+        inputs->files = realloc(inputs->files, *capacity * sizeof(FILE*));
+        inputs->memberArchives = realloc(inputs->memberArchives, *capacity * sizeof(FadoArchive*));
+        inputs->members = realloc(inputs->members, *capacity * sizeof(FadoArchiveMember*));
+    }
+    inputs->names[inputs->count] = name;
+    inputs->files[inputs->count] = NULL;
+    inputs->memberArchives[inputs->count] = archive;
+    inputs->members[inputs->count] = member;
+    inputs->count++;
+}
+
+static void Fado_InputsAddMember(FadoInputs* inputs, FadoArchive* archive, const FadoArchiveMember* member,
+                                 int* capacity) {
+    char* name = malloc(strlen(archive->fileName) + strlen(member->name) + sizeof("()"));
+
+    sprintf(name, "%s(%s)", archive->fileName, member->name);
+    Fado_InputsAdd(inputs, name, archive, member, capacity);
+}
+
+/**
+ * Open the archive of an archive input, or find it if it is already open. Returns NULL on failure.
+ */
+static FadoArchive* Fado_InputsOpenArchive(FadoInputs* inputs, char* archiveName) {
+    int i;
+
+    for (i = 0; i < inputs->archiveCount; i++) {
+        if (strcmp(inputs->archives[i].fileName, archiveName) == 0) {
+            free(archiveName);
+            return &inputs->archives[i];
+        }
+    }
+    inputs->paths[inputs->pathCount++] = archiveName;
+    if (!Fado_ArchiveOpen(&inputs->archives[inputs->archiveCount], archiveName)) {
+        return NULL;
+    }
+    return &inputs->archives[inputs->archiveCount++];
+}
+
+/**
+ * Work out the input files given by args, expanding "libfoo.a" into the archive's object members, in order, and
+ * "libfoo.a(member.o)" into just that member. Archives are mapped into memory now, and their members read from there
+ * once opened. Returns false, with an error printed, if an archive cannot be read or has no such member. Either way
+ * inputs must be freed with Fado_FreeInputs.
+ */
+bool Fado_ExpandInputs(FadoInputs* inputs, int argCount, char** args) {
+    int capacity = argCount;
+    int arg;
+
+    inputs->count = 0;
+    inputs->names = malloc(capacity * sizeof(char*));
+    inputs->files = malloc(capacity * sizeof(FILE*));
+    inputs->memberArchives = malloc(capacity * sizeof(FadoArchive*));
+    inputs->members = malloc(capacity * sizeof(FadoArchiveMember*));
+    inputs->pathCount = 0;
+    inputs->paths = malloc(argCount * sizeof(char*));
+    inputs->archiveCount = 0;
+    inputs->archives = malloc(argCount * sizeof(FadoArchive));
+
+    for (arg = 0; arg < argCount; arg++) {
+        char* memberName;
+        char* archiveName = Fado_ArchiveSplitInput(args[arg], &memberName);
+        FadoArchive* archive;
+        const FadoArchiveMember* member;
+
+        if (archiveName == NULL) {
+            Fado_InputsAddPath(inputs, strdup(args[arg]));
+            Fado_InputsAdd(inputs, strdup(args[arg]), NULL, NULL, &capacity);
+            continue;
+        }
+
+        archive = Fado_InputsOpenArchive(inputs, archiveName);
+        if (archive == NULL) {
+            free(memberName);
+            return false;
+        }
+        if (memberName != NULL) {
+            member = Fado_ArchiveFindMember(archive, memberName);
+            if (member == NULL) {
+                fprintf(stderr, "error: archive '%s' has no member '%s'\n", archive->fileName, memberName);
+                free(memberName);
+                return false;
+            }
+            Fado_InputsAddMember(inputs, archive, member, &capacity);
+            free(memberName);
+        } else {
+            /* Skip anything that is not an object, such as the text files some tools add to libraries */
+            VC_VECTOR_TYPED_FOREACH(member, &archive->members) {
+                if (Fado_ArchiveMemberIsObject(archive, member)) {
+                    Fado_InputsAddMember(inputs, archive, member, &capacity);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Open the expanded inputs, the files on disk with Fado_OpenInputFiles and the archive members from the archives'
+ * mappings. Returns false, with an error printed and none left open, if any cannot be opened. Otherwise the files
+ * must be closed with Fado_CloseInputs.
+ */
+bool Fado_OpenInputs(FadoInputs* inputs, bool useIoUring, FadoIoStats* stats) {
+    char** plainNames = malloc(inputs->count * sizeof(char*));
+    FILE** plainFiles = malloc(inputs->count * sizeof(FILE*));
+    int* plainIndices = malloc(inputs->count * sizeof(int));
+    int plainCount = 0;
+    bool success = true;
+    int i;
+
+    memset(stats, 0, sizeof(*stats));
+    for (i = 0; success && (i < inputs->count); i++) {
+        if (inputs->members[i] == NULL) {
+            plainNames[plainCount] = inputs->names[i];
+            plainIndices[plainCount++] = i;
+        } else {
+            inputs->files[i] = Fado_ArchiveOpenMember(inputs->memberArchives[i], inputs->members[i]);
+            if (inputs->files[i] == NULL) {
+                fprintf(stderr, "error: unable to open input file '%s' for reading\n", inputs->names[i]);
+                success = false;
+            }
+        }
+    }
+    if (success && (plainCount != 0)) {
+        success = Fado_OpenInputFiles(plainFiles, plainCount, plainNames, useIoUring, stats);
+        for (i = 0; success && (i < plainCount); i++) {
+            inputs->files[plainIndices[i]] = plainFiles[i];
+        }
+    }
+
+    free(plainIndices);
+    free(plainFiles);
+    free(plainNames);
+    if (!success) {
+        Fado_CloseInputs(inputs);
+    }
+    return success;
+}
+
+/**
+ * Close the input files, but keep the archives open, so they can be opened again. Any that are not open are skipped,
+ * so this may also be called after Fado_ExpandInputs or Fado_OpenInputs has failed.
+ */
+void Fado_CloseInputs(FadoInputs* inputs) {
+    int i;
+
+    for (i = 0; i < inputs->count; i++) {
+        if (inputs->files[i] != NULL) {
+            fclose(inputs->files[i]);
+            inputs->files[i] = NULL;
+        }
+    }
+}
+
+/**
+ * Free the expanded inputs and close their archives
+ */
+void Fado_FreeInputs(FadoInputs* inputs) {
+    int i;
+
+    for (i = 0; i < inputs->archiveCount; i++) {
+        Fado_ArchiveClose(&inputs->archives[i]);
+    }
+    for (i = 0; i < inputs->count; i++) {
+        free(inputs->names[i]);
+    }
+    for (i = 0; i < inputs->pathCount; i++) {
+        free(inputs->paths[i]);
+    }
+    free(inputs->names);
+    free(inputs->files);
+    free(inputs->memberArchives);
+    free(inputs->members);
+    free(inputs->paths);
+    free(inputs->archives);
+}
@@ -0,0 +1,541 @@
+/**
+ * Linking an overlay's objects into the overlay binary without ld: the .text, .data and .rodata of every file in turn,
+ * with the relocs resolved for a given VRAM, followed by the .ovl section
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* getline, strdup */
+#include "fado_link.h"
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "macros.h"
+#include "z64ovl/z64ovl.h"
+
+/* The address of a section that is not part of the overlay */
+#define FADO_LINK_UNPLACED UINT32_MAX
+
+/* Where the sections of one input file go */
+typedef struct {
+    FairyFileHeader header;
+    FairySecHeader* sectionTable;
+    uint32_t* imageOffsets; /* Of each section in the image, FADO_LINK_UNPLACED if it is not in the image */
+    uint32_t* addresses;    /* Of each section with the overlay at its vram, FADO_LINK_UNPLACED if not in the overlay */
+} FadoLinkFile;
+
+/* A HI16 reloc waiting for the LO16 that holds the rest of its addend */
+typedef struct {
+    uint8_t* location;
+    size_t symbolIndex;
+    uint32_t symbolAddress;
+} FadoLinkHi16;
+
+VC_VECTOR_DECLARE(FadoLinkHi16);
+
+typedef struct {
+    const FadoOverlay* overlay;
+    char** inputFileNames;
+    uint32_t vram;
+    FadoLinkFile* files;
+    FadoLinkSymbols globals; /* Defined in the overlay, names borrowed from the files' strtabs */
+    const FadoLinkSymbols* externals;
+    uint8_t* image;
+    size_t imageSize; /* Without the .ovl section */
+} FadoLink;
+
+static int Fado_CompareLinkSymbols(const void* a, const void* b) {
+    return strcmp(((const FadoLinkSymbol*)a)->name, ((const FadoLinkSymbol*)b)->name);
+}
+
+static const FadoLinkSymbol* Fado_FindLinkSymbol(const FadoLinkSymbols* symbols, const char* name) {
+    FadoLinkSymbol key;
+
+    key.name = (char*)name;
+    return bsearch(&key, vc_vector_FadoLinkSymbol_begin(&symbols->symbols),
+                   vc_vector_FadoLinkSymbol_count(&symbols->symbols), sizeof(FadoLinkSymbol),
+                   Fado_CompareLinkSymbols);
+}
+
+static char* Fado_LinkSkipSpace(char* string) {
+    while (isspace((unsigned char)*string)) {
+        string++;
+    }
+    return string;
+}
+
+/**
+ * Read the addresses of the symbols outside the overlay from file, in the form of the assignments in a linker script,
+ * "NAME = ADDRESS;" one to a line, with C comments. Returns false, with an error printed, if it cannot be parsed.
+ */
+bool Fado_ReadLinkSymbols(FadoLinkSymbols* symbols, FILE* file, const char* fileName) {
+    char* line = NULL;
+    size_t lineSize = 0;
+    int lineNumber = 0;
+    bool inComment = false;
+    bool success = true;
+
+    vc_vector_FadoLinkSymbol_init(&symbols->symbols, 0);
+    while (success && (getline(&line, &lineSize, file) > 0)) {
+        char* text = line;
+        char* end;
+        char* nameEnd;
+        FadoLinkSymbol symbol;
+
+        lineNumber++;
+        /* Blank out comments */
+        for (end = line; *end != '\0'; end++) {
+            if (inComment) {
+                if ((end[0] == '*') && (end[1] == '/')) {
+                    inComment = false;
+                    *end++ = ' ';
+                }
+                *end = ' ';
+            } else if ((end[0] == '/') && (end[1] == '*')) {
+                inComment = true;
+                *end++ = ' ';
+                *end = ' ';
+            } else if ((end[0] == '/') && (end[1] == '/')) {
+                *end = '\0';
+                break;
+            }
+        }
+
+        text = Fado_LinkSkipSpace(text);
+        if (*text == '\0') {
+            continue;
+        }
+        for (nameEnd = text; isalnum((unsigned char)*nameEnd) || (strchr("_.$", *nameEnd) != NULL); nameEnd++) {}
+        end = Fado_LinkSkipSpace(nameEnd);
+        if ((nameEnd == text) || (*end != '=')) {
+            success = false;
+            break;
+        }
+        *nameEnd = '\0';
+        symbol.value = strtoul(Fado_LinkSkipSpace(end + 1), &end, 0);
+        end = Fado_LinkSkipSpace(end);
+        if (*end == ';') {
+            end = Fado_LinkSkipSpace(end + 1);
+        }
+        if (*end != '\0') {
+            success = false;
+            break;
+        }
+        symbol.name = strdup(text);
+        vc_vector_FadoLinkSymbol_push_back(&symbols->symbols, symbol);
+    }
+    free(line);
+
+    if (!success) {
+        fprintf(stderr, "error: %s:%d: expected 'NAME = ADDRESS;'\n", fileName, lineNumber);
+        Fado_DestroyLinkSymbols(symbols);
+        return false;
+    }
+    qsort(vc_vector_FadoLinkSymbol_begin(&symbols->symbols), vc_vector_FadoLinkSymbol_count(&symbols->symbols),
+          sizeof(FadoLinkSymbol), Fado_CompareLinkSymbols);
+    return true;
+}
+
+void Fado_DestroyLinkSymbols(FadoLinkSymbols* symbols) {
+    FadoLinkSymbol* symbol;
+
+    VC_VECTOR_TYPED_FOREACH(symbol, &symbols->symbols) {
+        free(symbol->name);
+    }
+    vc_vector_FadoLinkSymbol_release(&symbols->symbols);
+}
+
+/* As Fairy_InitFile types them, ignoring the leading "." */
+static FairySection Fado_LinkSectionType(const char* name) {
+    if (strcmp(name, "text") == 0) {
+        return FAIRY_SECTION_TEXT;
+    } else if (strcmp(name, "data") == 0) {
+        return FAIRY_SECTION_DATA;
+    } else if (Fairy_StartsWith(name, "rodata")) {
+        return FAIRY_SECTION_RODATA;
+    }
+    return FAIRY_SECTION_OTHER;
+}
+
+/**
+ * Read the section table of each file and place its sections. This has to agree with the sizes Fairy gives each file's
+ * sections, since those are what the .ovl section's reloc offsets are based on.
+ */
+static bool Fado_LinkPlaceSections(FadoLink* link, FILE** inputFiles) {
+    const FadoOverlay* overlay = link->overlay;
+    bool useElfAlignment = (overlay->context != NULL) && overlay->context->useElfAlignment;
+    uint32_t sectionStarts[FAIRY_SECTION_OTHER];
+    uint32_t bssStart;
+    int file;
+
+    sectionStarts[FAIRY_SECTION_TEXT] = 0;
+    sectionStarts[FAIRY_SECTION_DATA] = overlay->sectionSizes[FAIRY_SECTION_TEXT];
+    sectionStarts[FAIRY_SECTION_RODATA] = sectionStarts[FAIRY_SECTION_DATA] + overlay->sectionSizes[FAIRY_SECTION_DATA];
+    link->imageSize = sectionStarts[FAIRY_SECTION_RODATA] + overlay->sectionSizes[FAIRY_SECTION_RODATA];
+    /* .bss follows the .ovl section */
+    bssStart = link->imageSize + Fado_GetOvlSectionSize(overlay->relocCount);
+
+    for (file = 0; file < overlay->inputFilesCount; file++) {
+        FadoLinkFile* linkFile = &link->files[file];
+        FairySecHeader* sectionTable;
+        char* shstrtab;
+        uint32_t fileSizes[FAIRY_SECTION_OTHER] = { 0 };
+        uint32_t fileBssSize = 0;
+        FairySection type;
+        size_t i;
+
+        if (Fairy_ReadFileHeader(&linkFile->header, inputFiles[file]) == NULL) {
+            fprintf(stderr, "error: '%s' is not a MIPS relocatable object\n", link->inputFileNames[file]);
+            return false;
+        }
+        sectionTable = malloc(linkFile->header.e_shnum * sizeof(FairySecHeader));
+        linkFile->sectionTable = sectionTable;
+        linkFile->imageOffsets = malloc(linkFile->header.e_shnum * sizeof(uint32_t));
+        linkFile->addresses = malloc(linkFile->header.e_shnum * sizeof(uint32_t));
+        Fairy_ReadSectionTable(sectionTable, inputFiles[file], linkFile->header.e_shoff, linkFile->header.e_shnum);
+        shstrtab = malloc(sectionTable[linkFile->header.e_shstrndx].sh_size + 1);
+        Fairy_ReadStringTable(shstrtab, inputFiles[file], sectionTable[linkFile->header.e_shstrndx].sh_offset,
+                              sectionTable[linkFile->header.e_shstrndx].sh_size);
+        shstrtab[sectionTable[linkFile->header.e_shstrndx].sh_size] = '\0';
+
+        for (i = 0; i < linkFile->header.e_shnum; i++) {
+            const FairySecHeader* section = &sectionTable[i];
+            const char* name = &shstrtab[section->sh_name + 1];
+            uint32_t alignment = useElfAlignment ? CLAMP_MIN(section->sh_addralign, 1) : 0x10;
+
+            linkFile->imageOffsets[i] = FADO_LINK_UNPLACED;
+            linkFile->addresses[i] = FADO_LINK_UNPLACED;
+            if ((section->sh_type == SHT_PROGBITS) && ((type = Fado_LinkSectionType(name)) != FAIRY_SECTION_OTHER)) {
+                if (useElfAlignment) {
+                    fileSizes[type] = ALIGN(fileSizes[type], alignment);
+                }
+                linkFile->imageOffsets[i] = sectionStarts[type] + fileSizes[type];
+                linkFile->addresses[i] = link->vram + linkFile->imageOffsets[i];
+                fileSizes[type] += ALIGN(section->sh_size, alignment);
+            } else if ((section->sh_type == SHT_NOBITS) && (strcmp(name, "bss") == 0)) {
+                if (useElfAlignment) {
+                    fileBssSize = ALIGN(fileBssSize, alignment);
+                }
+                linkFile->addresses[i] = link->vram + bssStart + fileBssSize;
+                fileBssSize += ALIGN(section->sh_size, alignment);
+            }
+        }
+        free(shstrtab);
+
+        for (type = FAIRY_SECTION_TEXT; type < FAIRY_SECTION_OTHER; type++) {
+            if (fileSizes[type] != overlay->fileInfos[file].progBitsSizes[type]) {
+                fprintf(stderr, "error: %s: sections laid out differently from when the relocs were read\n",
+                        link->inputFileNames[file]);
+                return false;
+            }
+            sectionStarts[type] += fileSizes[type];
+        }
+        bssStart += fileBssSize;
+    }
+    return true;
+}
+
+/**
+ * Copy the contents of every placed section into the image. The padding between them stays zero.
+ */
+static bool Fado_LinkCopySections(FadoLink* link, FILE** inputFiles) {
+    int file;
+    size_t i;
+
+    for (file = 0; file < link->overlay->inputFilesCount; file++) {
+        const FadoLinkFile* linkFile = &link->files[file];
+
+        for (i = 0; i < linkFile->header.e_shnum; i++) {
+            const FairySecHeader* section = &linkFile->sectionTable[i];
+
+            if ((linkFile->imageOffsets[i] != FADO_LINK_UNPLACED) &&
+                ((fseek(inputFiles[file], section->sh_offset, SEEK_SET) != 0) ||
+                 (fread(&link->image[linkFile->imageOffsets[i]], 1, section->sh_size, inputFiles[file]) !=
+                  section->sh_size))) {
+                fprintf(stderr, "error: %s: unable to read section %zu\n", link->inputFileNames[file], i);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Collect the global symbols defined in the overlay, for the files' undefined symbols to be resolved against
+ */
+static bool Fado_LinkCollectGlobals(FadoLink* link) {
+    const FadoOverlay* overlay = link->overlay;
+    vc_vector_FadoLinkSymbol* globals = &link->globals.symbols;
+    bool success = true;
+    int file;
+    size_t i;
+
+    vc_vector_FadoLinkSymbol_init(globals, 0);
+    for (file = 0; file < overlay->inputFilesCount; file++) {
+        const FairyFileInfo* fileInfo = &overlay->fileInfos[file];
+        const FairySym* symtab = fileInfo->symtabInfo.sectionData;
+
+        for (i = 1; i < fileInfo->symtabInfo.sectionEntryCount; i++) {
+            const FairySym* symbol = &symtab[i];
+            FadoLinkSymbol global;
+
+            if ((ELF32_ST_BIND(symbol->st_info) == STB_LOCAL) || (symbol->st_shndx == SHN_UNDEF) ||
+                (symbol->st_shndx == SHN_COMMON)) {
+                continue;
+            }
+            global.name = &fileInfo->strtab[symbol->st_name];
+            if (symbol->st_shndx == SHN_ABS) {
+                global.value = symbol->st_value;
+            } else if ((symbol->st_shndx < link->files[file].header.e_shnum) &&
+                       (link->files[file].addresses[symbol->st_shndx] != FADO_LINK_UNPLACED)) {
+                global.value = link->files[file].addresses[symbol->st_shndx] + symbol->st_value;
+            } else {
+                continue;
+            }
+            vc_vector_FadoLinkSymbol_push_back(globals, global);
+        }
+    }
+
+    qsort(vc_vector_FadoLinkSymbol_begin(globals), vc_vector_FadoLinkSymbol_count(globals), sizeof(FadoLinkSymbol),
+          Fado_CompareLinkSymbols);
+    for (i = 1; i < vc_vector_FadoLinkSymbol_count(globals); i++) {
+        if (strcmp(vc_vector_FadoLinkSymbol_at(globals, i - 1)->name, vc_vector_FadoLinkSymbol_at(globals, i)->name) ==
+            0) {
+            fprintf(stderr, "error: symbol '%s' is defined more than once in the overlay\n",
+                    vc_vector_FadoLinkSymbol_at(globals, i)->name);
+            success = false;
+        }
+    }
+    return success;
+}
+
+/**
+ * The address of a file's symbol, from its section, the other files of the overlay or the externals
+ */
+static bool Fado_LinkSymbolAddress(const FadoLink* link, int file, size_t symbolIndex, uint32_t* address) {
+    const FairyFileInfo* fileInfo = &link->overlay->fileInfos[file];
+    const FairySym* symbol;
+    const char* name;
+    const FadoLinkSymbol* found;
+
+    if (symbolIndex >= fileInfo->symtabInfo.sectionEntryCount) {
+        fprintf(stderr, "error: %s: reloc against symbol %zu, which does not exist\n", link->inputFileNames[file],
+                symbolIndex);
+        return false;
+    }
+    symbol = &((const FairySym*)fileInfo->symtabInfo.sectionData)[symbolIndex];
+    name = &fileInfo->strtab[symbol->st_name];
+    switch (symbol->st_shndx) {
+        case SHN_UNDEF:
+            found = Fado_FindLinkSymbol(&link->globals, name);
+            if ((found == NULL) && (link->externals != NULL)) {
+                found = Fado_FindLinkSymbol(link->externals, name);
+            }
+            if (found == NULL) {
+                fprintf(stderr, "error: %s: undefined symbol '%s'\n", link->inputFileNames[file], name);
+                return false;
+            }
+            *address = found->value;
+            return true;
+
+        case SHN_ABS:
+            *address = symbol->st_value;
+            return true;
+
+        case SHN_COMMON:
+            fprintf(stderr, "error: %s: common symbol '%s', which needs -fno-common\n", link->inputFileNames[file],
+                    name);
+            return false;
+
+        default:
+            if ((symbol->st_shndx >= link->files[file].header.e_shnum) ||
+                (link->files[file].addresses[symbol->st_shndx] == FADO_LINK_UNPLACED)) {
+                fprintf(stderr, "error: %s: symbol '%s' is in a section that is not part of the overlay\n",
+                        link->inputFileNames[file], name);
+                return false;
+            }
+            *address = link->files[file].addresses[symbol->st_shndx] + symbol->st_value;
+            return true;
+    }
+}
+
+static void Fado_LinkWriteHi16(uint8_t* location, uint32_t value) {
+    uint32_t word = Z64Ovl_ReadWord(location);
+
+    /* The LO16 is signed, so the HI16 rounds up when it is negative */
+    Z64Ovl_WriteWord(location, (word & 0xFFFF0000) | (((value + 0x8000) >> 16) & 0xFFFF));
+}
+
+/**
+ * Apply one reloc table to the section it is for. In REL tables the addends are in the instructions, and a HI16's is
+ * only complete with the low half in the next LO16 against the same symbol.
+ */
+static bool Fado_LinkApplyRelocs(FadoLink* link, int file, FILE* inputFile, const FairySecHeader* relocSection) {
+    const FadoLinkFile* linkFile = &link->files[file];
+    uint32_t sectionOffset = linkFile->imageOffsets[relocSection->sh_info];
+    uint32_t sectionSize = linkFile->sectionTable[relocSection->sh_info].sh_size;
+    bool rela = (relocSection->sh_type == SHT_RELA);
+    vc_vector_FadoLinkHi16 pendingHi16s;
+    FairyRela* relocs;
+    size_t relocCount;
+    bool success = true;
+    size_t i;
+
+    relocCount = Fairy_ReadRelocs(&relocs, inputFile, relocSection->sh_type, relocSection->sh_offset,
+                                  relocSection->sh_size);
+    vc_vector_FadoLinkHi16_init(&pendingHi16s, 0);
+
+    for (i = 0; success && (i < relocCount); i++) {
+        const FairyRela* reloc = &relocs[i];
+        size_t symbolIndex = ELF32_R_SYM(reloc->r_info);
+        uint8_t* location = &link->image[sectionOffset + reloc->r_offset];
+        uint32_t place = link->vram + sectionOffset + reloc->r_offset;
+        uint32_t word;
+        uint32_t symbolAddress;
+        uint32_t addend;
+
+        if ((uint64_t)reloc->r_offset + 4 > sectionSize) {
+            fprintf(stderr, "error: %s: reloc at 0x%X is outside its section\n", link->inputFileNames[file],
+                    reloc->r_offset);
+            success = false;
+            break;
+        }
+        if ((ELF32_R_TYPE(reloc->r_info) == R_MIPS_NONE) || (ELF32_R_TYPE(reloc->r_info) == R_MIPS_JALR)) {
+            continue;
+        }
+        if (!Fado_LinkSymbolAddress(link, file, symbolIndex, &symbolAddress)) {
+            success = false;
+            break;
+        }
+        word = Z64Ovl_ReadWord(location);
+
+        switch (ELF32_R_TYPE(reloc->r_info)) {
+            case R_MIPS_32:
+                addend = rela ? (uint32_t)reloc->r_addend : word;
+                Z64Ovl_WriteWord(location, symbolAddress + addend);
+                break;
+
+            case R_MIPS_26:
+                /* The top bits of the target come from the jump's own address, so they are simply dropped */
+                addend = rela ? (uint32_t)reloc->r_addend : (word & 0x03FFFFFF) << 2;
+                Z64Ovl_WriteWord(location, (word & 0xFC000000) | (((symbolAddress + addend) >> 2) & 0x03FFFFFF));
+                break;
+
+            case R_MIPS_HI16:
+                if (rela) {
+                    Fado_LinkWriteHi16(location, symbolAddress + reloc->r_addend);
+                } else {
+                    FadoLinkHi16 hi16 = { location, symbolIndex, symbolAddress };
+
+                    vc_vector_FadoLinkHi16_push_back(&pendingHi16s, hi16);
+                }
+                break;
+
+            case R_MIPS_LO16:
+                addend = rela ? (uint32_t)reloc->r_addend : (uint32_t)(int16_t)(word & 0xFFFF);
+                if (!rela) {
+                    FadoLinkHi16* hi16;
+                    size_t kept = 0;
+
+                    VC_VECTOR_TYPED_FOREACH(hi16, &pendingHi16s) {
+                        if (hi16->symbolIndex == symbolIndex) {
+                            Fado_LinkWriteHi16(hi16->location,
+                                               hi16->symbolAddress + (Z64Ovl_ReadWord(hi16->location) << 16) + addend);
+                        } else {
+                            *vc_vector_FadoLinkHi16_at(&pendingHi16s, kept++) = *hi16;
+                        }
+                    }
+                    pendingHi16s.count = kept;
+                }
+                Z64Ovl_WriteWord(location, (word & 0xFFFF0000) | ((symbolAddress + addend) & 0xFFFF));
+                break;
+
+            case R_MIPS_PC16:
+                addend = rela ? (uint32_t)reloc->r_addend : (uint32_t)(int16_t)(word & 0xFFFF) << 2;
+                Z64Ovl_WriteWord(location, (word & 0xFFFF0000) | (((symbolAddress + addend - place) >> 2) & 0xFFFF));
+                break;
+
+            default:
+                fprintf(stderr, "error: %s: unsupported reloc type %s at 0x%X\n", link->inputFileNames[file],
+                        Fairy_StringFromDefine(relTypeNames, ELF32_R_TYPE(reloc->r_info)), reloc->r_offset);
+                success = false;
+                break;
+        }
+    }
+
+    /* A HI16 without a LO16 has no low half to its addend */
+    if (success) {
+        FadoLinkHi16* hi16;
+
+        VC_VECTOR_TYPED_FOREACH(hi16, &pendingHi16s) {
+            Fado_LinkWriteHi16(hi16->location, hi16->symbolAddress + (Z64Ovl_ReadWord(hi16->location) << 16));
+        }
+    }
+    vc_vector_FadoLinkHi16_release(&pendingHi16s);
+    free(relocs);
+    return success;
+}
+
+/**
+ * Write the overlay binary of the overlay read from inputFiles, linked to run at vram: the .text, .data and .rodata
+ * sections of each file, laid out as for the overlay's relocs, followed by its .ovl section. Undefined symbols not
+ * defined by another file of the overlay are looked up in externals (which may be NULL). Returns false, with an error
+ * printed, if the overlay cannot be linked, e.g. because of an undefined symbol.
+ */
+bool Fado_LinkOverlay(FILE* outputFile, const FadoOverlay* overlay, FILE** inputFiles, char** inputFileNames,
+                      uint32_t vram, const FadoLinkSymbols* externals) {
+    FadoLink link;
+    size_t ovlSize = Fado_GetOvlSectionSize(overlay->relocCount);
+    bool success;
+    int file;
+    size_t i;
+
+    link.overlay = overlay;
+    link.inputFileNames = inputFileNames;
+    link.vram = vram;
+    link.files = calloc(overlay->inputFilesCount, sizeof(FadoLinkFile));
+    link.externals = externals;
+    link.image = NULL;
+    vc_vector_FadoLinkSymbol_init(&link.globals.symbols, 0);
+
+    success = Fado_LinkPlaceSections(&link, inputFiles);
+    if (success) {
+        link.image = calloc(link.imageSize + ovlSize, 1);
+        success = Fado_LinkCopySections(&link, inputFiles) && Fado_LinkCollectGlobals(&link);
+    }
+    for (file = 0; success && (file < overlay->inputFilesCount); file++) {
+        const FadoLinkFile* linkFile = &link.files[file];
+
+        for (i = 0; success && (i < linkFile->header.e_shnum); i++) {
+            const FairySecHeader* section = &linkFile->sectionTable[i];
+
+            /* Only the relocs of sections in the image, not e.g. debugging information */
+            if (((section->sh_type == SHT_REL) || (section->sh_type == SHT_RELA)) &&
+                (section->sh_info < linkFile->header.e_shnum) &&
+                (linkFile->imageOffsets[section->sh_info] != FADO_LINK_UNPLACED)) {
+                success = Fado_LinkApplyRelocs(&link, file, inputFiles[file], section);
+            }
+        }
+    }
+
+    if (success) {
+        Fado_WriteOvlSection(&link.image[link.imageSize], overlay);
+        success = (fwrite(link.image, 1, link.imageSize + ovlSize, outputFile) == link.imageSize + ovlSize);
+        if (!success) {
+            fprintf(stderr, "error: unable to write the overlay binary\n");
+        }
+    }
+
+    for (file = 0; file < overlay->inputFilesCount; file++) {
+        free(link.files[file].sectionTable);
+        free(link.files[file].imageOffsets);
+        free(link.files[file].addresses);
+    }
+    free(link.files);
+    free(link.image);
+    vc_vector_FadoLinkSymbol_release(&link.globals.symbols);
+    return success;
+}
@@ -0,0 +1,72 @@
+/**
+ * Accounting of the memory used by fado, by category, for --stats
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include "fado_memory.h"
+
+static const char* categoryNames[FADO_MEMORY_MAX] = {
+    "section tables", "symtabs", "strtabs", "relocs", "string vectors", "output", "file info",
+};
+static const char* categoryJsonNames[FADO_MEMORY_MAX] = {
+    "sectionTables", "symtabs", "strtabs", "relocs", "stringVectors", "output", "fileInfo",
+};
+
+/**
+ * Set up the counters, all of which allocate from parent (NULL for libc)
+ */
+void Fado_MemoryInit(FadoMemory* memory, const vc_allocator* parent) {
+    size_t i;
+
+    vc_counting_allocator_init(&memory->total, parent);
+    for (i = 0; i < FADO_MEMORY_MAX; i++) {
+        vc_counting_allocator_init_with_total(&memory->counters[i], parent, &memory->total);
+        memory->allocators[i] = vc_counting_allocator_get(&memory->counters[i]);
+        memory->categories[i] = &memory->allocators[i];
+    }
+}
+
+static void Fado_MemoryWriteRow(FILE* outputFile, const char* name, const vc_counting_allocator* counter) {
+    fprintf(outputFile, "  %-24s %8zu %8zu %8zu %12zu %12zu\n", name, counter->alloc_count, counter->realloc_count,
+            counter->free_count, counter->current_bytes, counter->peak_bytes);
+}
+
+/**
+ * Write the allocation counts and current and peak bytes of each category as a human-readable table. The peak of the
+ * total is the most that was in use at once, not the sum of the categories' peaks.
+ */
+void Fado_MemoryWrite(FILE* outputFile, const FadoMemory* memory) {
+    size_t i;
+
+    fprintf(outputFile, "fado memory:\n");
+    fprintf(outputFile, "  %-24s %8s %8s %8s %12s %12s\n", "category", "allocs", "reallocs", "frees", "current",
+            "peak");
+    for (i = 0; i < FADO_MEMORY_MAX; i++) {
+        Fado_MemoryWriteRow(outputFile, categoryNames[i], &memory->counters[i]);
+    }
+    Fado_MemoryWriteRow(outputFile, "total", &memory->total);
+}
+
+static void Fado_MemoryWriteJsonCounter(FILE* outputFile, const char* name, const vc_counting_allocator* counter) {
+    fprintf(outputFile,
+            "\"%s\": { \"allocs\": %zu, \"reallocs\": %zu, \"frees\": %zu, \"currentBytes\": %zu, \"peakBytes\": %zu }",
+            name, counter->alloc_count, counter->realloc_count, counter->free_count, counter->current_bytes,
+            counter->peak_bytes);
+}
+
+/**
+ * Write the same as Fado_MemoryWrite as a JSON object
+ */
+void Fado_MemoryWriteJson(FILE* outputFile, const FadoMemory* memory) {
+    size_t i;
+
+    fprintf(outputFile, "{");
+    for (i = 0; i < FADO_MEMORY_MAX; i++) {
+        fprintf(outputFile, "\n    ");
+        Fado_MemoryWriteJsonCounter(outputFile, categoryJsonNames[i], &memory->counters[i]);
+        fprintf(outputFile, ",");
+    }
+    fprintf(outputFile, "\n    ");
+    Fado_MemoryWriteJsonCounter(outputFile, "total", &memory->total);
+    fprintf(outputFile, "\n  }");
+}
@@ -0,0 +1,358 @@
+/**
+ * Timing and hardware counter instrumentation of the phases of a fado run, for --stats, and a timeline of them for
+ * --trace
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _GNU_SOURCE
+#include "fado_stats.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#include "fairy/fairy.h"
+#include "json.h"
+#include "macros.h"
+#include "vc_vector/vc_vector_typed.h"
+
+static const char* phaseNames[FADO_PHASE_MAX] = { "open", "read", "strings", "filter", "output", "teardown" };
+static const char* counterNames[FADO_COUNTER_MAX] = { "cycles", "instructions", "cacheMisses" };
+static const char* traceNames[FADO_PHASE_MAX] = {
+    "open inputs", "parse", "collect symbol names", "filter relocs", "write output", "teardown",
+};
+static const char* traceSectionNames[FAIRY_SECTION_OTHER] = { ".text", ".data", ".rodata" };
+
+#ifdef __linux__
+static int Fado_StatsOpenCounter(uint64_t config, int groupFd) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = (groupFd == -1);
+    /* Only count this process in user space, which is permitted at the default perf_event_paranoid of 2 */
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+
+    return syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+#endif
+
+/**
+ * Try to open a group of cycle, instruction and cache miss counters. If any of them is unavailable (no permission, no
+ * PMU in a VM, not Linux, ...) only the times are recorded.
+ */
+static void Fado_StatsOpenCounters(FadoStats* stats, const FairyContext* context) {
+#ifdef __linux__
+    static const uint64_t configs[FADO_COUNTER_MAX] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+    };
+    size_t i;
+
+    for (i = 0; i < FADO_COUNTER_MAX; i++) {
+        stats->perfFds[i] = Fado_StatsOpenCounter(configs[i], (i == 0) ? -1 : stats->perfFds[0]);
+        if (stats->perfFds[i] == -1) {
+            FAIRY_INFO_PRINTF(context, "Hardware counter %s unavailable, only recording times\n", counterNames[i]);
+            while (i-- > 0) {
+                close(stats->perfFds[i]);
+            }
+            return;
+        }
+    }
+
+    ioctl(stats->perfFds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(stats->perfFds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    stats->haveCounters = true;
+#else
+    (void)stats;
+    (void)context;
+#endif
+}
+
+static void Fado_StatsTakeSnapshot(const FadoStats* stats, FadoStatsSnapshot* snapshot) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    snapshot->nanoseconds = (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+
+    memset(snapshot->counters, 0, sizeof(snapshot->counters));
+#ifdef __linux__
+    if (stats->haveCounters) {
+        struct {
+            uint64_t count;
+            uint64_t values[FADO_COUNTER_MAX];
+        } group;
+
+        if (read(stats->perfFds[0], &group, sizeof(group)) == sizeof(group)) {
+            memcpy(snapshot->counters, group.values, sizeof(snapshot->counters));
+        }
+    }
+#else
+    (void)stats;
+#endif
+}
+
+static void Fado_StatsAccumulate(FadoPhaseStats* phaseStats, const FadoStatsSnapshot* start,
+                                 const FadoStatsSnapshot* end) {
+    size_t i;
+
+    phaseStats->calls++;
+    phaseStats->nanoseconds += end->nanoseconds - start->nanoseconds;
+    for (i = 0; i < FADO_COUNTER_MAX; i++) {
+        phaseStats->counters[i] += end->counters[i] - start->counters[i];
+    }
+}
+
+/**
+ * Start recording into stats, which then has to be set as the stats of the context the run uses. context (NULL for the
+ * defaults) is only used for logging.
+ */
+void Fado_StatsInit(FadoStats* stats, const FairyContext* context, int inputFilesCount, bool tracing) {
+    memset(stats, 0, sizeof(*stats));
+    stats->tracing = tracing;
+    stats->inputFilesCount = inputFilesCount;
+    stats->files = calloc(inputFilesCount, sizeof(FadoPhaseStats));
+    Fado_StatsOpenCounters(stats, context);
+}
+
+void Fado_StatsDestroy(FadoStats* stats) {
+#ifdef __linux__
+    if (stats->haveCounters) {
+        size_t i;
+
+        for (i = 0; i < FADO_COUNTER_MAX; i++) {
+            close(stats->perfFds[i]);
+        }
+    }
+#endif
+    free(stats->files);
+    vc_vector_FadoTraceEvent_release(&stats->traceEvents);
+    memset(stats, 0, sizeof(*stats));
+}
+
+/**
+ * The statistics to record a run with context into, NULL if there are none
+ */
+FadoStats* Fado_StatsOf(const FairyContext* context) {
+    return (context != NULL) ? context->stats : NULL;
+}
+
+void Fado_StatsBegin(FadoStats* stats, FadoPhase phase) {
+    if (stats != NULL) {
+        Fado_StatsTakeSnapshot(stats, &stats->phaseStarts[phase]);
+    }
+}
+
+static void Fado_StatsEndSpan(FadoStats* stats, FadoPhase phase, int file, int section) {
+    FadoStatsSnapshot end;
+
+    if (stats == NULL) {
+        return;
+    }
+
+    Fado_StatsTakeSnapshot(stats, &end);
+    Fado_StatsAccumulate(&stats->phases[phase], &stats->phaseStarts[phase], &end);
+    if ((phase == FADO_PHASE_READ) && (file >= 0) && (file < stats->inputFilesCount)) {
+        Fado_StatsAccumulate(&stats->files[file], &stats->phaseStarts[phase], &end);
+    }
+
+    if (stats->tracing) {
+        FadoTraceEvent event;
+
+        event.phase = phase;
+        event.file = file;
+        event.section = section;
+        event.startNs = stats->phaseStarts[phase].nanoseconds;
+        event.endNs = end.nanoseconds;
+        vc_vector_FadoTraceEvent_push_back(&stats->traceEvents, event);
+    }
+}
+
+void Fado_StatsEnd(FadoStats* stats, FadoPhase phase) {
+    Fado_StatsEndSpan(stats, phase, -1, -1);
+}
+
+/**
+ * End a phase begun with Fado_StatsBegin that dealt with the input file with index file (if nonnegative), which is
+ * shown in the trace. Reading is also recorded against the file.
+ */
+void Fado_StatsEndFile(FadoStats* stats, FadoPhase phase, int file) {
+    Fado_StatsEndSpan(stats, phase, file, -1);
+}
+
+/**
+ * End a phase begun with Fado_StatsBegin that dealt with one FairySection of the input file with index file, both of
+ * which are shown in the trace
+ */
+void Fado_StatsEndSection(FadoStats* stats, FadoPhase phase, int file, FairySection section) {
+    Fado_StatsEndSpan(stats, phase, file, section);
+}
+
+void Fado_StatsSetRelocCounts(FadoStats* stats, uint32_t kept, uint32_t dropped) {
+    if (stats != NULL) {
+        stats->relocsKept = kept;
+        stats->relocsDropped = dropped;
+    }
+}
+
+void Fado_StatsAddBytesRead(FadoStats* stats, size_t bytes) {
+    if (stats != NULL) {
+        stats->bytesRead += bytes;
+    }
+}
+
+/**
+ * Include the memory accounting in the report. It must still be valid when the report is written.
+ */
+void Fado_StatsSetMemory(FadoStats* stats, const FadoMemory* memory) {
+    if (stats != NULL) {
+        stats->memory = memory;
+    }
+}
+
+static void Fado_StatsWriteRow(FILE* outputFile, const char* name, const FadoPhaseStats* phaseStats,
+                               bool haveCounters) {
+    fprintf(outputFile, "  %-24s %6u %12.1f", name, phaseStats->calls, phaseStats->nanoseconds / 1000.0);
+    if (haveCounters) {
+        fprintf(outputFile, " %14" PRIu64 " %14" PRIu64 " %14" PRIu64, phaseStats->counters[FADO_COUNTER_CYCLES],
+                phaseStats->counters[FADO_COUNTER_INSTRUCTIONS], phaseStats->counters[FADO_COUNTER_CACHE_MISSES]);
+    }
+    fprintf(outputFile, "\n");
+}
+
+/**
+ * Write the recorded statistics as a human-readable table
+ */
+void Fado_StatsWrite(const FadoStats* stats, FILE* outputFile, char** inputFileNames) {
+    FadoPhaseStats total = { 0 };
+    int i;
+    size_t j;
+
+    fprintf(outputFile, "fado stats:\n");
+    fprintf(outputFile, "  %-24s %6s %12s", "phase", "calls", "time (us)");
+    if (stats->haveCounters) {
+        fprintf(outputFile, " %14s %14s %14s", "cycles", "instructions", "cache misses");
+    }
+    fprintf(outputFile, "\n");
+
+    for (i = 0; i < FADO_PHASE_MAX; i++) {
+        Fado_StatsWriteRow(outputFile, phaseNames[i], &stats->phases[i], stats->haveCounters);
+
+        total.calls += stats->phases[i].calls;
+        total.nanoseconds += stats->phases[i].nanoseconds;
+        for (j = 0; j < FADO_COUNTER_MAX; j++) {
+            total.counters[j] += stats->phases[i].counters[j];
+        }
+
+        if (i == FADO_PHASE_READ) {
+            int file;
+
+            for (file = 0; file < stats->inputFilesCount; file++) {
+                char name[25];
+
+                snprintf(name, sizeof(name), "  %s", inputFileNames[file]);
+                Fado_StatsWriteRow(outputFile, name, &stats->files[file], stats->haveCounters);
+            }
+        }
+    }
+    Fado_StatsWriteRow(outputFile, "total", &total, stats->haveCounters);
+
+    fprintf(outputFile, "  relocs kept %u, dropped %u; %zu bytes read\n", stats->relocsKept, stats->relocsDropped,
+            stats->bytesRead);
+
+    if (stats->memory != NULL) {
+        Fado_MemoryWrite(outputFile, stats->memory);
+    }
+}
+
+static void Fado_StatsWriteJsonPhase(FILE* outputFile, const FadoPhaseStats* phaseStats, bool haveCounters) {
+    size_t i;
+
+    fprintf(outputFile, "\"calls\": %u, \"ns\": %" PRIu64, phaseStats->calls, phaseStats->nanoseconds);
+    if (haveCounters) {
+        for (i = 0; i < FADO_COUNTER_MAX; i++) {
+            fprintf(outputFile, ", \"%s\": %" PRIu64, counterNames[i], phaseStats->counters[i]);
+        }
+    }
+}
+
+/**
+ * Write the recorded statistics as a JSON object, for aggregation by the build
+ */
+void Fado_StatsWriteJson(const FadoStats* stats, FILE* outputFile, char** inputFileNames) {
+    int i;
+
+    fprintf(outputFile, "{\n  \"counters\": %s,\n  \"phases\": {", stats->haveCounters ? "true" : "false");
+    for (i = 0; i < FADO_PHASE_MAX; i++) {
+        fprintf(outputFile, "%s\n    \"%s\": { ", (i == 0) ? "" : ",", phaseNames[i]);
+        Fado_StatsWriteJsonPhase(outputFile, &stats->phases[i], stats->haveCounters);
+        fprintf(outputFile, " }");
+    }
+    fprintf(outputFile, "\n  },\n  \"files\": [");
+    for (i = 0; i < stats->inputFilesCount; i++) {
+        fprintf(outputFile, "%s\n    { \"name\": ", (i == 0) ? "" : ",");
+        Json_WriteString(outputFile, inputFileNames[i]);
+        fprintf(outputFile, ", ");
+        Fado_StatsWriteJsonPhase(outputFile, &stats->files[i], stats->haveCounters);
+        fprintf(outputFile, " }");
+    }
+    fprintf(outputFile, "\n  ],\n  \"relocsKept\": %u,\n  \"relocsDropped\": %u,\n  \"bytesRead\": %zu",
+            stats->relocsKept, stats->relocsDropped, stats->bytesRead);
+    if (stats->memory != NULL) {
+        fprintf(outputFile, ",\n  \"memory\": ");
+        Fado_MemoryWriteJson(outputFile, stats->memory);
+    }
+    fprintf(outputFile, "\n}\n");
+}
+
+static long Fado_TraceThreadId(void) {
+#ifdef __linux__
+    return syscall(SYS_gettid);
+#else
+    return getpid();
+#endif
+}
+
+/**
+ * Write the recorded spans as Chrome trace-event JSON (complete "X" events, timestamps in microseconds of
+ * CLOCK_MONOTONIC), which chrome://tracing and Perfetto can show alongside other processes' traces such as clang's
+ * -ftime-trace
+ */
+void Fado_TraceWrite(const FadoStats* stats, FILE* outputFile, char** inputFileNames) {
+    const FadoTraceEvent* event;
+    long pid = getpid();
+    long tid = Fado_TraceThreadId();
+
+    fprintf(outputFile, "{\n  \"traceEvents\": [\n");
+    fprintf(outputFile, "    { \"name\": \"process_name\", \"ph\": \"M\", \"pid\": %ld, \"tid\": %ld, ", pid, tid);
+    fprintf(outputFile, "\"args\": { \"name\": \"fado\" } }");
+    VC_VECTOR_TYPED_FOREACH(event, &stats->traceEvents) {
+        fprintf(outputFile, ",\n    { \"name\": \"%s\", \"cat\": \"fado\", \"ph\": \"X\", ", traceNames[event->phase]);
+        fprintf(outputFile, "\"ts\": %.3f, \"dur\": %.3f, \"pid\": %ld, \"tid\": %ld", event->startNs / 1000.0,
+                (event->endNs - event->startNs) / 1000.0, pid, tid);
+        if (event->file >= 0) {
+            fprintf(outputFile, ", \"args\": { \"file\": ");
+            Json_WriteString(outputFile, inputFileNames[event->file]);
+            if (event->section >= 0) {
+                fprintf(outputFile, ", \"section\": \"%s\"", traceSectionNames[event->section]);
+            }
+            fprintf(outputFile, " }");
+        }
+        fprintf(outputFile, " }");
+    }
+    fprintf(outputFile, "\n  ],\n  \"displayTimeUnit\": \"ms\"\n}\n");
+}
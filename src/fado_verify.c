@@ -0,0 +1,339 @@
+/**
+ * Checking an already-built overlay against the .ovl section Fado would generate from its objects
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include "fado_verify.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fado.h"
+#include "fairy/fairy.h"
+#include "macros.h"
+#include "z64ovl/z64ovl.h"
+
+/* Stop listing individual reloc mismatches after this many, since one missing reloc will offset all the rest */
+#define VERIFY_MAX_RELOC_REPORTS 20
+
+/* In the order of the overlay header */
+static const char* sizeNames[] = { "text", "data", "rodata", "bss" };
+
+static int Fado_VerifyError(const char* ovlName, const char* fmt, ...) {
+    va_list args;
+
+    va_start(args, fmt);
+    fprintf(stderr, "%s: ", ovlName);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    return 1;
+}
+
+static void Fado_DescribeRelocWord(char* buf, size_t bufSize, uint32_t relocWord) {
+    const char* sectionName = NULL;
+    const char* typeName = Fairy_StringFromDefine(relTypeNames, Z64OVL_RELOC_TYPE(relocWord));
+
+    if (Z64OVL_RELOC_SECTION(relocWord) != Z64OVL_SECTION_NONE) {
+        sectionName = Fairy_StringFromDefine(relSectionNames, Z64OVL_RELOC_SECTION(relocWord) - 1);
+    }
+    snprintf(buf, bufSize, "%s %s 0x%06X", (sectionName != NULL) ? sectionName : "(invalid section)",
+             (typeName != NULL) ? typeName : "(invalid type)", Z64OVL_RELOC_OFFSET(relocWord));
+}
+
+/**
+ * Read the whole of a raw overlay binary, i.e. the overlay as it is in the ROM. The returned pointer must be freed.
+ */
+static uint8_t* Fado_ReadOverlayBinary(FILE* file, size_t* sizeOut) {
+    long size;
+    uint8_t* data;
+
+    if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0) {
+        return NULL;
+    }
+
+    data = malloc(size);
+    if (data == NULL || fread(data, sizeof(char), size, file) != (size_t)size) {
+        free(data);
+        return NULL;
+    }
+
+    *sizeOut = size;
+    return data;
+}
+
+/**
+ * Read an overlay out of a linked ELF. The linker script places each segment in a section named "..NAME", with its bss
+ * in "..NAME.bss". The returned pointer must be freed.
+ */
+static uint8_t* Fado_ReadOverlayFromElf(FILE* file, const char* ovlName, size_t* sizeOut, bool* hasBss,
+                                        uint32_t* bssSizeOut) {
+    FairyFileHeader fileHeader;
+    FairySecHeader* sectionTable;
+    char* shstrtab;
+    uint8_t* data = NULL;
+    size_t nameLength = strlen(ovlName);
+    size_t currentIndex;
+
+    if (Fairy_ReadElfHeader(&fileHeader, file) == NULL) {
+        return NULL;
+    }
+
+    sectionTable = malloc(fileHeader.e_shnum * sizeof(FairySecHeader));
+    Fairy_ReadSectionTable(sectionTable, file, fileHeader.e_shoff, fileHeader.e_shnum);
+
+    shstrtab = malloc(sectionTable[fileHeader.e_shstrndx].sh_size);
+    Fairy_ReadStringTable(shstrtab, file, sectionTable[fileHeader.e_shstrndx].sh_offset,
+                          sectionTable[fileHeader.e_shstrndx].sh_size);
+
+    *hasBss = false;
+    for (currentIndex = 0; currentIndex < fileHeader.e_shnum; currentIndex++) {
+        const FairySecHeader* currentSection = &sectionTable[currentIndex];
+        const char* sectionName = Fairy_GetSectionName(sectionTable, shstrtab, currentIndex);
+
+        if (!Fairy_StartsWith(sectionName, "..") || strncmp(&sectionName[2], ovlName, nameLength) != 0) {
+            continue;
+        }
+
+        if (sectionName[2 + nameLength] == '\0' && currentSection->sh_type == SHT_PROGBITS) {
+            data = malloc(currentSection->sh_size);
+            if (data == NULL || fseek(file, currentSection->sh_offset, SEEK_SET) != 0 ||
+                fread(data, sizeof(char), currentSection->sh_size, file) != currentSection->sh_size) {
+                free(data);
+                data = NULL;
+                break;
+            }
+            *sizeOut = currentSection->sh_size;
+        } else if (strcmp(&sectionName[2 + nameLength], ".bss") == 0) {
+            *hasBss = true;
+            *bssSizeOut = currentSection->sh_size;
+        }
+    }
+
+    if (data == NULL) {
+        fprintf(stderr, "error: no section '..%s' found in ELF file\n", ovlName);
+    }
+
+    free(shstrtab);
+    free(sectionTable);
+    return data;
+}
+
+/**
+ * Compare the section sizes of the overlay with the _NAMESegment*Size symbols the linker script defines in a linked
+ * ELF, if it has them. Returns the number of mismatches, which are printed to stderr.
+ */
+int Fado_CheckSizeSymbols(FILE* elfFile, const FadoOverlay* overlay, const char* ovlName) {
+    static const char* sizeSymbolFormats[] = {
+        "_%sSegmentTextSize",
+        "_%sSegmentDataSize",
+        "_%sSegmentRoDataSize",
+        "_%sSegmentBssSize",
+    };
+    FairyFileHeader fileHeader;
+    FairySecHeader* sectionTable;
+    uint32_t expectedSizes[4];
+    bool found[4] = { false };
+    int errors = 0;
+    size_t currentIndex;
+    size_t i;
+
+    if (Fairy_ReadElfHeader(&fileHeader, elfFile) == NULL) {
+        return Fado_VerifyError(ovlName, "error: unable to read linked ELF\n");
+    }
+
+    memcpy(expectedSizes, overlay->sectionSizes, sizeof(overlay->sectionSizes));
+    expectedSizes[3] = overlay->bssSize;
+
+    sectionTable = malloc(fileHeader.e_shnum * sizeof(FairySecHeader));
+    Fairy_ReadSectionTable(sectionTable, elfFile, fileHeader.e_shoff, fileHeader.e_shnum);
+
+    for (currentIndex = 0; currentIndex < fileHeader.e_shnum; currentIndex++) {
+        const FairySecHeader* strtabSection;
+        FairySym* symtab;
+        char* strtab;
+        size_t symCount;
+        size_t currentSym;
+
+        if (sectionTable[currentIndex].sh_type != SHT_SYMTAB ||
+            sectionTable[currentIndex].sh_link >= fileHeader.e_shnum) {
+            continue;
+        }
+
+        symCount = Fairy_ReadSymbolTable(&symtab, elfFile, sectionTable[currentIndex].sh_offset,
+                                         sectionTable[currentIndex].sh_size);
+        strtabSection = &sectionTable[sectionTable[currentIndex].sh_link];
+        strtab = malloc(strtabSection->sh_size);
+        Fairy_ReadStringTable(strtab, elfFile, strtabSection->sh_offset, strtabSection->sh_size);
+
+        for (i = 0; i < ARRAY_COUNTU(sizeSymbolFormats); i++) {
+            char symbolName[0x100];
+
+            snprintf(symbolName, sizeof(symbolName), sizeSymbolFormats[i], ovlName);
+            for (currentSym = 0; currentSym < symCount; currentSym++) {
+                if (strcmp(Fairy_GetSymbolName(symtab, strtab, currentSym), symbolName) == 0) {
+                    found[i] = true;
+                    if (symtab[currentSym].st_value != expectedSizes[i]) {
+                        errors += Fado_VerifyError(ovlName, "%s is 0x%X, but the objects' sections total 0x%X\n",
+                                                   symbolName, symtab[currentSym].st_value, expectedSizes[i]);
+                    }
+                    break;
+                }
+            }
+        }
+
+        free(strtab);
+        free(symtab);
+    }
+
+    for (i = 0; i < ARRAY_COUNTU(sizeSymbolFormats); i++) {
+        if (!found[i]) {
+            FAIRY_INFO_PRINTF(overlay->context, "%s: no size symbol found for %s, not checked\n", ovlName,
+                              sizeNames[i]);
+        }
+    }
+
+    free(sectionTable);
+    return errors;
+}
+
+/**
+ * Compare the .ovl section at the end of a built overlay with the one that would be generated for the overlay's input
+ * files, checking section sizes, reloc entries and their order, padding and the final OverlayInfoOffset. overlayFile
+ * may be a raw overlay binary or a linked ELF containing the overlay, in which case the linker's size symbols are also
+ * checked. Returns the number of problems found, which are printed to stderr.
+ */
+int Fado_Verify(FILE* overlayFile, const FadoOverlay* overlay, const char* ovlName) {
+    uint8_t magic[4] = { 0 };
+    uint8_t* data;
+    size_t size = 0;
+    bool hasElfBss = false;
+    uint32_t elfBssSize = 0;
+    Z64OvlInfo info;
+    uint32_t infoStart;
+    int errors = 0;
+
+    if (fread(magic, sizeof(char), sizeof(magic), overlayFile) == sizeof(magic) && magic[0] == 0x7F &&
+        magic[1] == 'E' && magic[2] == 'L' && magic[3] == 'F') {
+        data = Fado_ReadOverlayFromElf(overlayFile, ovlName, &size, &hasElfBss, &elfBssSize);
+        errors += Fado_CheckSizeSymbols(overlayFile, overlay, ovlName);
+    } else {
+        data = Fado_ReadOverlayBinary(overlayFile, &size);
+    }
+    if (data == NULL) {
+        return Fado_VerifyError(ovlName, "error: unable to read overlay\n");
+    }
+
+    if (!Z64Ovl_ReadOverlayInfo(&info, data, size)) {
+        errors += Fado_VerifyError(ovlName, "overlay of size 0x%zX has an invalid OverlayInfoOffset or reloc count\n",
+                                   size);
+        goto end;
+    }
+    infoStart = size - info.infoOffset;
+
+    /* Section sizes */
+    {
+        uint32_t actualSizes[4];
+        uint32_t expectedSizes[4];
+        size_t i;
+
+        actualSizes[0] = info.textSize;
+        actualSizes[1] = info.dataSize;
+        actualSizes[2] = info.rodataSize;
+        actualSizes[3] = info.bssSize;
+        memcpy(expectedSizes, overlay->sectionSizes, sizeof(overlay->sectionSizes));
+        expectedSizes[3] = overlay->bssSize;
+
+        for (i = 0; i < ARRAY_COUNTU(expectedSizes); i++) {
+            if (actualSizes[i] != expectedSizes[i]) {
+                errors += Fado_VerifyError(ovlName, "%s size is 0x%X, expected 0x%X\n", sizeNames[i], actualSizes[i],
+                                           expectedSizes[i]);
+            }
+        }
+
+        if (info.textSize + info.dataSize + info.rodataSize != infoStart) {
+            errors += Fado_VerifyError(ovlName, "text, data and rodata end at 0x%X, but .ovl starts at 0x%X\n",
+                                       info.textSize + info.dataSize + info.rodataSize, infoStart);
+        }
+        if (hasElfBss && elfBssSize != info.bssSize) {
+            errors += Fado_VerifyError(ovlName, "bss size in header is 0x%X, but the bss section is 0x%X\n",
+                                       info.bssSize, elfBssSize);
+        }
+    }
+
+    /* Reloc entries */
+    if (info.relocCount != overlay->relocCount) {
+        errors += Fado_VerifyError(ovlName, "reloc count is %u, expected %u\n", info.relocCount, overlay->relocCount);
+    }
+
+    {
+        FairySection section;
+        uint32_t index = 0;
+        uint32_t previousSection = Z64OVL_SECTION_NONE;
+        int relocErrors = 0;
+        char actualDesc[64];
+
+        for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+            FadoRelocInfo* expected;
+
+            VC_VECTOR_TYPED_FOREACH(expected, &overlay->relocList[section]) {
+                uint32_t actual;
+
+                if (index >= info.relocCount) {
+                    goto relocs_end;
+                }
+                actual = Z64Ovl_ReadWord(&info.relocs[4 * index]);
+
+                if (Z64OVL_RELOC_SECTION(actual) < previousSection) {
+                    Fado_DescribeRelocWord(actualDesc, sizeof(actualDesc), actual);
+                    errors += Fado_VerifyError(ovlName, "reloc %u (%s) is out of section order\n", index, actualDesc);
+                }
+                previousSection = Z64OVL_RELOC_SECTION(actual);
+
+                if (actual != expected->relocWord) {
+                    errors++;
+                    if (relocErrors++ < VERIFY_MAX_RELOC_REPORTS) {
+                        char expectedDesc[64];
+
+                        Fado_DescribeRelocWord(actualDesc, sizeof(actualDesc), actual);
+                        Fado_DescribeRelocWord(expectedDesc, sizeof(expectedDesc), expected->relocWord);
+                        Fado_VerifyError(ovlName, "reloc %u is 0x%08X (%s), expected 0x%08X (%s %s)\n", index, actual,
+                                         actualDesc, expected->relocWord, expectedDesc,
+                                         Fado_GetRelocSymbolName(overlay, expected));
+                    }
+                }
+                index++;
+            }
+        }
+    relocs_end:
+        if (relocErrors > VERIFY_MAX_RELOC_REPORTS) {
+            Fado_VerifyError(ovlName, "... and %d more mismatched relocs\n", relocErrors - VERIFY_MAX_RELOC_REPORTS);
+        }
+    }
+
+    /* Padding and OverlayInfoOffset */
+    {
+        uint32_t pos;
+
+        if (info.infoOffset != Fado_GetOvlSectionSize(info.relocCount)) {
+            errors += Fado_VerifyError(ovlName, "OverlayInfoOffset is 0x%X, expected 0x%X for %u relocs\n",
+                                       info.infoOffset, Fado_GetOvlSectionSize(info.relocCount), info.relocCount);
+        }
+        for (pos = infoStart + 4 * (5 + info.relocCount); pos < size - 4; pos += 4) {
+            uint32_t word = Z64Ovl_ReadWord(&data[pos]);
+
+            if (word != 0) {
+                errors += Fado_VerifyError(ovlName, "nonzero padding word 0x%08X at 0x%X\n", word, pos);
+            }
+        }
+    }
+
+end:
+    if (errors == 0) {
+        FAIRY_INFO_PRINTF(overlay->context, "%s: overlay matches its objects\n", ovlName);
+    }
+    free(data);
+    return errors;
+}
@@ -0,0 +1,320 @@
+/**
+ * Watching the input files with inotify and regenerating the output whenever they are rewritten, for --watch
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* open_memstream, strndup */
+#include "fado_watch.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fado.h"
+#include "fairy/fairy.h"
+#include "mido.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <time.h>
+#include <unistd.h>
+
+/* How long the inputs must be quiet after an event before regenerating, so a burst of writes is only handled once */
+#define WATCH_SETTLE_MS 10
+
+typedef struct {
+    const char* fileName;
+    const char* baseName; /* Within fileName */
+    int watch;            /* Of its directory, since compilers often write a new file and rename it over the old */
+    bool changed;
+} FadoWatchedFile;
+
+static const vc_allocator* const sWatchAllocators[FADO_MEMORY_MAX] = { NULL };
+
+static double Fado_WatchMillisecondsSince(const struct timespec* start) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1000.0 + (now.tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+/**
+ * Check that the section table, and every section with contents in the file, lie within it, so that an object caught
+ * half-written can be rejected before Fairy reads it (which assumes its inputs are whole)
+ */
+static bool Fado_WatchCheckSections(FILE* file, const FairyFileHeader* header) {
+    FairySecHeader* sectionTable;
+    size_t fileSize;
+    bool inFile = true;
+    size_t i;
+
+    if ((fseek(file, 0, SEEK_END) != 0) || (ftell(file) < 0)) {
+        return false;
+    }
+    fileSize = ftell(file);
+
+    if ((header->e_shstrndx >= header->e_shnum) || (header->e_shoff > fileSize) ||
+        (header->e_shnum * sizeof(FairySecHeader) > fileSize - header->e_shoff)) {
+        return false;
+    }
+
+    sectionTable = malloc(header->e_shnum * sizeof(FairySecHeader));
+    if (sectionTable == NULL) {
+        return false;
+    }
+    Fairy_ReadSectionTable(sectionTable, file, header->e_shoff, header->e_shnum);
+    for (i = 0; i < header->e_shnum; i++) {
+        const FairySecHeader* section = &sectionTable[i];
+
+        if (section->sh_name >= sectionTable[header->e_shstrndx].sh_size) {
+            inFile = false;
+        } else if ((section->sh_type != SHT_NOBITS) &&
+                   ((section->sh_offset > fileSize) || (section->sh_size > fileSize - section->sh_offset))) {
+            inFile = false;
+        }
+    }
+    free(sectionTable);
+    return inFile;
+}
+
+/**
+ * Read fileName into fileInfo, destroying what was there first if replace is set. A file that cannot be opened, is
+ * not a relocatable object or is cut short leaves fileInfo as it was and returns false.
+ */
+static bool Fado_WatchReadFile(const FadoWatchOptions* options, FairyFileInfo* fileInfo, const char* fileName,
+                               bool replace) {
+    FILE* file = fopen(fileName, "rb");
+    FairyFileHeader header;
+
+    if (file == NULL) {
+        fprintf(stderr, "error: unable to open input file '%s' for reading\n", fileName);
+        return false;
+    }
+    if (Fairy_ReadFileHeader(&header, file) == NULL) {
+        fprintf(stderr, "error: input file '%s' is not a relocatable object\n", fileName);
+        fclose(file);
+        return false;
+    }
+    if (!Fado_WatchCheckSections(file, &header)) {
+        fprintf(stderr, "error: input file '%s' is truncated or its section table is invalid\n", fileName);
+        fclose(file);
+        return false;
+    }
+
+    if (replace) {
+        Fairy_DestroyFile(fileInfo);
+    }
+    Fairy_InitFileWithAllocators(fileInfo, file, options->context, sWatchAllocators);
+    fclose(file);
+    return true;
+}
+
+/**
+ * Write the relocs of the overlay made of fileInfos to the output file, unless it already has them. Returns as
+ * Mido_WriteFileIfChanged.
+ */
+static int Fado_WatchGenerate(const FadoWatchOptions* options, FairyFileInfo* fileInfos) {
+    FadoOverlay overlay;
+    char* contents = NULL;
+    size_t size = 0;
+    FILE* stream = open_memstream(&contents, &size);
+    int written;
+
+    if (stream == NULL) {
+        fprintf(stderr, "error: unable to write output file '%s'\n", options->outputFileName);
+        return -1;
+    }
+
+    Fado_ExtractRelocsFromFileInfos(&overlay, options->inputFilesCount, fileInfos, options->context,
+                                    sWatchAllocators);
+    Fado_WriteRelocs(stream, &overlay, options->ovlName, options->literalSizes);
+    fclose(stream);
+    Fado_DestroyOverlay(&overlay);
+
+    written = Mido_WriteFileIfChanged(options->outputFileName, contents, size);
+    if (written < 0) {
+        fprintf(stderr, "error: unable to write output file '%s'\n", options->outputFileName);
+    }
+    free(contents);
+    return written;
+}
+
+static void Fado_WatchReport(const FadoWatchOptions* options, int written, const struct timespec* start) {
+    if (written > 0) {
+        printf("%s: wrote %s in %.2f ms\n", options->ovlName, options->outputFileName,
+               Fado_WatchMillisecondsSince(start));
+    } else if (written == 0) {
+        printf("%s: %s unchanged\n", options->ovlName, options->outputFileName);
+    }
+    fflush(stdout);
+}
+
+/**
+ * Add a watch on the directory of each input file, for new versions being written to it or renamed into it
+ */
+static bool Fado_WatchAddWatches(int inotifyFd, FadoWatchedFile* files, const FadoWatchOptions* options) {
+    int i;
+
+    for (i = 0; i < options->inputFilesCount; i++) {
+        const char* fileName = options->inputFileNames[i];
+        const char* separator = strrchr(fileName, '/');
+        char* directory = (separator == NULL) ? strndup(".", 1) : strndup(fileName, separator - fileName + 1);
+
+        files[i].fileName = fileName;
+        files[i].baseName = (separator == NULL) ? fileName : separator + 1;
+        files[i].changed = false;
+        /* Watching the same directory again gives the same descriptor */
+        files[i].watch = inotify_add_watch(inotifyFd, directory, IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (files[i].watch < 0) {
+            fprintf(stderr, "error: unable to watch directory '%s': %s\n", directory, strerror(errno));
+            free(directory);
+            return false;
+        }
+        free(directory);
+    }
+    return true;
+}
+
+/**
+ * Mark the files that the events read into buffer are about as changed. Returns the number of them that were not
+ * already, or -1 if a watched directory has gone.
+ */
+static int Fado_WatchHandleEvents(FadoWatchedFile* files, const FadoWatchOptions* options, const char* buffer,
+                                  size_t size) {
+    const struct inotify_event* event;
+    int newlyChanged = 0;
+    size_t offset;
+    int i;
+
+    for (offset = 0; offset < size; offset += sizeof(struct inotify_event) + event->len) {
+        event = (const struct inotify_event*)(buffer + offset);
+
+        if (event->mask & IN_IGNORED) {
+            fprintf(stderr, "error: a directory of the input files has been removed\n");
+            return -1;
+        }
+        for (i = 0; i < options->inputFilesCount; i++) {
+            /* After an overflow, events may have been lost, so assume everything changed */
+            if ((event->mask & IN_Q_OVERFLOW) ||
+                ((event->wd == files[i].watch) && (event->len != 0) && (strcmp(event->name, files[i].baseName) == 0))) {
+                if (!files[i].changed) {
+                    files[i].changed = true;
+                    newlyChanged++;
+                }
+            }
+        }
+    }
+    return newlyChanged;
+}
+
+/**
+ * Regenerate the output file whenever the input files are rewritten, until interrupted. Files are only read again when
+ * they change, and the output only written when its contents do. Returns false on error.
+ */
+bool Fado_Watch(const FadoWatchOptions* options) {
+    FairyFileInfo* fileInfos = malloc(options->inputFilesCount * sizeof(FairyFileInfo));
+    FadoWatchedFile* files = malloc(options->inputFilesCount * sizeof(FadoWatchedFile));
+    /* Aligned for the events read into it */
+    _Alignas(struct inotify_event) char buffer[4096];
+    int inotifyFd = inotify_init1(IN_CLOEXEC);
+    struct pollfd pollFd;
+    struct timespec burstStart;
+    int changedCount = 0;
+    int readCount = 0;
+    bool success = true;
+    int i;
+
+    if (inotifyFd < 0) {
+        fprintf(stderr, "error: unable to start watching the input files: %s\n", strerror(errno));
+        free(files);
+        free(fileInfos);
+        return false;
+    }
+    success = Fado_WatchAddWatches(inotifyFd, files, options);
+
+    /* Watches are added first so that no change after the first read is missed */
+    clock_gettime(CLOCK_MONOTONIC, &burstStart);
+    while (success && (readCount < options->inputFilesCount)) {
+        success = Fado_WatchReadFile(options, &fileInfos[readCount], options->inputFileNames[readCount], false);
+        if (success) {
+            readCount++;
+        }
+    }
+    if (success) {
+        int written = Fado_WatchGenerate(options, fileInfos);
+
+        success = (written >= 0);
+        Fado_WatchReport(options, written, &burstStart);
+    }
+
+    pollFd.fd = inotifyFd;
+    pollFd.events = POLLIN;
+    while (success) {
+        int ready = poll(&pollFd, 1, (changedCount == 0) ? -1 : WATCH_SETTLE_MS);
+
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fprintf(stderr, "error: unable to wait for changes to the input files: %s\n", strerror(errno));
+            success = false;
+        } else if (ready > 0) {
+            ssize_t size = read(inotifyFd, buffer, sizeof(buffer));
+            int newlyChanged;
+
+            if (size <= 0) {
+                continue;
+            }
+            if (changedCount == 0) {
+                clock_gettime(CLOCK_MONOTONIC, &burstStart);
+            }
+            newlyChanged = Fado_WatchHandleEvents(files, options, buffer, size);
+            if (newlyChanged < 0) {
+                success = false;
+            } else {
+                changedCount += newlyChanged;
+            }
+        } else {
+            /* Quiet since the last event, so the burst of writes is over */
+            bool anyRead = false;
+            int written;
+
+            for (i = 0; i < options->inputFilesCount; i++) {
+                if (files[i].changed) {
+                    FAIRY_INFO_PRINTF(options->context, "Reading changed input file %s\n", files[i].fileName);
+                    /* A bad version is reported and the previous one kept, since a fixed one may follow */
+                    anyRead |= Fado_WatchReadFile(options, &fileInfos[i], files[i].fileName, true);
+                    files[i].changed = false;
+                }
+            }
+            changedCount = 0;
+
+            if (anyRead) {
+                written = Fado_WatchGenerate(options, fileInfos);
+                success = (written >= 0);
+                Fado_WatchReport(options, written, &burstStart);
+            }
+        }
+    }
+
+    for (i = 0; i < readCount; i++) {
+        Fairy_DestroyFile(&fileInfos[i]);
+    }
+    close(inotifyFd);
+    free(files);
+    free(fileInfos);
+    return success;
+}
+
+#else
+
+bool Fado_Watch(const FadoWatchOptions* options) {
+    (void)options;
+    fprintf(stderr, "error: --watch is only supported on Linux\n");
+    return false;
+}
+
+#endif
@@ -0,0 +1,43 @@
+/**
+ * Minimal helpers for writing JSON output
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include "json.h"
+
+#include <stdio.h>
+
+/* Write string as a quoted JSON string, escaping as necessary */
+void Json_WriteString(FILE* outputFile, const char* string) {
+    const unsigned char* c;
+
+    fputc('"', outputFile);
+    for (c = (const unsigned char*)string; *c != '\0'; c++) {
+        switch (*c) {
+            case '"':
+                fputs("\\\"", outputFile);
+                break;
+
+            case '\\':
+                fputs("\\\\", outputFile);
+                break;
+
+            case '\n':
+                fputs("\\n", outputFile);
+                break;
+
+            case '\t':
+                fputs("\\t", outputFile);
+                break;
+
+            default:
+                if (*c < 0x20) {
+                    fprintf(outputFile, "\\u%04X", *c);
+                } else {
+                    fputc(*c, outputFile);
+                }
+                break;
+        }
+    }
+    fputc('"', outputFile);
+}
@@ -1,5 +1,6 @@
 /* Copyright (C) 2021 Elliptic Ellipsis */
 /* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* open_memstream */
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -9,8 +10,17 @@
 #include "macros.h"
 #include "fairy/fairy.h"
 #include "fado.h"
+#include "fado_cost.h"
+#include "fado_hotspots.h"
+#include "fado_incremental.h"
+#include "fado_io.h"
+#include "fado_link.h"
+#include "fado_stats.h"
+#include "fado_verify.h"
+#include "fado_watch.h"
 #include "help.h"
 #include "mido.h"
+#include "spec.h"
 #include "vc_vector/vc_vector.h"
 
 #include "version.inc"
@@ -55,8 +65,8 @@ char* GetOverlayNameFromFilename(const char* src) {
     return ret;
 }
 
-#define OPTSTR "M:n:o:v:ahV"
-#define USAGE_STRING "Usage: %s [-hV] [-n name] [-o output_file] [-v level] input_files ...\n"
+#define OPTSTR "b:c:e:F:H:i:k:l:M:n:o:S:s::t:v:y:ahjKLUVw"
+#define USAGE_STRING "Usage: %s [-hjKLUVw] [-b vram] [-c overlay_file] [-e elf_file] [-F format] [-H report_file] [-i sidecar_file] [-k count] [-l report_file] [-M dependency_file] [-n name] [-o output_file] [-s[stats_file]] [-t trace_file] [-v level] [-y symbols_file] input_files ...\n       %s [-KLU] [-F format] [-l report_file] [-M dependency_file] [-v level] -S spec_file\n"
 
 #define HELP_PROLOGUE                                            \
     "Fado (Fairy-Assisted relocations for Decompiled Overlays\n" \
@@ -65,15 +75,32 @@ char* GetOverlayNameFromFilename(const char* src) {
 
 // clang-format off
 static const PosArgInfo posArgInfo[] = {
-    { "INPUT_FILE", "Every positional argument is an input file, and there should be at least one input file. All inputs are relocatable .o (object) ELF files" },
+    { "INPUT_FILE", "Every positional argument is an input file, and there should be at least one input file unless --spec is used. All inputs are relocatable .o (object) ELF files" },
     { NULL, NULL }
 };
 
 static const OptInfo optInfo[] = {
-    { { "make-dependency", required_argument, NULL, 'M' }, "FILE", "Write the output file's Makefile dependencies to FILE" },
+    { { "link", required_argument, NULL, 'b' }, "VRAM", "Instead of writing the relocs, link the overlay to run at VRAM and write its binary: the .text, .data and .rodata of each input file in turn, then the .ovl section. Symbols not defined in the overlay are looked up in the --link-symbols file" },
+    { { "link-symbols", required_argument, NULL, 'y' }, "FILE", "Addresses of the symbols outside the overlay for --link, as 'NAME = ADDRESS;' lines like those of a linker script" },
+    { { "verify", required_argument, NULL, 'c' }, "FILE", "Instead of writing the relocs, check them against the overlay FILE, which is either the overlay binary or a linked ELF containing a '..NAME' section for it. Mismatches are printed, and the exit status is nonzero if there are any" },
+    { { "literal-sizes", no_argument, NULL, 'L' }, NULL, "Write the section sizes from the objects into the header as numbers instead of referencing the linker script's _NAMESegment*Size symbols, so the .ovl section does not depend on the final link" },
+    { { "linked-elf", required_argument, NULL, 'e' }, "FILE", "Check the section sizes against the _NAMESegment*Size symbols in the linked ELF FILE, if it has them, and fail on any mismatch" },
+    { { "hotspots", required_argument, NULL, 'H' }, "FILE", "Write a report of the symbols responsible for the most relocs to FILE ('-' for stdout), grouped by symbol, reloc type and the object the relocs are in" },
+    { { "top", required_argument, NULL, 'k' }, "N", "Number of entries in the hotspot report, 20 by default" },
+    { { "json", no_argument, NULL, 'j' }, NULL, "Write the hotspot report as JSON instead of text" },
+    { { "load-cost", required_argument, NULL, 'l' }, "FILE", "Append a line to the tab-separated report FILE with the overlay's reloc counts by section and type, the size of its .ovl section, and an estimate of the cycles the games' loader will spend relocating it. Reports for many overlays can be sorted by any column" },
+    { { "make-dependency", required_argument, NULL, 'M' }, "FILE", "Write the output file's Makefile dependencies to FILE. With --spec, write the dependencies of every overlay's NAME_reloc.o to FILE instead of a NAME_reloc.d beside each" },
+    { { "dep-format", required_argument, NULL, 'F' }, "FORMAT", "Format of the dependency files: 'make' (default), which also has an empty rule for each input so make does not fail when one is deleted, or 'ninja', just the rule, for ninja's deps = gcc" },
+    { { "dep-if-changed", no_argument, NULL, 'U' }, NULL, "Only write a dependency file if its contents have changed, so its modification time does not make the build system read it again" },
     { { "name", required_argument, NULL, 'n' }, "NAME", "Use NAME as the overlay name. Will use the deepest folder name in the input file's path if not specified" },
     { { "output-file", required_argument, NULL, 'o' }, "FILE", "Output to FILE. Will use stdout if none is specified" },
-    { { "verbosity", required_argument, NULL, 'v' }, "N", "Verbosity level, one of 0 (None, default), 1 (Info), 2 (Debug)" },
+    { { "spec", required_argument, NULL, 'S' }, "FILE", "Instead of one overlay from the input files, process every overlay in the preprocessed spec FILE: each segment including a NAME_reloc.o is overlay NAME, made of its other includes. Its relocs are written to NAME_reloc.s and its dependencies to NAME_reloc.d, beside NAME_reloc.o. Only --literal-sizes, --load-cost, the dependency file options and the logging options can be used with it" },
+    { { "stats", optional_argument, NULL, 's' }, "FILE", "Measure the time taken by each phase (opening, reading each input file, collecting symbol names, filtering relocs, output and teardown), with CPU cycle, instruction and cache miss counts where perf_event_open is permitted, and count the relocs kept and dropped and the bytes read. Written as a table to stderr, or as JSON to FILE if one is given" },
+    { { "trace", required_argument, NULL, 't' }, "FILE", "Write a Chrome/Perfetto trace-event JSON timeline of the run to FILE, with spans for opening the inputs, parsing each input file, collecting symbol names, filtering the relocs of each section of each input file, writing the output and teardown, to be viewed alongside e.g. clang's -ftime-trace" },
+    { { "watch", no_argument, NULL, 'w' }, NULL, "Keep running, and regenerate the output file within milliseconds whenever an input file is rewritten in place or renamed over, if its contents change. Only the changed files are read again. Needs --output-file, and only --name, --literal-sizes, the dependency file options and the logging options can be used with it" },
+    { { "incremental", required_argument, NULL, 'i' }, "FILE", "Record what each input file contributes to the output file in the sidecar FILE, and next time read only the input files that have changed since, moving the other files' relocs as needed. The output is the same as without it; all the files are read if FILE is missing or out of date, or a changed file defines different symbols. Needs --output-file, and only --name, --literal-sizes, the dependency file options and the logging options can be used with it" },
+    { { "verbosity", required_argument, NULL, 'v' }, "N", "Verbosity level, one of 0 (None, default), 1 (Info), 2 (Debug). Debug messages are only compiled into DEBUG builds" },
+    { { "log-kv", no_argument, NULL, 'K' }, NULL, "Print verbose messages as lines of key=value pairs (level, file, line, func and the quoted msg) for other tools to parse" },
 
     { { "alignment", no_argument, NULL, 'a' }, NULL, "Experimental. Use the alignment declared by each section in the elf file instead of padding to 0x10 bytes. NOTE: It has not been properly tested because the tools we currently have are not compatible non 0x10 alignment" },
 
@@ -96,19 +123,237 @@ void ConstructLongOpts(void) {
     }
 }
 
+/**
+ * Write the dependencies of the object assembled from outputFileName on the input files to dependencyFileName
+ */
+bool WriteDependencyFile(const MidoOptions* options, const char* dependencyFileName, const char* outputFileName,
+                         int inputFilesCount, char** inputFileNames) {
+    int fileNameLength = strlen(outputFileName);
+    char* objectFile = malloc((strlen(outputFileName) + 1) * sizeof(char));
+    MidoDependencyFile dependencyFile;
+    char* extensionStart;
+    bool success;
+
+    strcpy(objectFile, outputFileName);
+    extensionStart = strrchr(objectFile, '.');
+    if ((extensionStart == NULL) || (extensionStart == objectFile + fileNameLength - 1)) {
+        fprintf(stderr, "error: output file name should have an extension\n");
+        free(objectFile);
+        return false;
+    }
+    strcpy(extensionStart, ".o");
+
+    if (!Mido_Begin(&dependencyFile, options)) {
+        fprintf(stderr, "error: unable to write dependency file '%s'\n", dependencyFileName);
+        free(objectFile);
+        return false;
+    }
+    Mido_AddRule(&dependencyFile, objectFile, inputFilesCount, inputFileNames);
+    success = Mido_End(&dependencyFile, dependencyFileName);
+
+    free(objectFile);
+    return success;
+}
+
+/* What to do with every overlay of a spec */
+typedef struct {
+    const FairyContext* context;
+    bool literalSizes;
+    FILE* loadCostFile;
+    const MidoOptions* dependencyOptions;
+    MidoDependencyFile* dependencies; /* One file for all the overlays, or NULL for one beside each output */
+} SpecOptions;
+
+/**
+ * Write the relocs and dependencies of one overlay segment of a spec, returning false on failure
+ */
+bool ProcessSpecOverlay(const SpecSegment* segment, const char* relocInclude, const SpecOptions* options) {
+    char* outputFileName = Spec_GetRelocOutput(relocInclude);
+    char** includeNames = malloc(vc_vector_specPath_count(&segment->includes) * sizeof(char*));
+    const vc_allocator* allocators[FADO_MEMORY_MAX] = { NULL };
+    int includesCount = 0;
+    bool success = true;
+    bool opened = false;
+    FadoInputs inputs;
+    FadoIoStats ioStats;
+    FILE* outputFile;
+    char** include;
+
+    /* Every include but the one built from the output */
+    VC_VECTOR_TYPED_FOREACH(include, &segment->includes) {
+        if (*include != relocInclude) {
+            includeNames[includesCount++] = *include;
+        }
+    }
+
+    if (!Fado_ExpandInputs(&inputs, includesCount, includeNames)) {
+        success = false;
+    } else if (inputs.count == 0) {
+        fprintf(stderr, "error: overlay %s has no input files\n", segment->name);
+        success = false;
+    } else if (!Fado_OpenInputs(&inputs, true, &ioStats)) {
+        fprintf(stderr, "error: unable to read the input files of overlay %s\n", segment->name);
+        success = false;
+    } else {
+        opened = true;
+    }
+
+    if (success) {
+        FAIRY_INFO_PRINTF(options->context, "Overlay %s: %d input file%s, writing %s\n", segment->name, inputs.count,
+                          (inputs.count == 1 ? "" : "s"), outputFileName);
+        outputFile = fopen(outputFileName, "wb");
+        if (outputFile == NULL) {
+            fprintf(stderr, "error: unable to open output file '%s' for writing\n", outputFileName);
+            success = false;
+        } else {
+            FadoOverlay overlay;
+
+            Fado_ExtractRelocsWithAllocators(&overlay, inputs.count, inputs.files, options->context, allocators);
+            Fado_WriteRelocs(outputFile, &overlay, segment->name, options->literalSizes);
+            fclose(outputFile);
+            if (options->loadCostFile != NULL) {
+                FadoLoadCost cost;
+
+                Fado_EstimateLoadCost(&cost, &overlay);
+                Fado_WriteLoadCost(options->loadCostFile, &cost, segment->name);
+            }
+            Fado_DestroyOverlay(&overlay);
+
+            if (options->dependencies != NULL) {
+                Mido_AddRule(options->dependencies, relocInclude, inputs.pathCount, inputs.paths);
+            } else {
+                char* dependencyFileName = Spec_GetRelocOutput(relocInclude);
+
+                dependencyFileName[strlen(dependencyFileName) - 1] = 'd';
+                success = WriteDependencyFile(options->dependencyOptions, dependencyFileName, outputFileName,
+                                              inputs.pathCount, inputs.paths);
+                free(dependencyFileName);
+            }
+        }
+    }
+
+    if (opened) {
+        Fado_CloseInputs(&inputs);
+    }
+    Fado_FreeInputs(&inputs);
+    free(includeNames);
+    free(outputFileName);
+    return success;
+}
+
+/**
+ * Process every overlay of the spec file, stopping at the first failure
+ */
+bool ProcessSpec(const char* specFileName, const SpecOptions* options) {
+    FILE* specFile = fopen(specFileName, "r");
+    const SpecSegment* segment;
+    int overlayCount = 0;
+    bool success;
+    Spec spec;
+
+    if (specFile == NULL) {
+        fprintf(stderr, "error: unable to open spec file '%s' for reading\n", specFileName);
+        return false;
+    }
+    success = Spec_Read(&spec, specFile, specFileName);
+    fclose(specFile);
+
+    if (success && (options->loadCostFile != NULL)) {
+        fseek(options->loadCostFile, 0, SEEK_END);
+        if (ftell(options->loadCostFile) == 0) {
+            Fado_WriteLoadCostHeader(options->loadCostFile);
+        }
+    }
+
+    VC_VECTOR_TYPED_FOREACH(segment, &spec.segments) {
+        const char* relocInclude = Spec_GetRelocInclude(segment);
+
+        if (!success) {
+            break;
+        }
+        if (relocInclude != NULL) {
+            success = ProcessSpecOverlay(segment, relocInclude, options);
+            overlayCount++;
+        }
+    }
+    FAIRY_INFO_PRINTF(options->context, "Processed %d overlay%s of %zu segments\n", overlayCount,
+                      (overlayCount == 1 ? "" : "s"), vc_vector_SpecSegment_count(&spec.segments));
+
+    Spec_Destroy(&spec);
+    return success;
+}
+
+/**
+ * Open the file given by --output-file for writing, or use stdout if there was none
+ */
+FILE* OpenOutputFile(const char* outputFileName) {
+    FILE* outputFile;
+
+    if (outputFileName == NULL) {
+        return stdout;
+    }
+    outputFile = fopen(outputFileName, "wb");
+    if (outputFile == NULL) {
+        fprintf(stderr, "error: unable to open output file '%s' for writing\n", outputFileName);
+    }
+    return outputFile;
+}
+
+/**
+ * Write size bytes of contents to the file given by --output-file, or stdout if there was none
+ */
+bool WriteOutputFile(const char* outputFileName, const char* contents, size_t size) {
+    FILE* outputFile = OpenOutputFile(outputFileName);
+    bool success;
+
+    if (outputFile == NULL) {
+        return false;
+    }
+    success = (fwrite(contents, 1, size, outputFile) == size);
+    if (outputFile != stdout) {
+        success = (fclose(outputFile) == 0) && success;
+    }
+    if (!success) {
+        fprintf(stderr, "error: unable to write output file '%s'\n", outputFileName);
+    }
+    return success;
+}
+
 int main(int argc, char** argv) {
     int opt;
-    int inputFilesCount;
-    FILE** inputFiles;
-    FILE* outputFile = stdout;
-    char* outputFileName;
+    FadoInputs inputs;
+    FILE* outputFile = NULL;
+    char* outputFileName = NULL;
     char* dependencyFileName = NULL;
+    MidoOptions dependencyOptions = { MIDO_FORMAT_MAKE, false };
     char* ovlName = NULL;
-
+    FILE* verifyFile = NULL;
+    FILE* loadCostFile = NULL;
+    FILE* hotspotsFile = NULL;
+    size_t hotspotsCount = 20;
+    bool useJson = false;
+    bool literalSizes = false;
+    FILE* linkedElfFile = NULL;
+    int sizeErrors = 0;
+    int verifyErrors = 0;
+    bool useStats = false;
+    char* statsFileName = NULL;
+    char* traceFileName = NULL;
+    char* specFileName = NULL;
+    bool watch = false;
+    char* incrementalFileName = NULL;
+    bool link = false;
+    bool linkFailed = false;
+    bool outputFailed = false;
+    uint32_t linkVram = 0;
+    char* linkSymbolsFileName = NULL;
+    FairyContext context;
+
+    Fairy_InitContext(&context);
     ConstructLongOpts();
 
     if (argc < 2) {
-        printf(USAGE_STRING, argv[0]);
+        printf(USAGE_STRING, argv[0], argv[0]);
         fprintf(stderr, "No input file specified\n");
         return EXIT_FAILURE;
     }
@@ -121,39 +366,137 @@ int main(int argc, char** argv) {
         }
 
         switch (opt) {
+            case 'b': {
+                char* end;
+
+                link = true;
+                linkVram = strtoul(optarg, &end, 0);
+                if ((*optarg == '\0') || (*end != '\0')) {
+                    fprintf(stderr, "error: link address '%s' should be a number, e.g. 0x80800000\n", optarg);
+                    return EXIT_FAILURE;
+                }
+            } break;
+
+            case 'y':
+                linkSymbolsFileName = optarg;
+                break;
+
+            case 'c':
+                verifyFile = fopen(optarg, "rb");
+                if (verifyFile == NULL) {
+                    fprintf(stderr, "error: unable to open overlay file '%s' for reading\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+
+            case 'L':
+                literalSizes = true;
+                break;
+
+            case 'e':
+                linkedElfFile = fopen(optarg, "rb");
+                if (linkedElfFile == NULL) {
+                    fprintf(stderr, "error: unable to open linked ELF '%s' for reading\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+
+            case 'F':
+                if (strcmp(optarg, "make") == 0) {
+                    dependencyOptions.format = MIDO_FORMAT_MAKE;
+                } else if (strcmp(optarg, "ninja") == 0) {
+                    dependencyOptions.format = MIDO_FORMAT_NINJA;
+                } else {
+                    fprintf(stderr, "error: unknown dependency file format '%s', should be 'make' or 'ninja'\n",
+                            optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+
+            case 'H':
+                hotspotsFile = (strcmp(optarg, "-") == 0) ? stdout : fopen(optarg, "w");
+                if (hotspotsFile == NULL) {
+                    fprintf(stderr, "error: unable to open hotspot report '%s' for writing\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+
+            case 'i':
+                incrementalFileName = optarg;
+                break;
+
+            case 'k':
+                if (sscanf(optarg, "%zu", &hotspotsCount) == 0) {
+                    fprintf(stderr, "warning: top argument '%s' should be a nonnegative decimal integer\n", optarg);
+                }
+                break;
+
+            case 'j':
+                useJson = true;
+                break;
+
+            case 'l':
+                loadCostFile = fopen(optarg, "a");
+                if (loadCostFile == NULL) {
+                    fprintf(stderr, "error: unable to open load cost report '%s' for writing\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+
             case 'M':
                 dependencyFileName = optarg;
                 break;
 
+            case 'U':
+                dependencyOptions.writeIfChanged = true;
+                break;
+
             case 'n':
                 ovlName = optarg;
                 break;
 
             case 'o':
+                /* Only opened once it is known what will be written, since some modes leave it alone if unchanged */
                 outputFileName = optarg;
-                outputFile = fopen(optarg, "wb");
-                if (outputFile == NULL) {
-                    fprintf(stderr, "error: unable to open output file '%s' for writing\n", optarg);
-                    return EXIT_FAILURE;
-                }
+                break;
+
+            case 'S':
+                specFileName = optarg;
+                break;
+
+            case 's':
+                useStats = true;
+                statsFileName = optarg;
+                break;
+
+            case 't':
+                traceFileName = optarg;
+                break;
+
+            case 'w':
+                watch = true;
                 break;
 
             case 'v':
-                if (sscanf(optarg, "%u", &gVerbosity) == 0) {
+                if (sscanf(optarg, "%u", &context.verbosity) == 0) {
                     fprintf(stderr, "warning: verbosity argument '%s' should be a nonnegative decimal integer\n",
                             optarg);
                 }
                 break;
 
+            case 'K':
+                context.logStructured = true;
+                break;
+
             case 'a':
 #ifndef EXPERIMENTAL
                 goto not_experimental_err;
 #endif
-                gUseElfAlignment = true;
+                context.useElfAlignment = true;
                 break;
 
             case 'h':
-                printf(USAGE_STRING, argv[0]);
+                printf(USAGE_STRING, argv[0], argv[0]);
                 Help_PrintHelp(HELP_PROLOGUE, posArgCount, posArgInfo, optCount, optInfo, HELP_EPILOGUE);
                 return EXIT_FAILURE;
 
@@ -167,75 +510,348 @@ int main(int argc, char** argv) {
         }
     }
 
-    FAIRY_INFO_PRINTF("%s", "Options processed\n");
+    FAIRY_INFO_PRINTF(&context, "%s", "Options processed\n");
 
-    {
+    if (specFileName != NULL) {
+        SpecOptions specOptions = { &context, literalSizes, loadCostFile, &dependencyOptions, NULL };
+        MidoDependencyFile dependencies;
+        bool success;
+
+        if (optind != argc) {
+            fprintf(stderr, "error: input files cannot be given with --spec\n");
+            return EXIT_FAILURE;
+        }
+        if ((verifyFile != NULL) || (linkedElfFile != NULL) || (hotspotsFile != NULL) || (outputFileName != NULL) ||
+            (ovlName != NULL) || useStats || (traceFileName != NULL) || watch || link ||
+            (linkSymbolsFileName != NULL) || (incrementalFileName != NULL)) {
+            fprintf(stderr,
+                    "error: only --literal-sizes, --load-cost, the dependency file options and the logging "
+                    "options can be used with --spec\n");
+            return EXIT_FAILURE;
+        }
+
+        if (dependencyFileName != NULL) {
+            if (!Mido_Begin(&dependencies, &dependencyOptions)) {
+                fprintf(stderr, "error: unable to write dependency file '%s'\n", dependencyFileName);
+                return EXIT_FAILURE;
+            }
+            specOptions.dependencies = &dependencies;
+        }
+        success = ProcessSpec(specFileName, &specOptions);
+        if (specOptions.dependencies != NULL) {
+            /* Only replace the dependencies of a build that worked */
+            if (success) {
+                success = Mido_End(&dependencies, dependencyFileName);
+            } else {
+                fclose(dependencies.stream);
+                free(dependencies.contents);
+            }
+        }
+        if (loadCostFile != NULL) {
+            fclose(loadCostFile);
+        }
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (watch) {
+        FadoWatchOptions watchOptions;
+        char* filenameOvlName = NULL;
+        bool success;
         int i;
 
-        inputFilesCount = argc - optind;
-        if (inputFilesCount == 0) {
+        if (optind == argc) {
             fprintf(stderr, "No input files specified. Exiting.\n");
             return EXIT_FAILURE;
         }
+        for (i = optind; i < argc; i++) {
+            char* memberName;
+            char* archiveName = Fado_ArchiveSplitInput(argv[i], &memberName);
+
+            free(memberName);
+            free(archiveName);
+            if (archiveName != NULL) {
+                fprintf(stderr, "error: archive input '%s' cannot be watched\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        if (outputFileName == NULL) {
+            fprintf(stderr, "error: --watch needs an --output-file to regenerate\n");
+            return EXIT_FAILURE;
+        }
+        if ((verifyFile != NULL) || (linkedElfFile != NULL) || (hotspotsFile != NULL) || (loadCostFile != NULL) ||
+            useStats || (traceFileName != NULL) || link || (linkSymbolsFileName != NULL) ||
+            (incrementalFileName != NULL)) {
+            fprintf(stderr, "error: only --name, --literal-sizes, the dependency file options and the logging options "
+                            "can be used with --watch\n");
+            return EXIT_FAILURE;
+        }
+        /* The inputs do not change while watching, so neither do the dependencies */
+        if ((dependencyFileName != NULL) && !WriteDependencyFile(&dependencyOptions, dependencyFileName,
+                                                                 outputFileName, argc - optind, &argv[optind])) {
+            return EXIT_FAILURE;
+        }
 
-        inputFiles = malloc(inputFilesCount * sizeof(FILE*));
-        for (i = 0; i < inputFilesCount; i++) {
-            FAIRY_INFO_PRINTF("Using input file %s\n", argv[optind + i]);
-            inputFiles[i] = fopen(argv[optind + i], "rb");
-            if (inputFiles[i] == NULL) {
-                fprintf(stderr, "error: unable to open input file '%s' for reading\n", argv[optind + i]);
+        if (ovlName == NULL) {
+            ovlName = filenameOvlName = GetOverlayNameFromFilename(argv[optind]);
+        }
+        watchOptions.context = &context;
+        watchOptions.inputFilesCount = argc - optind;
+        watchOptions.inputFileNames = &argv[optind];
+        watchOptions.outputFileName = outputFileName;
+        watchOptions.ovlName = ovlName;
+        watchOptions.literalSizes = literalSizes;
+        success = Fado_Watch(&watchOptions);
+        free(filenameOvlName);
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (incrementalFileName != NULL) {
+        FadoIncrementalOptions incrementalOptions;
+        char* filenameOvlName = NULL;
+        bool success;
+        int i;
+
+        if (optind == argc) {
+            fprintf(stderr, "No input files specified. Exiting.\n");
+            return EXIT_FAILURE;
+        }
+        for (i = optind; i < argc; i++) {
+            char* memberName;
+            char* archiveName = Fado_ArchiveSplitInput(argv[i], &memberName);
+
+            free(memberName);
+            free(archiveName);
+            if (archiveName != NULL) {
+                fprintf(stderr, "error: archive input '%s' cannot be used with --incremental\n", argv[i]);
                 return EXIT_FAILURE;
             }
         }
+        if (outputFileName == NULL) {
+            fprintf(stderr, "error: --incremental needs an --output-file to regenerate\n");
+            return EXIT_FAILURE;
+        }
+        if ((verifyFile != NULL) || (linkedElfFile != NULL) || (hotspotsFile != NULL) || (loadCostFile != NULL) ||
+            useStats || (traceFileName != NULL) || link || (linkSymbolsFileName != NULL)) {
+            fprintf(stderr, "error: only --name, --literal-sizes, the dependency file options and the logging options "
+                            "can be used with --incremental\n");
+            return EXIT_FAILURE;
+        }
+        if (ovlName == NULL) {
+            ovlName = filenameOvlName = GetOverlayNameFromFilename(argv[optind]);
+        }
+        incrementalOptions.context = &context;
+        incrementalOptions.inputFilesCount = argc - optind;
+        incrementalOptions.inputFileNames = &argv[optind];
+        incrementalOptions.outputFileName = outputFileName;
+        incrementalOptions.sidecarFileName = incrementalFileName;
+        incrementalOptions.ovlName = ovlName;
+        incrementalOptions.literalSizes = literalSizes;
+        success = Fado_Incremental(&incrementalOptions);
+        free(filenameOvlName);
+
+        if (success && (dependencyFileName != NULL)) {
+            success = WriteDependencyFile(&dependencyOptions, dependencyFileName, outputFileName, argc - optind,
+                                          &argv[optind]);
+        }
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
 
-        FAIRY_INFO_PRINTF("Found %d input file%s\n", inputFilesCount, (inputFilesCount == 1 ? "" : "s"));
+    if ((linkSymbolsFileName != NULL) && !link) {
+        fprintf(stderr, "error: --link-symbols can only be used with --link\n");
+        return EXIT_FAILURE;
+    }
+    if (link && (verifyFile != NULL)) {
+        fprintf(stderr, "error: --link and --verify cannot be used together\n");
+        return EXIT_FAILURE;
+    }
 
-        if (ovlName == NULL) { // If a name has not been set using an arg
-            ovlName = GetOverlayNameFromFilename(argv[optind]);
-            Fado_Relocs(outputFile, inputFilesCount, inputFiles, ovlName);
-            free(ovlName);
-        } else {
-            Fado_Relocs(outputFile, inputFilesCount, inputFiles, ovlName);
+    {
+        int i;
+        FadoMemory memory;
+        FadoStats stats;
+        FadoIoStats ioStats;
+        FadoLinkSymbols linkSymbols;
+
+        if (optind == argc) {
+            fprintf(stderr, "No input files specified. Exiting.\n");
+            return EXIT_FAILURE;
+        }
+        if (!Fado_ExpandInputs(&inputs, argc - optind, &argv[optind])) {
+            Fado_FreeInputs(&inputs);
+            return EXIT_FAILURE;
+        }
+        if (inputs.count == 0) {
+            fprintf(stderr, "error: the archives given have no object files\n");
+            Fado_FreeInputs(&inputs);
+            return EXIT_FAILURE;
+        }
+
+        if (useStats || (traceFileName != NULL)) {
+            Fado_StatsInit(&stats, &context, inputs.count, traceFileName != NULL);
+            context.stats = &stats;
+        }
+
+        Fado_StatsBegin(context.stats, FADO_PHASE_OPEN);
+        for (i = 0; i < inputs.count; i++) {
+            FAIRY_INFO_PRINTF(&context, "Using input file %s\n", inputs.names[i]);
+        }
+        if (!Fado_OpenInputs(&inputs, true, &ioStats)) {
+            Fado_FreeInputs(&inputs);
+            return EXIT_FAILURE;
         }
+        Fado_StatsEnd(context.stats, FADO_PHASE_OPEN);
+        FAIRY_INFO_PRINTF(&context, "Prefetched %zu bytes in %zu reads in %zu batches with %s\n",
+                          ioStats.bytesPrefetched, ioStats.reads, ioStats.batches,
+                          ioStats.usedIoUring ? "io_uring" : "pread");
+
+        FAIRY_INFO_PRINTF(&context, "Found %d input file%s\n", inputs.count, (inputs.count == 1 ? "" : "s"));
+
+        if (linkSymbolsFileName != NULL) {
+            FILE* linkSymbolsFile = fopen(linkSymbolsFileName, "r");
+
+            if (linkSymbolsFile == NULL) {
+                fprintf(stderr, "error: unable to open link symbols file '%s' for reading\n", linkSymbolsFileName);
+                Fado_FreeInputs(&inputs);
+                return EXIT_FAILURE;
+            }
+            if (!Fado_ReadLinkSymbols(&linkSymbols, linkSymbolsFile, linkSymbolsFileName)) {
+                fclose(linkSymbolsFile);
+                Fado_FreeInputs(&inputs);
+                return EXIT_FAILURE;
+            }
+            fclose(linkSymbolsFile);
+        }
+
+        {
+            FadoOverlay overlay;
+            char* filenameOvlName = NULL;
+
+            if (ovlName == NULL) { // If a name has not been set using an arg
+                ovlName = filenameOvlName = GetOverlayNameFromFilename(argv[optind]);
+            }
+
+            Fado_MemoryInit(&memory, NULL);
+            Fado_StatsSetMemory(context.stats, &memory);
+
+            Fado_ExtractRelocsWithAllocators(&overlay, inputs.count, inputs.files, &context, memory.categories);
+            if (verifyFile != NULL) {
+                Fado_StatsBegin(context.stats, FADO_PHASE_OUTPUT);
+                verifyErrors = Fado_Verify(verifyFile, &overlay, ovlName);
+                fclose(verifyFile);
+                Fado_StatsEnd(context.stats, FADO_PHASE_OUTPUT);
+            } else if (link) {
+                /* Kept in memory until it is known to have worked, so a failed link leaves no output for make */
+                char* contents = NULL;
+                size_t size = 0;
+                FILE* stream = open_memstream(&contents, &size);
+
+                Fado_StatsBegin(context.stats, FADO_PHASE_OUTPUT);
+                linkFailed = (stream == NULL) ||
+                             !Fado_LinkOverlay(stream, &overlay, inputs.files, inputs.names, linkVram,
+                                               (linkSymbolsFileName != NULL) ? &linkSymbols : NULL);
+                if (stream != NULL) {
+                    fclose(stream);
+                }
+                if (!linkFailed) {
+                    outputFailed = !WriteOutputFile(outputFileName, contents, size);
+                }
+                free(contents);
+                Fado_StatsEnd(context.stats, FADO_PHASE_OUTPUT);
+            } else if ((outputFile = OpenOutputFile(outputFileName)) == NULL) {
+                outputFailed = true;
+            } else {
+                Fado_WriteRelocs(outputFile, &overlay, ovlName, literalSizes);
+            }
+            if (linkedElfFile != NULL) {
+                sizeErrors = Fado_CheckSizeSymbols(linkedElfFile, &overlay, ovlName);
+                fclose(linkedElfFile);
+            }
+            if (loadCostFile != NULL) {
+                FadoLoadCost cost;
 
-        for (i = 0; i < inputFilesCount; i++) {
-            fclose(inputFiles[i]);
+                Fado_EstimateLoadCost(&cost, &overlay);
+                fseek(loadCostFile, 0, SEEK_END);
+                if (ftell(loadCostFile) == 0) {
+                    Fado_WriteLoadCostHeader(loadCostFile);
+                }
+                Fado_WriteLoadCost(loadCostFile, &cost, ovlName);
+                fclose(loadCostFile);
+            }
+            if (hotspotsFile != NULL) {
+                Fado_WriteHotspots(hotspotsFile, &overlay, ovlName, inputs.names, hotspotsCount, useJson);
+                if (hotspotsFile != stdout) {
+                    fclose(hotspotsFile);
+                }
+            }
+            Fado_DestroyOverlay(&overlay);
+            FAIRY_INFO_PRINTF(&context,
+                              "Overlay memory: %zu allocations, %zu reallocations, peak %zu bytes, %zu bytes not "
+                              "freed\n",
+                              memory.total.alloc_count, memory.total.realloc_count, memory.total.peak_bytes,
+                              memory.total.current_bytes);
+
+            free(filenameOvlName);
+        }
+        if (linkSymbolsFileName != NULL) {
+            Fado_DestroyLinkSymbols(&linkSymbols);
         }
-        free(inputFiles);
-        if (outputFile != stdout) {
+
+        Fado_StatsBegin(context.stats, FADO_PHASE_TEARDOWN);
+        Fado_CloseInputs(&inputs);
+        if ((outputFile != NULL) && (outputFile != stdout)) {
             fclose(outputFile);
         }
+        Fado_StatsEnd(context.stats, FADO_PHASE_TEARDOWN);
+
+        if (useStats) {
+            if (statsFileName == NULL) {
+                Fado_StatsWrite(&stats, stderr, inputs.names);
+            } else {
+                FILE* statsFile = fopen(statsFileName, "w");
+
+                if (statsFile == NULL) {
+                    fprintf(stderr, "error: unable to open stats file '%s' for writing\n", statsFileName);
+                    return EXIT_FAILURE;
+                }
+                Fado_StatsWriteJson(&stats, statsFile, inputs.names);
+                fclose(statsFile);
+            }
+        }
+        if (traceFileName != NULL) {
+            FILE* traceFile = fopen(traceFileName, "w");
+
+            if (traceFile == NULL) {
+                fprintf(stderr, "error: unable to open trace file '%s' for writing\n", traceFileName);
+                return EXIT_FAILURE;
+            }
+            Fado_TraceWrite(&stats, traceFile, inputs.names);
+            fclose(traceFile);
+        }
+        if (context.stats != NULL) {
+            Fado_StatsDestroy(context.stats);
+            context.stats = NULL;
+        }
     }
 
     if (dependencyFileName != NULL) {
-        int fileNameLength = strlen(outputFileName);
-        char* objectFile = malloc((strlen(outputFileName) + 1) * sizeof(char));
-        vc_vector* inputFilesVector = vc_vector_create(inputFilesCount, sizeof(char*), NULL);
-        char* extensionStart;
-        FILE* dependencyFile = fopen(dependencyFileName, "w");
-
-        if (dependencyFile == NULL) {
-            fprintf(stderr, "error: unable to open dependency file '%s' for writing\n", dependencyFileName);
+        if (outputFileName == NULL) {
+            fprintf(stderr, "error: --make-dependency needs an --output-file to write the dependencies of\n");
             return EXIT_FAILURE;
         }
-
-        strcpy(objectFile, outputFileName);
-        extensionStart = strrchr(objectFile, '.');
-        if (extensionStart == objectFile + fileNameLength) {
-            fprintf(stderr, "error: file name should not end in a '.'\n");
+        if (linkSymbolsFileName != NULL) {
+            /* The binary also depends on the addresses it was linked with */
+            inputs.paths = realloc(inputs.paths, (inputs.pathCount + 1) * sizeof(char*));
+            inputs.paths[inputs.pathCount] = malloc(strlen(linkSymbolsFileName) + 1);
+            strcpy(inputs.paths[inputs.pathCount++], linkSymbolsFileName);
+        }
+        if (!WriteDependencyFile(&dependencyOptions, dependencyFileName, outputFileName, inputs.pathCount,
+                                 inputs.paths)) {
             return EXIT_FAILURE;
         }
-        strcpy(extensionStart, ".o");
-        vc_vector_append(inputFilesVector, &argv[optind], inputFilesCount);
-
-        Mido_WriteDependencyFile(dependencyFile, objectFile, inputFilesVector);
-
-        free(objectFile);
-        vc_vector_release(inputFilesVector);
-        fclose(dependencyFile);
     }
+    Fado_FreeInputs(&inputs);
 
-    return EXIT_SUCCESS;
+    return (verifyErrors == 0 && sizeErrors == 0 && !linkFailed && !outputFailed) ? EXIT_SUCCESS : EXIT_FAILURE;
 
     goto not_experimental_err; // silences a warning
 not_experimental_err:
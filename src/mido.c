@@ -1,20 +1,142 @@
+/**
+ * Writing Makefile and ninja dependency files
+ */
+#define _POSIX_C_SOURCE 200809L /* open_memstream */
 #include "mido.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "macros.h"
 #include "vc_vector/vc_vector.h"
 
-int Mido_WriteDependencyFile(FILE* dependencyFile, const char* relocFile, vc_vector* inputFilesVector) {
-    char** inputFile;
+/**
+ * Write a path escaped as both make and ninja expect: backslashes before spaces and '#', and '$' doubled
+ */
+static void Mido_WritePath(FILE* dependencyFile, const char* path) {
+    const char* c;
+
+    for (c = path; *c != '\0'; c++) {
+        switch (*c) {
+            case ' ':
+            case '#':
+                fputc('\\', dependencyFile);
+                fputc(*c, dependencyFile);
+                break;
+
+            case '$':
+                fputs("$$", dependencyFile);
+                break;
+
+            default:
+                fputc(*c, dependencyFile);
+                break;
+        }
+    }
+}
 
-    fprintf(dependencyFile, "%s:", relocFile);
+/**
+ * Write the rule for target depending on the input files, and for make an empty rule for each input, each followed by
+ * a blank line
+ */
+void Mido_WriteRule(FILE* dependencyFile, const char* target, int inputFilesCount, char** inputFiles,
+                    MidoFormat format) {
+    int i;
+
+    Mido_WritePath(dependencyFile, target);
+    fputc(':', dependencyFile);
+    for (i = 0; i < inputFilesCount; i++) {
+        fputc(' ', dependencyFile);
+        Mido_WritePath(dependencyFile, inputFiles[i]);
+    }
 
-    VC_FOREACH(inputFile, inputFilesVector) {
-        fprintf(dependencyFile, " %s", *inputFile);
+    if (format == MIDO_FORMAT_NINJA) {
+        fputc('\n', dependencyFile);
+        return;
     }
+
     fputs("\n\n", dependencyFile);
-    VC_FOREACH(inputFile, inputFilesVector) {
-        fprintf(dependencyFile, "%s:\n\n", *inputFile);
+    for (i = 0; i < inputFilesCount; i++) {
+        Mido_WritePath(dependencyFile, inputFiles[i]);
+        fputs(":\n\n", dependencyFile);
     }
+}
+
+int Mido_WriteDependencyFile(FILE* dependencyFile, const char* relocFile, vc_vector* inputFilesVector) {
+    Mido_WriteRule(dependencyFile, relocFile, vc_vector_count(inputFilesVector), vc_vector_begin(inputFilesVector),
+                   MIDO_FORMAT_MAKE);
     return 0;
 }
+
+/**
+ * Start a dependency file, to be written to disk by Mido_End once all its rules have been added
+ */
+bool Mido_Begin(MidoDependencyFile* dependencyFile, const MidoOptions* options) {
+    dependencyFile->options = options;
+    dependencyFile->contents = NULL;
+    dependencyFile->size = 0;
+    dependencyFile->stream = open_memstream(&dependencyFile->contents, &dependencyFile->size);
+    return dependencyFile->stream != NULL;
+}
+
+void Mido_AddRule(MidoDependencyFile* dependencyFile, const char* target, int inputFilesCount, char** inputFiles) {
+    Mido_WriteRule(dependencyFile->stream, target, inputFilesCount, inputFiles, dependencyFile->options->format);
+}
+
+/**
+ * Write the dependency file to fileName, if it has changed when the options ask for that, and free it
+ */
+bool Mido_End(MidoDependencyFile* dependencyFile, const char* fileName) {
+    bool success = true;
+
+    fclose(dependencyFile->stream);
+    if (dependencyFile->options->writeIfChanged) {
+        success = Mido_WriteFileIfChanged(fileName, dependencyFile->contents, dependencyFile->size) >= 0;
+    } else {
+        FILE* file = fopen(fileName, "w");
+
+        if (file == NULL) {
+            success = false;
+        } else {
+            success = (fwrite(dependencyFile->contents, 1, dependencyFile->size, file) == dependencyFile->size);
+            success = (fclose(file) == 0) && success;
+        }
+    }
+
+    if (!success) {
+        fprintf(stderr, "error: unable to write dependency file '%s'\n", fileName);
+    }
+    free(dependencyFile->contents);
+    return success;
+}
+
+/**
+ * Write contents to fileName unless it already has exactly those contents, so that its modification time only changes
+ * when it does. Returns 1 if it was written, 0 if it was left alone, and -1 on error.
+ */
+int Mido_WriteFileIfChanged(const char* fileName, const char* contents, size_t size) {
+    FILE* file = fopen(fileName, "rb");
+
+    if (file != NULL) {
+        char* existing = malloc(size + 1);
+        /* Read one more byte than expected, to tell if the file is longer */
+        bool same = (existing != NULL) && (fread(existing, 1, size + 1, file) == size) &&
+                    (memcmp(existing, contents, size) == 0);
+
+        free(existing);
+        fclose(file);
+        if (same) {
+            return 0;
+        }
+    }
+
+    file = fopen(fileName, "wb");
+    if (file == NULL) {
+        return -1;
+    }
+    if (fwrite(contents, 1, size, file) != size) {
+        fclose(file);
+        return -1;
+    }
+    return (fclose(file) == 0) ? 1 : -1;
+}
@@ -0,0 +1,213 @@
+/**
+ * Reading the segments of a Zelda 64 decomp spec file, to find every overlay and its objects
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* getline, strdup */
+#include "spec.h"
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fairy/fairy.h"
+
+#define SPEC_RELOC_SUFFIX "_reloc.o"
+
+static void Spec_DestroySegment(SpecSegment* segment) {
+    char** include;
+
+    free(segment->name);
+    VC_VECTOR_TYPED_FOREACH(include, &segment->includes) {
+        free(*include);
+    }
+    vc_vector_specPath_release(&segment->includes);
+}
+
+/**
+ * Parse the quoted string argument of a directive, which must be all that is left of the line. Returns a copy of it,
+ * or NULL if it is not one.
+ */
+static char* Spec_ParseString(const char* arg) {
+    const char* end;
+    char* string;
+
+    if (*arg != '"') {
+        return NULL;
+    }
+    arg++;
+    end = strchr(arg, '"');
+    if ((end == NULL) || (end[1] != '\0')) {
+        return NULL;
+    }
+
+    string = malloc(end - arg + 1);
+    memcpy(string, arg, end - arg);
+    string[end - arg] = '\0';
+    return string;
+}
+
+/**
+ * Remove a // comment and surrounding whitespace from line, returning the start of what remains
+ */
+static char* Spec_TrimLine(char* line) {
+    bool inString = false;
+    char* end;
+    char* c;
+
+    for (c = line; *c != '\0'; c++) {
+        if (*c == '"') {
+            inString = !inString;
+        } else if (!inString && (c[0] == '/') && (c[1] == '/')) {
+            *c = '\0';
+            break;
+        }
+    }
+
+    end = line + strlen(line);
+    while ((end > line) && isspace((unsigned char)end[-1])) {
+        *--end = '\0';
+    }
+    while (isspace((unsigned char)*line)) {
+        line++;
+    }
+    return line;
+}
+
+/**
+ * Read the segments of a spec file, after the C preprocessor has been run on it as for the build: lines starting with
+ * '#' are ignored, as are all directives other than beginseg, name, include and endseg. Errors are reported with
+ * fileName and the line, and leave spec empty.
+ */
+bool Spec_Read(Spec* spec, FILE* file, const char* fileName) {
+    SpecSegment segment;
+    bool inSegment = false;
+    bool success = true;
+    char* lineBuffer = NULL;
+    size_t lineBufferSize = 0;
+    int lineNumber = 0;
+
+    vc_vector_SpecSegment_init(&spec->segments, 0);
+
+    while (success && (getline(&lineBuffer, &lineBufferSize, file) != -1)) {
+        char* line = Spec_TrimLine(lineBuffer);
+        char* arg;
+
+        lineNumber++;
+        if ((*line == '\0') || (*line == '#')) {
+            continue;
+        }
+
+        /* Split the directive from its argument */
+        for (arg = line; (*arg != '\0') && !isspace((unsigned char)*arg); arg++) {}
+        if (*arg != '\0') {
+            *arg++ = '\0';
+            while (isspace((unsigned char)*arg)) {
+                arg++;
+            }
+        }
+
+        if (strcmp(line, "beginseg") == 0) {
+            if (inSegment) {
+                fprintf(stderr, "error: %s:%d: beginseg inside the segment begun on line %d\n", fileName, lineNumber,
+                        segment.line);
+                success = false;
+                break;
+            }
+            inSegment = true;
+            segment.name = NULL;
+            segment.line = lineNumber;
+            vc_vector_specPath_init(&segment.includes, 0);
+        } else if (strcmp(line, "endseg") == 0) {
+            if (!inSegment) {
+                fprintf(stderr, "error: %s:%d: endseg outside a segment\n", fileName, lineNumber);
+                success = false;
+            } else if (segment.name == NULL) {
+                fprintf(stderr, "error: %s:%d: segment has no name\n", fileName, segment.line);
+                success = false;
+            } else {
+                vc_vector_SpecSegment_push_back(&spec->segments, segment);
+                inSegment = false;
+            }
+        } else if ((strcmp(line, "name") == 0) || (strcmp(line, "include") == 0)) {
+            char* string;
+
+            if (!inSegment) {
+                fprintf(stderr, "error: %s:%d: %s outside a segment\n", fileName, lineNumber, line);
+                success = false;
+            } else if ((string = Spec_ParseString(arg)) == NULL) {
+                fprintf(stderr, "error: %s:%d: %s should be followed by a quoted string\n", fileName, lineNumber,
+                        line);
+                success = false;
+            } else if (line[0] == 'i') {
+                vc_vector_specPath_push_back(&segment.includes, string);
+            } else if (segment.name != NULL) {
+                fprintf(stderr, "error: %s:%d: segment already named \"%s\"\n", fileName, lineNumber, segment.name);
+                free(string);
+                success = false;
+            } else {
+                segment.name = string;
+            }
+        }
+    }
+
+    if (success && inSegment) {
+        fprintf(stderr, "error: %s: segment begun on line %d has no endseg\n", fileName, segment.line);
+        success = false;
+    }
+    if (inSegment) {
+        Spec_DestroySegment(&segment);
+    }
+    free(lineBuffer);
+
+    if (!success) {
+        Spec_Destroy(spec);
+        vc_vector_SpecSegment_init(&spec->segments, 0);
+    }
+    return success;
+}
+
+void Spec_Destroy(Spec* spec) {
+    SpecSegment* segment;
+
+    VC_VECTOR_TYPED_FOREACH(segment, &spec->segments) {
+        Spec_DestroySegment(segment);
+    }
+    vc_vector_SpecSegment_release(&spec->segments);
+}
+
+/**
+ * Overlay segments are those that include the object assembled from fado's output, named NAME_reloc.o. Returns that
+ * include, or NULL if segment is not an overlay.
+ */
+const char* Spec_GetRelocInclude(const SpecSegment* segment) {
+    size_t baseNameLength = strlen(segment->name) + strlen(SPEC_RELOC_SUFFIX);
+    char** include;
+
+    VC_VECTOR_TYPED_FOREACH(include, &segment->includes) {
+        size_t length = strlen(*include);
+        const char* baseName;
+
+        if (length < baseNameLength) {
+            continue;
+        }
+        baseName = *include + length - baseNameLength;
+        if (((baseName == *include) || (baseName[-1] == '/')) && Fairy_StartsWith(baseName, segment->name) &&
+            (strcmp(baseName + strlen(segment->name), SPEC_RELOC_SUFFIX) == 0)) {
+            return *include;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * The assembly file for fado to write, from which the reloc include is built: the same path ending in .s instead of
+ * .o. Must be freed.
+ */
+char* Spec_GetRelocOutput(const char* relocInclude) {
+    char* output = strdup(relocInclude);
+
+    output[strlen(output) - 1] = 's';
+    return output;
+}
@@ -0,0 +1,202 @@
+.section .ovl, "a"
+# rel_literalOverlayInfo
+.word 0x00000200 # _rel_literalSegmentTextSize
+.word 0x000000E0 # _rel_literalSegmentDataSize
+.word 0x00000060 # _rel_literalSegmentRoDataSize
+.word 0x00000020 # _rel_literalSegmentBssSize
+
+.word 186 # relocCount
+
+# TEXT RELOCS
+.word 0x45000000 # R_MIPS_HI16 0x000000 
+.word 0x46000004 # R_MIPS_LO16 0x000004 
+.word 0x44000008 # R_MIPS_26   0x000008 s0_12
+.word 0x44000014 # R_MIPS_26   0x000014 s0_9
+.word 0x45000018 # R_MIPS_HI16 0x000018 s0_7
+.word 0x4600001C # R_MIPS_LO16 0x00001C s0_7
+.word 0x44000020 # R_MIPS_26   0x000020 s0_12
+.word 0x45000024 # R_MIPS_HI16 0x000024 s0_7
+.word 0x46000028 # R_MIPS_LO16 0x000028 s0_7
+.word 0x4400002C # R_MIPS_26   0x00002C s0_12
+.word 0x45000030 # R_MIPS_HI16 0x000030 
+.word 0x46000034 # R_MIPS_LO16 0x000034 
+.word 0x44000038 # R_MIPS_26   0x000038 s0_6
+.word 0x4500003C # R_MIPS_HI16 0x00003C s0_3
+.word 0x46000040 # R_MIPS_LO16 0x000040 s0_3
+.word 0x44000044 # R_MIPS_26   0x000044 
+.word 0x45000048 # R_MIPS_HI16 0x000048 s1_5
+.word 0x4600004C # R_MIPS_LO16 0x00004C s1_5
+.word 0x44000050 # R_MIPS_26   0x000050 s0_12
+.word 0x45000054 # R_MIPS_HI16 0x000054 s0_8
+.word 0x46000058 # R_MIPS_LO16 0x000058 s0_8
+.word 0x4400005C # R_MIPS_26   0x00005C s0_7
+.word 0x45000060 # R_MIPS_HI16 0x000060 s0_15
+.word 0x46000064 # R_MIPS_LO16 0x000064 s0_15
+.word 0x44000068 # R_MIPS_26   0x000068 s1_8
+.word 0x4500006C # R_MIPS_HI16 0x00006C s0_14
+.word 0x46000070 # R_MIPS_LO16 0x000070 s0_14
+.word 0x44000074 # R_MIPS_26   0x000074 s0_8
+.word 0x45000078 # R_MIPS_HI16 0x000078 s0_5
+.word 0x4600007C # R_MIPS_LO16 0x00007C s0_5
+.word 0x44000080 # R_MIPS_26   0x000080 s0_9
+.word 0x45000084 # R_MIPS_HI16 0x000084 s0_3
+.word 0x46000088 # R_MIPS_LO16 0x000088 s0_3
+.word 0x4400008C # R_MIPS_26   0x00008C s0_5
+.word 0x45000090 # R_MIPS_HI16 0x000090 s0_12
+.word 0x46000094 # R_MIPS_LO16 0x000094 s0_12
+.word 0x44000098 # R_MIPS_26   0x000098 s1_1
+.word 0x4500009C # R_MIPS_HI16 0x00009C s0_14
+.word 0x460000A0 # R_MIPS_LO16 0x0000A0 s0_14
+.word 0x440000A4 # R_MIPS_26   0x0000A4 s0_7
+.word 0x440000B0 # R_MIPS_26   0x0000B0 s0_1
+.word 0x450000B4 # R_MIPS_HI16 0x0000B4 s0_8
+.word 0x460000B8 # R_MIPS_LO16 0x0000B8 s0_8
+.word 0x440000BC # R_MIPS_26   0x0000BC s0_6
+.word 0x450000C0 # R_MIPS_HI16 0x0000C0 s0_5
+.word 0x460000C4 # R_MIPS_LO16 0x0000C4 s0_5
+.word 0x440000C8 # R_MIPS_26   0x0000C8 s0_13
+.word 0x450000CC # R_MIPS_HI16 0x0000CC s0_3
+.word 0x460000D0 # R_MIPS_LO16 0x0000D0 s0_3
+.word 0x440000D4 # R_MIPS_26   0x0000D4 s1_0
+.word 0x450000D8 # R_MIPS_HI16 0x0000D8 
+.word 0x460000DC # R_MIPS_LO16 0x0000DC 
+.word 0x440000E0 # R_MIPS_26   0x0000E0 s0_11
+.word 0x450000E4 # R_MIPS_HI16 0x0000E4 s0_3
+.word 0x460000E8 # R_MIPS_LO16 0x0000E8 s0_3
+.word 0x440000EC # R_MIPS_26   0x0000EC s1_5
+.word 0x450000F0 # R_MIPS_HI16 0x0000F0 s0_10
+.word 0x460000F4 # R_MIPS_LO16 0x0000F4 s0_10
+.word 0x440000F8 # R_MIPS_26   0x0000F8 s0_12
+.word 0x45000100 # R_MIPS_HI16 0x000100 
+.word 0x46000104 # R_MIPS_LO16 0x000104 
+.word 0x44000108 # R_MIPS_26   0x000108 s1_2
+.word 0x4500010C # R_MIPS_HI16 0x00010C s1_2
+.word 0x46000110 # R_MIPS_LO16 0x000110 s1_2
+.word 0x44000114 # R_MIPS_26   0x000114 s1_8
+.word 0x45000118 # R_MIPS_HI16 0x000118 s1_1
+.word 0x4600011C # R_MIPS_LO16 0x00011C s1_1
+.word 0x44000120 # R_MIPS_26   0x000120 s0_9
+.word 0x45000124 # R_MIPS_HI16 0x000124 s1_14
+.word 0x46000128 # R_MIPS_LO16 0x000128 s1_14
+.word 0x4400012C # R_MIPS_26   0x00012C s1_14
+.word 0x45000130 # R_MIPS_HI16 0x000130 s0_5
+.word 0x46000134 # R_MIPS_LO16 0x000134 s0_5
+.word 0x44000138 # R_MIPS_26   0x000138 s1_5
+.word 0x4500013C # R_MIPS_HI16 0x00013C s1_4
+.word 0x46000140 # R_MIPS_LO16 0x000140 s1_4
+.word 0x44000144 # R_MIPS_26   0x000144 s1_8
+.word 0x45000148 # R_MIPS_HI16 0x000148 s1_12
+.word 0x4600014C # R_MIPS_LO16 0x00014C s1_12
+.word 0x44000150 # R_MIPS_26   0x000150 
+.word 0x4400015C # R_MIPS_26   0x00015C 
+.word 0x45000160 # R_MIPS_HI16 0x000160 s1_12
+.word 0x46000164 # R_MIPS_LO16 0x000164 s1_12
+.word 0x44000168 # R_MIPS_26   0x000168 s1_3
+.word 0x4500016C # R_MIPS_HI16 0x00016C s0_2
+.word 0x46000170 # R_MIPS_LO16 0x000170 s0_2
+.word 0x44000174 # R_MIPS_26   0x000174 s1_11
+.word 0x45000178 # R_MIPS_HI16 0x000178 s1_4
+.word 0x4600017C # R_MIPS_LO16 0x00017C s1_4
+.word 0x44000180 # R_MIPS_26   0x000180 s1_1
+.word 0x45000184 # R_MIPS_HI16 0x000184 s1_13
+.word 0x46000188 # R_MIPS_LO16 0x000188 s1_13
+.word 0x45000190 # R_MIPS_HI16 0x000190 s0_13
+.word 0x46000194 # R_MIPS_LO16 0x000194 s0_13
+.word 0x44000198 # R_MIPS_26   0x000198 s1_6
+.word 0x4500019C # R_MIPS_HI16 0x00019C s0_9
+.word 0x460001A0 # R_MIPS_LO16 0x0001A0 s0_9
+.word 0x440001A4 # R_MIPS_26   0x0001A4 s1_15
+.word 0x450001A8 # R_MIPS_HI16 0x0001A8 s0_13
+.word 0x460001AC # R_MIPS_LO16 0x0001AC s0_13
+.word 0x440001B0 # R_MIPS_26   0x0001B0 s1_2
+.word 0x450001B4 # R_MIPS_HI16 0x0001B4 
+.word 0x460001B8 # R_MIPS_LO16 0x0001B8 
+.word 0x450001C0 # R_MIPS_HI16 0x0001C0 s1_13
+.word 0x460001C4 # R_MIPS_LO16 0x0001C4 s1_13
+.word 0x440001C8 # R_MIPS_26   0x0001C8 
+.word 0x440001D4 # R_MIPS_26   0x0001D4 s1_7
+.word 0x450001D8 # R_MIPS_HI16 0x0001D8 s1_10
+.word 0x460001DC # R_MIPS_LO16 0x0001DC s1_10
+.word 0x440001E0 # R_MIPS_26   0x0001E0 s1_9
+.word 0x450001E4 # R_MIPS_HI16 0x0001E4 
+.word 0x460001E8 # R_MIPS_LO16 0x0001E8 
+.word 0x440001EC # R_MIPS_26   0x0001EC s1_8
+.word 0x450001F0 # R_MIPS_HI16 0x0001F0 s1_11
+.word 0x460001F4 # R_MIPS_LO16 0x0001F4 s1_11
+.word 0x440001F8 # R_MIPS_26   0x0001F8 s1_8
+
+# DATA RELOCS
+.word 0x82000000 # R_MIPS_32   0x000000 s0_14
+.word 0x82000004 # R_MIPS_32   0x000004 s0_11
+.word 0x82000008 # R_MIPS_32   0x000008 s0_15
+.word 0x8200000C # R_MIPS_32   0x00000C 
+.word 0x82000010 # R_MIPS_32   0x000010 s0_3
+.word 0x82000014 # R_MIPS_32   0x000014 s0_2
+.word 0x82000018 # R_MIPS_32   0x000018 s0_8
+.word 0x8200001C # R_MIPS_32   0x00001C s0_10
+.word 0x82000020 # R_MIPS_32   0x000020 s0_12
+.word 0x82000024 # R_MIPS_32   0x000024 s0_9
+.word 0x82000028 # R_MIPS_32   0x000028 s0_2
+.word 0x8200002C # R_MIPS_32   0x00002C s0_9
+.word 0x82000030 # R_MIPS_32   0x000030 s0_12
+.word 0x82000034 # R_MIPS_32   0x000034 s0_3
+.word 0x82000038 # R_MIPS_32   0x000038 s0_3
+.word 0x8200003C # R_MIPS_32   0x00003C s0_8
+.word 0x82000040 # R_MIPS_32   0x000040 s0_5
+.word 0x82000044 # R_MIPS_32   0x000044 s0_0
+.word 0x82000048 # R_MIPS_32   0x000048 s1_12
+.word 0x8200004C # R_MIPS_32   0x00004C s0_11
+.word 0x82000054 # R_MIPS_32   0x000054 s0_6
+.word 0x82000058 # R_MIPS_32   0x000058 s0_8
+.word 0x8200005C # R_MIPS_32   0x00005C s0_8
+.word 0x82000060 # R_MIPS_32   0x000060 s0_14
+.word 0x82000070 # R_MIPS_32   0x000070 s1_14
+.word 0x82000074 # R_MIPS_32   0x000074 s1_5
+.word 0x82000078 # R_MIPS_32   0x000078 s1_7
+.word 0x82000080 # R_MIPS_32   0x000080 s1_14
+.word 0x82000084 # R_MIPS_32   0x000084 s1_9
+.word 0x82000088 # R_MIPS_32   0x000088 
+.word 0x8200008C # R_MIPS_32   0x00008C s0_8
+.word 0x82000090 # R_MIPS_32   0x000090 s1_10
+.word 0x82000094 # R_MIPS_32   0x000094 s1_4
+.word 0x82000098 # R_MIPS_32   0x000098 s1_14
+.word 0x8200009C # R_MIPS_32   0x00009C s1_2
+.word 0x820000A0 # R_MIPS_32   0x0000A0 s1_0
+.word 0x820000A4 # R_MIPS_32   0x0000A4 s1_11
+.word 0x820000AC # R_MIPS_32   0x0000AC s1_12
+.word 0x820000B0 # R_MIPS_32   0x0000B0 s1_13
+.word 0x820000B4 # R_MIPS_32   0x0000B4 s1_13
+.word 0x820000B8 # R_MIPS_32   0x0000B8 s1_11
+.word 0x820000BC # R_MIPS_32   0x0000BC s1_1
+.word 0x820000C0 # R_MIPS_32   0x0000C0 s1_0
+.word 0x820000C4 # R_MIPS_32   0x0000C4 s1_4
+.word 0x820000C8 # R_MIPS_32   0x0000C8 s1_15
+.word 0x820000CC # R_MIPS_32   0x0000CC s1_14
+.word 0x820000D0 # R_MIPS_32   0x0000D0 s1_9
+
+# RODATA RELOCS
+.word 0xC2000000 # R_MIPS_32   0x000000 s0_2
+.word 0xC2000004 # R_MIPS_32   0x000004 s1_2
+.word 0xC2000008 # R_MIPS_32   0x000008 s0_13
+.word 0xC200000C # R_MIPS_32   0x00000C s0_5
+.word 0xC2000010 # R_MIPS_32   0x000010 s0_8
+.word 0xC2000014 # R_MIPS_32   0x000014 s1_5
+.word 0xC2000018 # R_MIPS_32   0x000018 s1_10
+.word 0xC200001C # R_MIPS_32   0x00001C s0_1
+.word 0xC2000020 # R_MIPS_32   0x000020 
+.word 0xC2000024 # R_MIPS_32   0x000024 s0_8
+.word 0xC2000028 # R_MIPS_32   0x000028 
+.word 0xC200002C # R_MIPS_32   0x00002C 
+.word 0xC2000030 # R_MIPS_32   0x000030 s1_0
+.word 0xC2000034 # R_MIPS_32   0x000034 s1_8
+.word 0xC2000038 # R_MIPS_32   0x000038 s1_11
+.word 0xC200003C # R_MIPS_32   0x00003C s1_8
+.word 0xC2000040 # R_MIPS_32   0x000040 
+.word 0xC2000044 # R_MIPS_32   0x000044 
+.word 0xC2000048 # R_MIPS_32   0x000048 s1_9
+.word 0xC2000050 # R_MIPS_32   0x000050 
+.word 0xC2000054 # R_MIPS_32   0x000054 s1_14
+.word 0xC2000058 # R_MIPS_32   0x000058 s1_2
+.word 0xC200005C # R_MIPS_32   0x00005C 
+
+.word 0x00000300 # rel_literalOverlayInfoOffset
@@ -0,0 +1,390 @@
+.section .ovl, "a"
+# rel_multiOverlayInfo
+.word _rel_multiSegmentTextSize
+.word _rel_multiSegmentDataSize
+.word _rel_multiSegmentRoDataSize
+.word _rel_multiSegmentBssSize
+
+.word 373 # relocCount
+
+# TEXT RELOCS
+.word 0x45000000 # R_MIPS_HI16 0x000000 s0_7
+.word 0x46000004 # R_MIPS_LO16 0x000004 s0_7
+.word 0x44000008 # R_MIPS_26   0x000008 s0_10
+.word 0x4500000C # R_MIPS_HI16 0x00000C s0_12
+.word 0x46000010 # R_MIPS_LO16 0x000010 s0_12
+.word 0x44000014 # R_MIPS_26   0x000014 s0_12
+.word 0x45000018 # R_MIPS_HI16 0x000018 s0_6
+.word 0x4600001C # R_MIPS_LO16 0x00001C s0_6
+.word 0x44000020 # R_MIPS_26   0x000020 s0_14
+.word 0x45000024 # R_MIPS_HI16 0x000024 s0_9
+.word 0x46000028 # R_MIPS_LO16 0x000028 s0_9
+.word 0x4400002C # R_MIPS_26   0x00002C 
+.word 0x45000030 # R_MIPS_HI16 0x000030 s0_11
+.word 0x46000034 # R_MIPS_LO16 0x000034 s0_11
+.word 0x44000038 # R_MIPS_26   0x000038 s0_1
+.word 0x4500003C # R_MIPS_HI16 0x00003C s0_12
+.word 0x46000040 # R_MIPS_LO16 0x000040 s0_12
+.word 0x44000044 # R_MIPS_26   0x000044 s3_3
+.word 0x45000048 # R_MIPS_HI16 0x000048 s0_0
+.word 0x4600004C # R_MIPS_LO16 0x00004C s0_0
+.word 0x44000050 # R_MIPS_26   0x000050 s3_3
+.word 0x45000054 # R_MIPS_HI16 0x000054 s2_4
+.word 0x46000058 # R_MIPS_LO16 0x000058 s2_4
+.word 0x4400005C # R_MIPS_26   0x00005C 
+.word 0x45000060 # R_MIPS_HI16 0x000060 s2_3
+.word 0x46000064 # R_MIPS_LO16 0x000064 s2_3
+.word 0x44000068 # R_MIPS_26   0x000068 s0_3
+.word 0x44000074 # R_MIPS_26   0x000074 s3_0
+.word 0x45000078 # R_MIPS_HI16 0x000078 s1_2
+.word 0x4600007C # R_MIPS_LO16 0x00007C s1_2
+.word 0x44000080 # R_MIPS_26   0x000080 s0_9
+.word 0x45000084 # R_MIPS_HI16 0x000084 
+.word 0x46000088 # R_MIPS_LO16 0x000088 
+.word 0x4400008C # R_MIPS_26   0x00008C s0_6
+.word 0x45000090 # R_MIPS_HI16 0x000090 s0_1
+.word 0x46000094 # R_MIPS_LO16 0x000094 s0_1
+.word 0x44000098 # R_MIPS_26   0x000098 s0_9
+.word 0x4500009C # R_MIPS_HI16 0x00009C s3_4
+.word 0x460000A0 # R_MIPS_LO16 0x0000A0 s3_4
+.word 0x450000A8 # R_MIPS_HI16 0x0000A8 s1_4
+.word 0x460000AC # R_MIPS_LO16 0x0000AC s1_4
+.word 0x440000B0 # R_MIPS_26   0x0000B0 s2_0
+.word 0x450000B4 # R_MIPS_HI16 0x0000B4 s0_0
+.word 0x460000B8 # R_MIPS_LO16 0x0000B8 s0_0
+.word 0x440000BC # R_MIPS_26   0x0000BC s3_0
+.word 0x450000C0 # R_MIPS_HI16 0x0000C0 s0_11
+.word 0x460000C4 # R_MIPS_LO16 0x0000C4 s0_11
+.word 0x440000C8 # R_MIPS_26   0x0000C8 s2_3
+.word 0x450000CC # R_MIPS_HI16 0x0000CC s0_8
+.word 0x460000D0 # R_MIPS_LO16 0x0000D0 s0_8
+.word 0x440000D4 # R_MIPS_26   0x0000D4 s3_4
+.word 0x450000D8 # R_MIPS_HI16 0x0000D8 s1_3
+.word 0x460000DC # R_MIPS_LO16 0x0000DC s1_3
+.word 0x440000E0 # R_MIPS_26   0x0000E0 s3_3
+.word 0x450000E4 # R_MIPS_HI16 0x0000E4 s0_15
+.word 0x460000E8 # R_MIPS_LO16 0x0000E8 s0_15
+.word 0x440000EC # R_MIPS_26   0x0000EC s2_2
+.word 0x450000F0 # R_MIPS_HI16 0x0000F0 
+.word 0x460000F4 # R_MIPS_LO16 0x0000F4 
+.word 0x440000F8 # R_MIPS_26   0x0000F8 s0_0
+.word 0x45000100 # R_MIPS_HI16 0x000100 s0_4
+.word 0x46000104 # R_MIPS_LO16 0x000104 s0_4
+.word 0x44000108 # R_MIPS_26   0x000108 s1_8
+.word 0x4500010C # R_MIPS_HI16 0x00010C s3_3
+.word 0x46000110 # R_MIPS_LO16 0x000110 s3_3
+.word 0x44000114 # R_MIPS_26   0x000114 s1_11
+.word 0x45000118 # R_MIPS_HI16 0x000118 
+.word 0x4600011C # R_MIPS_LO16 0x00011C 
+.word 0x44000120 # R_MIPS_26   0x000120 s1_11
+.word 0x45000124 # R_MIPS_HI16 0x000124 
+.word 0x46000128 # R_MIPS_LO16 0x000128 
+.word 0x4400012C # R_MIPS_26   0x00012C s0_4
+.word 0x45000130 # R_MIPS_HI16 0x000130 s1_8
+.word 0x46000134 # R_MIPS_LO16 0x000134 s1_8
+.word 0x44000138 # R_MIPS_26   0x000138 s2_2
+.word 0x4500013C # R_MIPS_HI16 0x00013C s2_3
+.word 0x46000140 # R_MIPS_LO16 0x000140 s2_3
+.word 0x44000144 # R_MIPS_26   0x000144 s1_7
+.word 0x45000148 # R_MIPS_HI16 0x000148 s3_0
+.word 0x4600014C # R_MIPS_LO16 0x00014C s3_0
+.word 0x44000150 # R_MIPS_26   0x000150 s1_14
+.word 0x45000154 # R_MIPS_HI16 0x000154 
+.word 0x46000158 # R_MIPS_LO16 0x000158 
+.word 0x4400015C # R_MIPS_26   0x00015C s1_6
+.word 0x45000160 # R_MIPS_HI16 0x000160 s1_6
+.word 0x46000164 # R_MIPS_LO16 0x000164 s1_6
+.word 0x44000168 # R_MIPS_26   0x000168 s0_1
+.word 0x4500016C # R_MIPS_HI16 0x00016C s1_2
+.word 0x46000170 # R_MIPS_LO16 0x000170 s1_2
+.word 0x44000174 # R_MIPS_26   0x000174 s0_4
+.word 0x45000178 # R_MIPS_HI16 0x000178 s1_11
+.word 0x4600017C # R_MIPS_LO16 0x00017C s1_11
+.word 0x44000180 # R_MIPS_26   0x000180 s1_2
+.word 0x45000184 # R_MIPS_HI16 0x000184 s1_6
+.word 0x46000188 # R_MIPS_LO16 0x000188 s1_6
+.word 0x4400018C # R_MIPS_26   0x00018C 
+.word 0x45000190 # R_MIPS_HI16 0x000190 s1_2
+.word 0x46000194 # R_MIPS_LO16 0x000194 s1_2
+.word 0x44000198 # R_MIPS_26   0x000198 s3_1
+.word 0x440001A4 # R_MIPS_26   0x0001A4 s1_2
+.word 0x440001B0 # R_MIPS_26   0x0001B0 s1_11
+.word 0x450001B4 # R_MIPS_HI16 0x0001B4 s1_3
+.word 0x460001B8 # R_MIPS_LO16 0x0001B8 s1_3
+.word 0x440001BC # R_MIPS_26   0x0001BC s1_1
+.word 0x450001C0 # R_MIPS_HI16 0x0001C0 s1_3
+.word 0x460001C4 # R_MIPS_LO16 0x0001C4 s1_3
+.word 0x440001C8 # R_MIPS_26   0x0001C8 s1_7
+.word 0x450001CC # R_MIPS_HI16 0x0001CC s0_3
+.word 0x460001D0 # R_MIPS_LO16 0x0001D0 s0_3
+.word 0x440001D4 # R_MIPS_26   0x0001D4 s3_0
+.word 0x450001D8 # R_MIPS_HI16 0x0001D8 
+.word 0x460001DC # R_MIPS_LO16 0x0001DC 
+.word 0x440001E0 # R_MIPS_26   0x0001E0 s1_8
+.word 0x450001E4 # R_MIPS_HI16 0x0001E4 s1_0
+.word 0x460001E8 # R_MIPS_LO16 0x0001E8 s1_0
+.word 0x440001EC # R_MIPS_26   0x0001EC s1_10
+.word 0x450001F0 # R_MIPS_HI16 0x0001F0 s3_3
+.word 0x460001F4 # R_MIPS_LO16 0x0001F4 s3_3
+.word 0x44000208 # R_MIPS_26   0x000208 s2_13
+.word 0x4500020C # R_MIPS_HI16 0x00020C s2_9
+.word 0x46000210 # R_MIPS_LO16 0x000210 s2_9
+.word 0x44000214 # R_MIPS_26   0x000214 s2_5
+.word 0x45000218 # R_MIPS_HI16 0x000218 s2_7
+.word 0x4600021C # R_MIPS_LO16 0x00021C s2_7
+.word 0x44000220 # R_MIPS_26   0x000220 s2_4
+.word 0x45000224 # R_MIPS_HI16 0x000224 s1_3
+.word 0x46000228 # R_MIPS_LO16 0x000228 s1_3
+.word 0x4400022C # R_MIPS_26   0x00022C s2_12
+.word 0x45000230 # R_MIPS_HI16 0x000230 s2_13
+.word 0x46000234 # R_MIPS_LO16 0x000234 s2_13
+.word 0x44000238 # R_MIPS_26   0x000238 s3_4
+.word 0x4500023C # R_MIPS_HI16 0x00023C s1_2
+.word 0x46000240 # R_MIPS_LO16 0x000240 s1_2
+.word 0x44000244 # R_MIPS_26   0x000244 s2_12
+.word 0x45000248 # R_MIPS_HI16 0x000248 
+.word 0x4600024C # R_MIPS_LO16 0x00024C 
+.word 0x44000250 # R_MIPS_26   0x000250 s2_1
+.word 0x45000254 # R_MIPS_HI16 0x000254 s2_13
+.word 0x46000258 # R_MIPS_LO16 0x000258 s2_13
+.word 0x4400025C # R_MIPS_26   0x00025C 
+.word 0x45000260 # R_MIPS_HI16 0x000260 
+.word 0x46000264 # R_MIPS_LO16 0x000264 
+.word 0x44000268 # R_MIPS_26   0x000268 s3_0
+.word 0x4500026C # R_MIPS_HI16 0x00026C s2_13
+.word 0x46000270 # R_MIPS_LO16 0x000270 s2_13
+.word 0x44000274 # R_MIPS_26   0x000274 
+.word 0x45000278 # R_MIPS_HI16 0x000278 
+.word 0x4600027C # R_MIPS_LO16 0x00027C 
+.word 0x44000280 # R_MIPS_26   0x000280 s3_4
+.word 0x45000284 # R_MIPS_HI16 0x000284 s3_5
+.word 0x46000288 # R_MIPS_LO16 0x000288 s3_5
+.word 0x4400028C # R_MIPS_26   0x00028C s2_10
+.word 0x45000290 # R_MIPS_HI16 0x000290 s2_7
+.word 0x46000294 # R_MIPS_LO16 0x000294 s2_7
+.word 0x4500029C # R_MIPS_HI16 0x00029C s3_1
+.word 0x460002A0 # R_MIPS_LO16 0x0002A0 s3_1
+.word 0x450002A8 # R_MIPS_HI16 0x0002A8 
+.word 0x460002AC # R_MIPS_LO16 0x0002AC 
+.word 0x450002B4 # R_MIPS_HI16 0x0002B4 s2_13
+.word 0x460002B8 # R_MIPS_LO16 0x0002B8 s2_13
+.word 0x440002BC # R_MIPS_26   0x0002BC s2_10
+.word 0x450002C0 # R_MIPS_HI16 0x0002C0 s2_12
+.word 0x460002C4 # R_MIPS_LO16 0x0002C4 s2_12
+.word 0x440002C8 # R_MIPS_26   0x0002C8 s2_14
+.word 0x450002CC # R_MIPS_HI16 0x0002CC s2_1
+.word 0x460002D0 # R_MIPS_LO16 0x0002D0 s2_1
+.word 0x450002D8 # R_MIPS_HI16 0x0002D8 s2_0
+.word 0x460002DC # R_MIPS_LO16 0x0002DC s2_0
+.word 0x440002E0 # R_MIPS_26   0x0002E0 s1_0
+.word 0x450002E4 # R_MIPS_HI16 0x0002E4 s2_5
+.word 0x460002E8 # R_MIPS_LO16 0x0002E8 s2_5
+.word 0x440002EC # R_MIPS_26   0x0002EC s1_0
+.word 0x450002F0 # R_MIPS_HI16 0x0002F0 s2_8
+.word 0x460002F4 # R_MIPS_LO16 0x0002F4 s2_8
+.word 0x44000308 # R_MIPS_26   0x000308 s1_2
+.word 0x4500030C # R_MIPS_HI16 0x00030C s1_2
+.word 0x46000310 # R_MIPS_LO16 0x000310 s1_2
+.word 0x44000314 # R_MIPS_26   0x000314 s3_1
+.word 0x45000318 # R_MIPS_HI16 0x000318 s1_1
+.word 0x4600031C # R_MIPS_LO16 0x00031C s1_1
+.word 0x45000324 # R_MIPS_HI16 0x000324 s3_13
+.word 0x46000328 # R_MIPS_LO16 0x000328 s3_13
+.word 0x4400032C # R_MIPS_26   0x00032C s3_8
+.word 0x45000330 # R_MIPS_HI16 0x000330 s3_4
+.word 0x46000334 # R_MIPS_LO16 0x000334 s3_4
+.word 0x44000338 # R_MIPS_26   0x000338 s3_0
+.word 0x4500033C # R_MIPS_HI16 0x00033C s3_1
+.word 0x46000340 # R_MIPS_LO16 0x000340 s3_1
+.word 0x45000348 # R_MIPS_HI16 0x000348 s3_6
+.word 0x4600034C # R_MIPS_LO16 0x00034C s3_6
+.word 0x44000350 # R_MIPS_26   0x000350 s1_4
+.word 0x45000354 # R_MIPS_HI16 0x000354 
+.word 0x46000358 # R_MIPS_LO16 0x000358 
+.word 0x4400035C # R_MIPS_26   0x00035C s3_11
+.word 0x45000360 # R_MIPS_HI16 0x000360 s3_8
+.word 0x46000364 # R_MIPS_LO16 0x000364 s3_8
+.word 0x44000368 # R_MIPS_26   0x000368 s2_4
+.word 0x4500036C # R_MIPS_HI16 0x00036C s3_5
+.word 0x46000370 # R_MIPS_LO16 0x000370 s3_5
+.word 0x44000374 # R_MIPS_26   0x000374 s3_3
+.word 0x45000378 # R_MIPS_HI16 0x000378 s2_1
+.word 0x4600037C # R_MIPS_LO16 0x00037C s2_1
+.word 0x44000380 # R_MIPS_26   0x000380 s3_4
+.word 0x45000384 # R_MIPS_HI16 0x000384 s3_5
+.word 0x46000388 # R_MIPS_LO16 0x000388 s3_5
+.word 0x4400038C # R_MIPS_26   0x00038C s3_8
+.word 0x45000390 # R_MIPS_HI16 0x000390 s0_0
+.word 0x46000394 # R_MIPS_LO16 0x000394 s0_0
+.word 0x44000398 # R_MIPS_26   0x000398 s3_10
+.word 0x4500039C # R_MIPS_HI16 0x00039C s2_3
+.word 0x460003A0 # R_MIPS_LO16 0x0003A0 s2_3
+.word 0x440003A4 # R_MIPS_26   0x0003A4 s3_9
+.word 0x450003A8 # R_MIPS_HI16 0x0003A8 s3_2
+.word 0x460003AC # R_MIPS_LO16 0x0003AC s3_2
+.word 0x440003B0 # R_MIPS_26   0x0003B0 s2_1
+.word 0x450003B4 # R_MIPS_HI16 0x0003B4 s0_3
+.word 0x460003B8 # R_MIPS_LO16 0x0003B8 s0_3
+.word 0x440003BC # R_MIPS_26   0x0003BC s3_13
+.word 0x450003C0 # R_MIPS_HI16 0x0003C0 s3_0
+.word 0x460003C4 # R_MIPS_LO16 0x0003C4 s3_0
+.word 0x440003C8 # R_MIPS_26   0x0003C8 
+.word 0x450003CC # R_MIPS_HI16 0x0003CC s1_3
+.word 0x460003D0 # R_MIPS_LO16 0x0003D0 s1_3
+.word 0x440003D4 # R_MIPS_26   0x0003D4 s2_0
+.word 0x450003D8 # R_MIPS_HI16 0x0003D8 s3_4
+.word 0x460003DC # R_MIPS_LO16 0x0003DC s3_4
+.word 0x440003E0 # R_MIPS_26   0x0003E0 s0_1
+.word 0x450003E4 # R_MIPS_HI16 0x0003E4 s0_5
+.word 0x460003E8 # R_MIPS_LO16 0x0003E8 s0_5
+.word 0x440003EC # R_MIPS_26   0x0003EC s3_5
+.word 0x450003F0 # R_MIPS_HI16 0x0003F0 s2_4
+.word 0x460003F4 # R_MIPS_LO16 0x0003F4 s2_4
+.word 0x440003F8 # R_MIPS_26   0x0003F8 s3_5
+
+# DATA RELOCS
+.word 0x82000000 # R_MIPS_32   0x000000 s0_14
+.word 0x82000004 # R_MIPS_32   0x000004 s0_9
+.word 0x82000008 # R_MIPS_32   0x000008 s0_15
+.word 0x8200000C # R_MIPS_32   0x00000C 
+.word 0x82000014 # R_MIPS_32   0x000014 s0_15
+.word 0x82000018 # R_MIPS_32   0x000018 s0_15
+.word 0x8200001C # R_MIPS_32   0x00001C s0_5
+.word 0x82000020 # R_MIPS_32   0x000020 s0_10
+.word 0x82000024 # R_MIPS_32   0x000024 s0_6
+.word 0x82000028 # R_MIPS_32   0x000028 s3_3
+.word 0x8200002C # R_MIPS_32   0x00002C s0_2
+.word 0x82000030 # R_MIPS_32   0x000030 s0_8
+.word 0x82000034 # R_MIPS_32   0x000034 
+.word 0x82000038 # R_MIPS_32   0x000038 s0_0
+.word 0x8200003C # R_MIPS_32   0x00003C s2_3
+.word 0x82000040 # R_MIPS_32   0x000040 s0_10
+.word 0x82000044 # R_MIPS_32   0x000044 s1_4
+.word 0x82000048 # R_MIPS_32   0x000048 s0_9
+.word 0x8200004C # R_MIPS_32   0x00004C s1_0
+.word 0x82000050 # R_MIPS_32   0x000050 s0_1
+.word 0x82000054 # R_MIPS_32   0x000054 s3_2
+.word 0x8200005C # R_MIPS_32   0x00005C s3_2
+.word 0x82000060 # R_MIPS_32   0x000060 s0_4
+.word 0x82000074 # R_MIPS_32   0x000074 s1_14
+.word 0x82000078 # R_MIPS_32   0x000078 s3_1
+.word 0x8200007C # R_MIPS_32   0x00007C s1_6
+.word 0x82000080 # R_MIPS_32   0x000080 s1_14
+.word 0x82000084 # R_MIPS_32   0x000084 s1_2
+.word 0x82000088 # R_MIPS_32   0x000088 s2_0
+.word 0x8200008C # R_MIPS_32   0x00008C s1_4
+.word 0x82000090 # R_MIPS_32   0x000090 s1_5
+.word 0x82000094 # R_MIPS_32   0x000094 s1_4
+.word 0x82000098 # R_MIPS_32   0x000098 s3_1
+.word 0x8200009C # R_MIPS_32   0x00009C s1_8
+.word 0x820000A0 # R_MIPS_32   0x0000A0 s1_6
+.word 0x820000A4 # R_MIPS_32   0x0000A4 s1_9
+.word 0x820000A8 # R_MIPS_32   0x0000A8 
+.word 0x820000AC # R_MIPS_32   0x0000AC s1_12
+.word 0x820000B0 # R_MIPS_32   0x0000B0 s1_5
+.word 0x820000B4 # R_MIPS_32   0x0000B4 s1_6
+.word 0x820000B8 # R_MIPS_32   0x0000B8 s1_9
+.word 0x820000BC # R_MIPS_32   0x0000BC 
+.word 0x820000C0 # R_MIPS_32   0x0000C0 s1_8
+.word 0x820000C4 # R_MIPS_32   0x0000C4 s2_2
+.word 0x820000C8 # R_MIPS_32   0x0000C8 s1_15
+.word 0x820000CC # R_MIPS_32   0x0000CC s1_8
+.word 0x820000E0 # R_MIPS_32   0x0000E0 s2_15
+.word 0x820000E4 # R_MIPS_32   0x0000E4 
+.word 0x820000E8 # R_MIPS_32   0x0000E8 s2_11
+.word 0x820000EC # R_MIPS_32   0x0000EC s2_3
+.word 0x820000F0 # R_MIPS_32   0x0000F0 s2_11
+.word 0x820000F4 # R_MIPS_32   0x0000F4 s2_8
+.word 0x820000F8 # R_MIPS_32   0x0000F8 s1_0
+.word 0x820000FC # R_MIPS_32   0x0000FC s2_9
+.word 0x82000100 # R_MIPS_32   0x000100 s0_0
+.word 0x82000104 # R_MIPS_32   0x000104 s2_5
+.word 0x82000108 # R_MIPS_32   0x000108 s2_13
+.word 0x8200010C # R_MIPS_32   0x00010C 
+.word 0x82000110 # R_MIPS_32   0x000110 s2_8
+.word 0x82000114 # R_MIPS_32   0x000114 s2_12
+.word 0x82000118 # R_MIPS_32   0x000118 s2_13
+.word 0x8200011C # R_MIPS_32   0x00011C s0_0
+.word 0x82000120 # R_MIPS_32   0x000120 s3_5
+.word 0x82000124 # R_MIPS_32   0x000124 s2_1
+.word 0x82000128 # R_MIPS_32   0x000128 s1_0
+.word 0x8200012C # R_MIPS_32   0x00012C 
+.word 0x82000130 # R_MIPS_32   0x000130 s2_0
+.word 0x82000134 # R_MIPS_32   0x000134 s1_1
+.word 0x82000138 # R_MIPS_32   0x000138 s1_3
+.word 0x8200013C # R_MIPS_32   0x00013C s2_8
+.word 0x82000140 # R_MIPS_32   0x000140 s2_6
+.word 0x82000150 # R_MIPS_32   0x000150 s3_15
+.word 0x82000154 # R_MIPS_32   0x000154 s3_1
+.word 0x82000158 # R_MIPS_32   0x000158 s2_0
+.word 0x8200015C # R_MIPS_32   0x00015C s3_8
+.word 0x82000160 # R_MIPS_32   0x000160 s3_5
+.word 0x82000164 # R_MIPS_32   0x000164 s3_12
+.word 0x82000168 # R_MIPS_32   0x000168 s1_0
+.word 0x8200016C # R_MIPS_32   0x00016C s2_4
+.word 0x82000170 # R_MIPS_32   0x000170 s3_9
+.word 0x82000174 # R_MIPS_32   0x000174 s2_1
+.word 0x82000178 # R_MIPS_32   0x000178 s3_1
+.word 0x8200017C # R_MIPS_32   0x00017C 
+.word 0x82000180 # R_MIPS_32   0x000180 s3_2
+.word 0x82000184 # R_MIPS_32   0x000184 s3_2
+.word 0x82000188 # R_MIPS_32   0x000188 s3_4
+.word 0x8200018C # R_MIPS_32   0x00018C s3_5
+.word 0x82000190 # R_MIPS_32   0x000190 
+.word 0x82000194 # R_MIPS_32   0x000194 s3_10
+.word 0x82000198 # R_MIPS_32   0x000198 s3_10
+.word 0x8200019C # R_MIPS_32   0x00019C s3_15
+.word 0x820001A0 # R_MIPS_32   0x0001A0 s3_2
+.word 0x820001A4 # R_MIPS_32   0x0001A4 s3_10
+.word 0x820001A8 # R_MIPS_32   0x0001A8 s3_9
+.word 0x820001AC # R_MIPS_32   0x0001AC 
+
+# RODATA RELOCS
+.word 0xC2000000 # R_MIPS_32   0x000000 s1_5
+.word 0xC2000004 # R_MIPS_32   0x000004 s2_1
+.word 0xC2000008 # R_MIPS_32   0x000008 s1_5
+.word 0xC200000C # R_MIPS_32   0x00000C s0_7
+.word 0xC2000010 # R_MIPS_32   0x000010 s0_2
+.word 0xC2000014 # R_MIPS_32   0x000014 s0_0
+.word 0xC2000018 # R_MIPS_32   0x000018 s1_0
+.word 0xC200001C # R_MIPS_32   0x00001C s1_4
+.word 0xC2000020 # R_MIPS_32   0x000020 s3_0
+.word 0xC2000024 # R_MIPS_32   0x000024 s2_4
+.word 0xC2000028 # R_MIPS_32   0x000028 s0_13
+.word 0xC200002C # R_MIPS_32   0x00002C s0_9
+.word 0xC2000030 # R_MIPS_32   0x000030 s1_5
+.word 0xC2000034 # R_MIPS_32   0x000034 s1_7
+.word 0xC2000038 # R_MIPS_32   0x000038 s1_2
+.word 0xC200003C # R_MIPS_32   0x00003C 
+.word 0xC2000040 # R_MIPS_32   0x000040 s2_1
+.word 0xC2000048 # R_MIPS_32   0x000048 s1_6
+.word 0xC200004C # R_MIPS_32   0x00004C s1_6
+.word 0xC2000050 # R_MIPS_32   0x000050 s1_14
+.word 0xC2000054 # R_MIPS_32   0x000054 s2_1
+.word 0xC2000058 # R_MIPS_32   0x000058 s1_15
+.word 0xC200005C # R_MIPS_32   0x00005C s3_4
+.word 0xC2000060 # R_MIPS_32   0x000060 s1_4
+.word 0xC2000064 # R_MIPS_32   0x000064 s2_5
+.word 0xC2000068 # R_MIPS_32   0x000068 s2_2
+.word 0xC2000070 # R_MIPS_32   0x000070 s2_7
+.word 0xC2000074 # R_MIPS_32   0x000074 s0_1
+.word 0xC2000078 # R_MIPS_32   0x000078 s2_10
+.word 0xC200007C # R_MIPS_32   0x00007C 
+.word 0xC2000080 # R_MIPS_32   0x000080 s2_15
+.word 0xC2000084 # R_MIPS_32   0x000084 s2_10
+.word 0xC2000088 # R_MIPS_32   0x000088 s2_12
+.word 0xC200008C # R_MIPS_32   0x00008C s2_5
+.word 0xC2000090 # R_MIPS_32   0x000090 s2_0
+.word 0xC2000094 # R_MIPS_32   0x000094 s0_2
+.word 0xC200009C # R_MIPS_32   0x00009C 
+.word 0xC20000A0 # R_MIPS_32   0x0000A0 s3_6
+.word 0xC20000A4 # R_MIPS_32   0x0000A4 s3_15
+.word 0xC20000A8 # R_MIPS_32   0x0000A8 s3_12
+.word 0xC20000AC # R_MIPS_32   0x0000AC 
+.word 0xC20000B0 # R_MIPS_32   0x0000B0 s1_3
+.word 0xC20000B4 # R_MIPS_32   0x0000B4 s1_2
+.word 0xC20000B8 # R_MIPS_32   0x0000B8 s3_9
+.word 0xC20000BC # R_MIPS_32   0x0000BC s3_10
+.word 0
+
+.word 0x000005F0 # rel_multiOverlayInfoOffset
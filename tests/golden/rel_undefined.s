@@ -0,0 +1,162 @@
+.section .ovl, "a"
+# rel_undefinedOverlayInfo
+.word _rel_undefinedSegmentTextSize
+.word _rel_undefinedSegmentDataSize
+.word _rel_undefinedSegmentRoDataSize
+.word _rel_undefinedSegmentBssSize
+
+.word 143 # relocCount
+
+# TEXT RELOCS
+.word 0x44000008 # R_MIPS_26   0x000008 s1_3
+.word 0x44000014 # R_MIPS_26   0x000014 s1_2
+.word 0x45000030 # R_MIPS_HI16 0x000030 s1_0
+.word 0x46000034 # R_MIPS_LO16 0x000034 s1_0
+.word 0x44000038 # R_MIPS_26   0x000038 s0_3
+.word 0x44000050 # R_MIPS_26   0x000050 
+.word 0x45000054 # R_MIPS_HI16 0x000054 s1_3
+.word 0x46000058 # R_MIPS_LO16 0x000058 s1_3
+.word 0x4400005C # R_MIPS_26   0x00005C s0_2
+.word 0x45000060 # R_MIPS_HI16 0x000060 s1_0
+.word 0x46000064 # R_MIPS_LO16 0x000064 s1_0
+.word 0x4500006C # R_MIPS_HI16 0x00006C s1_0
+.word 0x46000070 # R_MIPS_LO16 0x000070 s1_0
+.word 0x44000074 # R_MIPS_26   0x000074 s1_3
+.word 0x44000080 # R_MIPS_26   0x000080 s1_3
+.word 0x45000084 # R_MIPS_HI16 0x000084 s1_1
+.word 0x46000088 # R_MIPS_LO16 0x000088 s1_1
+.word 0x4400008C # R_MIPS_26   0x00008C 
+.word 0x45000090 # R_MIPS_HI16 0x000090 s0_3
+.word 0x46000094 # R_MIPS_LO16 0x000094 s0_3
+.word 0x440000A4 # R_MIPS_26   0x0000A4 s1_1
+.word 0x440000B0 # R_MIPS_26   0x0000B0 
+.word 0x450000B4 # R_MIPS_HI16 0x0000B4 s1_1
+.word 0x460000B8 # R_MIPS_LO16 0x0000B8 s1_1
+.word 0x440000BC # R_MIPS_26   0x0000BC s0_1
+.word 0x450000C0 # R_MIPS_HI16 0x0000C0 s1_0
+.word 0x460000C4 # R_MIPS_LO16 0x0000C4 s1_0
+.word 0x450000D8 # R_MIPS_HI16 0x0000D8 s1_3
+.word 0x460000DC # R_MIPS_LO16 0x0000DC s1_3
+.word 0x450000F0 # R_MIPS_HI16 0x0000F0 s1_3
+.word 0x460000F4 # R_MIPS_LO16 0x0000F4 s1_3
+.word 0x440000F8 # R_MIPS_26   0x0000F8 
+.word 0x450000FC # R_MIPS_HI16 0x0000FC s1_3
+.word 0x46000100 # R_MIPS_LO16 0x000100 s1_3
+.word 0x44000110 # R_MIPS_26   0x000110 s1_1
+.word 0x4400011C # R_MIPS_26   0x00011C 
+.word 0x45000120 # R_MIPS_HI16 0x000120 s1_0
+.word 0x46000124 # R_MIPS_LO16 0x000124 s1_0
+.word 0x44000128 # R_MIPS_26   0x000128 s0_0
+.word 0x44000134 # R_MIPS_26   0x000134 s0_3
+.word 0x44000140 # R_MIPS_26   0x000140 s0_0
+.word 0x44000164 # R_MIPS_26   0x000164 s0_2
+.word 0x45000180 # R_MIPS_HI16 0x000180 
+.word 0x46000184 # R_MIPS_LO16 0x000184 
+.word 0x4500018C # R_MIPS_HI16 0x00018C s1_2
+.word 0x46000190 # R_MIPS_LO16 0x000190 s1_2
+.word 0x450001A4 # R_MIPS_HI16 0x0001A4 s0_3
+.word 0x460001A8 # R_MIPS_LO16 0x0001A8 s0_3
+.word 0x440001B8 # R_MIPS_26   0x0001B8 s0_3
+.word 0x450001BC # R_MIPS_HI16 0x0001BC s1_0
+.word 0x460001C0 # R_MIPS_LO16 0x0001C0 s1_0
+.word 0x440001C4 # R_MIPS_26   0x0001C4 s0_2
+.word 0x440001DC # R_MIPS_26   0x0001DC s0_1
+.word 0x450001E0 # R_MIPS_HI16 0x0001E0 s0_1
+.word 0x460001E4 # R_MIPS_LO16 0x0001E4 s0_1
+.word 0x440001E8 # R_MIPS_26   0x0001E8 
+.word 0x440001F4 # R_MIPS_26   0x0001F4 s1_2
+.word 0x44000200 # R_MIPS_26   0x000200 s1_0
+.word 0x45000204 # R_MIPS_HI16 0x000204 s0_3
+.word 0x46000208 # R_MIPS_LO16 0x000208 s0_3
+.word 0x44000224 # R_MIPS_26   0x000224 s0_3
+.word 0x44000230 # R_MIPS_26   0x000230 s0_2
+.word 0x45000234 # R_MIPS_HI16 0x000234 s1_1
+.word 0x46000238 # R_MIPS_LO16 0x000238 s1_1
+.word 0x44000248 # R_MIPS_26   0x000248 s0_1
+.word 0x44000254 # R_MIPS_26   0x000254 s1_2
+.word 0x4400026C # R_MIPS_26   0x00026C s0_1
+.word 0x44000278 # R_MIPS_26   0x000278 s0_2
+.word 0x4500027C # R_MIPS_HI16 0x00027C s0_2
+.word 0x46000280 # R_MIPS_LO16 0x000280 s0_2
+.word 0x45000288 # R_MIPS_HI16 0x000288 s0_3
+.word 0x4600028C # R_MIPS_LO16 0x00028C s0_3
+.word 0x45000294 # R_MIPS_HI16 0x000294 s0_2
+.word 0x46000298 # R_MIPS_LO16 0x000298 s0_2
+.word 0x4400029C # R_MIPS_26   0x00029C s0_3
+.word 0x450002AC # R_MIPS_HI16 0x0002AC s0_2
+.word 0x460002B0 # R_MIPS_LO16 0x0002B0 s0_2
+.word 0x450002B8 # R_MIPS_HI16 0x0002B8 s0_0
+.word 0x460002BC # R_MIPS_LO16 0x0002BC s0_0
+.word 0x440002C0 # R_MIPS_26   0x0002C0 s0_2
+.word 0x450002C4 # R_MIPS_HI16 0x0002C4 s1_1
+.word 0x460002C8 # R_MIPS_LO16 0x0002C8 s1_1
+.word 0x440002D8 # R_MIPS_26   0x0002D8 s1_2
+.word 0x440002E4 # R_MIPS_26   0x0002E4 
+.word 0x440002F0 # R_MIPS_26   0x0002F0 
+.word 0x450002F4 # R_MIPS_HI16 0x0002F4 s1_3
+.word 0x460002F8 # R_MIPS_LO16 0x0002F8 s1_3
+
+# DATA RELOCS
+.word 0x82000000 # R_MIPS_32   0x000000 
+.word 0x8200000C # R_MIPS_32   0x00000C s1_1
+.word 0x82000010 # R_MIPS_32   0x000010 s0_2
+.word 0x82000018 # R_MIPS_32   0x000018 s0_1
+.word 0x8200001C # R_MIPS_32   0x00001C s1_0
+.word 0x82000020 # R_MIPS_32   0x000020 s1_1
+.word 0x8200002C # R_MIPS_32   0x00002C s1_2
+.word 0x82000030 # R_MIPS_32   0x000030 s1_2
+.word 0x82000034 # R_MIPS_32   0x000034 s0_1
+.word 0x82000038 # R_MIPS_32   0x000038 s1_3
+.word 0x82000044 # R_MIPS_32   0x000044 s1_1
+.word 0x82000048 # R_MIPS_32   0x000048 s1_2
+.word 0x82000054 # R_MIPS_32   0x000054 s1_2
+.word 0x8200005C # R_MIPS_32   0x00005C s0_1
+.word 0x82000060 # R_MIPS_32   0x000060 s1_3
+.word 0x82000064 # R_MIPS_32   0x000064 s1_0
+.word 0x82000068 # R_MIPS_32   0x000068 s1_0
+.word 0x82000078 # R_MIPS_32   0x000078 s1_0
+.word 0x820000A0 # R_MIPS_32   0x0000A0 s0_1
+.word 0x820000AC # R_MIPS_32   0x0000AC s0_0
+.word 0x820000B0 # R_MIPS_32   0x0000B0 s0_3
+.word 0x820000BC # R_MIPS_32   0x0000BC s1_0
+.word 0x820000C0 # R_MIPS_32   0x0000C0 s0_0
+.word 0x820000C4 # R_MIPS_32   0x0000C4 s1_2
+.word 0x820000D0 # R_MIPS_32   0x0000D0 s0_3
+.word 0x820000DC # R_MIPS_32   0x0000DC s0_0
+.word 0x820000E4 # R_MIPS_32   0x0000E4 s0_1
+.word 0x820000F0 # R_MIPS_32   0x0000F0 s0_3
+.word 0x820000F4 # R_MIPS_32   0x0000F4 
+.word 0x82000100 # R_MIPS_32   0x000100 s1_0
+.word 0x82000104 # R_MIPS_32   0x000104 s1_3
+.word 0x82000108 # R_MIPS_32   0x000108 s1_1
+.word 0x8200010C # R_MIPS_32   0x00010C s1_0
+.word 0x82000110 # R_MIPS_32   0x000110 s1_0
+.word 0x82000114 # R_MIPS_32   0x000114 s0_0
+.word 0x82000118 # R_MIPS_32   0x000118 s1_1
+.word 0x8200011C # R_MIPS_32   0x00011C s0_0
+.word 0x82000120 # R_MIPS_32   0x000120 s0_0
+.word 0x8200012C # R_MIPS_32   0x00012C s1_1
+
+# RODATA RELOCS
+.word 0xC2000004 # R_MIPS_32   0x000004 s0_1
+.word 0xC2000014 # R_MIPS_32   0x000014 s0_1
+.word 0xC2000024 # R_MIPS_32   0x000024 s1_1
+.word 0xC2000028 # R_MIPS_32   0x000028 
+.word 0xC2000040 # R_MIPS_32   0x000040 s1_2
+.word 0xC2000044 # R_MIPS_32   0x000044 s1_1
+.word 0xC2000058 # R_MIPS_32   0x000058 s0_0
+.word 0xC200005C # R_MIPS_32   0x00005C s1_0
+.word 0xC2000060 # R_MIPS_32   0x000060 s0_0
+.word 0xC2000068 # R_MIPS_32   0x000068 s0_0
+.word 0xC200006C # R_MIPS_32   0x00006C s1_3
+.word 0xC2000074 # R_MIPS_32   0x000074 s0_2
+.word 0xC2000080 # R_MIPS_32   0x000080 
+.word 0xC2000084 # R_MIPS_32   0x000084 s0_2
+.word 0xC2000088 # R_MIPS_32   0x000088 
+.word 0xC200008C # R_MIPS_32   0x00008C s1_2
+.word 0xC2000090 # R_MIPS_32   0x000090 s0_0
+.word 0
+.word 0
+.word 0
+
+.word 0x00000260 # rel_undefinedOverlayInfoOffset
@@ -0,0 +1,770 @@
+.section .ovl, "a"
+# rela_many_filesOverlayInfo
+.word _rela_many_filesSegmentTextSize
+.word _rela_many_filesSegmentDataSize
+.word _rela_many_filesSegmentRoDataSize
+.word _rela_many_filesSegmentBssSize
+
+.word 754 # relocCount
+
+# TEXT RELOCS
+.word 0x45000000 # R_MIPS_HI16 0x000000 s8_1
+.word 0x46000004 # R_MIPS_LO16 0x000004 s8_1
+.word 0x44000008 # R_MIPS_26   0x000008 
+.word 0x4500000C # R_MIPS_HI16 0x00000C s0_13
+.word 0x46000010 # R_MIPS_LO16 0x000010 s0_13
+.word 0x44000014 # R_MIPS_26   0x000014 s0_3
+.word 0x45000018 # R_MIPS_HI16 0x000018 s0_17
+.word 0x4600001C # R_MIPS_LO16 0x00001C s0_17
+.word 0x44000020 # R_MIPS_26   0x000020 s0_20
+.word 0x45000024 # R_MIPS_HI16 0x000024 s0_18
+.word 0x46000028 # R_MIPS_LO16 0x000028 s0_18
+.word 0x4400002C # R_MIPS_26   0x00002C s0_10
+.word 0x45000030 # R_MIPS_HI16 0x000030 s0_22
+.word 0x46000034 # R_MIPS_LO16 0x000034 s0_22
+.word 0x44000038 # R_MIPS_26   0x000038 s0_21
+.word 0x4500003C # R_MIPS_HI16 0x00003C s0_10
+.word 0x46000040 # R_MIPS_LO16 0x000040 s0_10
+.word 0x44000044 # R_MIPS_26   0x000044 s0_29
+.word 0x45000048 # R_MIPS_HI16 0x000048 s14_1
+.word 0x4600004C # R_MIPS_LO16 0x00004C s14_1
+.word 0x44000050 # R_MIPS_26   0x000050 s4_0
+.word 0x45000054 # R_MIPS_HI16 0x000054 s0_7
+.word 0x46000058 # R_MIPS_LO16 0x000058 s0_7
+.word 0x4400005C # R_MIPS_26   0x00005C s0_10
+.word 0x45000060 # R_MIPS_HI16 0x000060 
+.word 0x46000064 # R_MIPS_LO16 0x000064 
+.word 0x44000068 # R_MIPS_26   0x000068 s0_14
+.word 0x4500006C # R_MIPS_HI16 0x00006C s0_1
+.word 0x46000070 # R_MIPS_LO16 0x000070 s0_1
+.word 0x44000074 # R_MIPS_26   0x000074 s0_16
+.word 0x45000078 # R_MIPS_HI16 0x000078 s0_20
+.word 0x4600007C # R_MIPS_LO16 0x00007C s0_20
+.word 0x44000088 # R_MIPS_26   0x000088 s5_0
+.word 0x4500008C # R_MIPS_HI16 0x00008C s1_19
+.word 0x46000090 # R_MIPS_LO16 0x000090 s1_19
+.word 0x44000094 # R_MIPS_26   0x000094 s1_10
+.word 0x440000A0 # R_MIPS_26   0x0000A0 s8_1
+.word 0x450000A4 # R_MIPS_HI16 0x0000A4 s1_10
+.word 0x460000A8 # R_MIPS_LO16 0x0000A8 s1_10
+.word 0x440000AC # R_MIPS_26   0x0000AC s1_10
+.word 0x450000B0 # R_MIPS_HI16 0x0000B0 s4_0
+.word 0x460000B4 # R_MIPS_LO16 0x0000B4 s4_0
+.word 0x440000B8 # R_MIPS_26   0x0000B8 s1_26
+.word 0x450000BC # R_MIPS_HI16 0x0000BC s5_1
+.word 0x460000C0 # R_MIPS_LO16 0x0000C0 s5_1
+.word 0x440000C4 # R_MIPS_26   0x0000C4 s1_9
+.word 0x450000C8 # R_MIPS_HI16 0x0000C8 s2_0
+.word 0x460000CC # R_MIPS_LO16 0x0000CC s2_0
+.word 0x440000D0 # R_MIPS_26   0x0000D0 s1_12
+.word 0x450000D4 # R_MIPS_HI16 0x0000D4 s13_0
+.word 0x460000D8 # R_MIPS_LO16 0x0000D8 s13_0
+.word 0x440000DC # R_MIPS_26   0x0000DC 
+.word 0x450000E0 # R_MIPS_HI16 0x0000E0 s1_31
+.word 0x460000E4 # R_MIPS_LO16 0x0000E4 s1_31
+.word 0x440000E8 # R_MIPS_26   0x0000E8 s1_22
+.word 0x450000EC # R_MIPS_HI16 0x0000EC s1_22
+.word 0x460000F0 # R_MIPS_LO16 0x0000F0 s1_22
+.word 0x440000F4 # R_MIPS_26   0x0000F4 s1_11
+.word 0x450000F8 # R_MIPS_HI16 0x0000F8 s1_2
+.word 0x460000FC # R_MIPS_LO16 0x0000FC s1_2
+.word 0x45000100 # R_MIPS_HI16 0x000100 s0_0
+.word 0x46000104 # R_MIPS_LO16 0x000104 s0_0
+.word 0x44000108 # R_MIPS_26   0x000108 s2_28
+.word 0x4500010C # R_MIPS_HI16 0x00010C s2_5
+.word 0x46000110 # R_MIPS_LO16 0x000110 s2_5
+.word 0x44000114 # R_MIPS_26   0x000114 
+.word 0x45000118 # R_MIPS_HI16 0x000118 s2_7
+.word 0x4600011C # R_MIPS_LO16 0x00011C s2_7
+.word 0x44000120 # R_MIPS_26   0x000120 s2_14
+.word 0x45000124 # R_MIPS_HI16 0x000124 
+.word 0x46000128 # R_MIPS_LO16 0x000128 
+.word 0x4400012C # R_MIPS_26   0x00012C s4_1
+.word 0x45000130 # R_MIPS_HI16 0x000130 s4_0
+.word 0x46000134 # R_MIPS_LO16 0x000134 s4_0
+.word 0x44000138 # R_MIPS_26   0x000138 s2_25
+.word 0x4500013C # R_MIPS_HI16 0x00013C s2_28
+.word 0x46000140 # R_MIPS_LO16 0x000140 s2_28
+.word 0x44000144 # R_MIPS_26   0x000144 s2_20
+.word 0x45000148 # R_MIPS_HI16 0x000148 
+.word 0x4600014C # R_MIPS_LO16 0x00014C 
+.word 0x44000150 # R_MIPS_26   0x000150 s2_20
+.word 0x45000154 # R_MIPS_HI16 0x000154 s2_8
+.word 0x46000158 # R_MIPS_LO16 0x000158 s2_8
+.word 0x4400015C # R_MIPS_26   0x00015C s2_20
+.word 0x45000160 # R_MIPS_HI16 0x000160 s2_14
+.word 0x46000164 # R_MIPS_LO16 0x000164 s2_14
+.word 0x44000168 # R_MIPS_26   0x000168 s2_28
+.word 0x4500016C # R_MIPS_HI16 0x00016C s2_0
+.word 0x46000170 # R_MIPS_LO16 0x000170 s2_0
+.word 0x44000174 # R_MIPS_26   0x000174 s2_6
+.word 0x45000178 # R_MIPS_HI16 0x000178 s2_27
+.word 0x4600017C # R_MIPS_LO16 0x00017C s2_27
+.word 0x45000180 # R_MIPS_HI16 0x000180 
+.word 0x46000184 # R_MIPS_LO16 0x000184 
+.word 0x4500018C # R_MIPS_HI16 0x00018C s3_29
+.word 0x46000190 # R_MIPS_LO16 0x000190 s3_29
+.word 0x44000194 # R_MIPS_26   0x000194 s3_30
+.word 0x45000198 # R_MIPS_HI16 0x000198 
+.word 0x4600019C # R_MIPS_LO16 0x00019C 
+.word 0x440001A0 # R_MIPS_26   0x0001A0 s13_1
+.word 0x450001A4 # R_MIPS_HI16 0x0001A4 s3_16
+.word 0x460001A8 # R_MIPS_LO16 0x0001A8 s3_16
+.word 0x440001AC # R_MIPS_26   0x0001AC s3_6
+.word 0x450001B0 # R_MIPS_HI16 0x0001B0 s3_1
+.word 0x460001B4 # R_MIPS_LO16 0x0001B4 s3_1
+.word 0x450001BC # R_MIPS_HI16 0x0001BC s3_16
+.word 0x460001C0 # R_MIPS_LO16 0x0001C0 s3_16
+.word 0x440001C4 # R_MIPS_26   0x0001C4 s3_12
+.word 0x450001C8 # R_MIPS_HI16 0x0001C8 s3_16
+.word 0x460001CC # R_MIPS_LO16 0x0001CC s3_16
+.word 0x450001D4 # R_MIPS_HI16 0x0001D4 s3_16
+.word 0x460001D8 # R_MIPS_LO16 0x0001D8 s3_16
+.word 0x440001DC # R_MIPS_26   0x0001DC s4_2
+.word 0x450001E0 # R_MIPS_HI16 0x0001E0 s3_14
+.word 0x460001E4 # R_MIPS_LO16 0x0001E4 s3_14
+.word 0x440001E8 # R_MIPS_26   0x0001E8 s3_4
+.word 0x450001EC # R_MIPS_HI16 0x0001EC s3_16
+.word 0x460001F0 # R_MIPS_LO16 0x0001F0 s3_16
+.word 0x440001F4 # R_MIPS_26   0x0001F4 s6_0
+.word 0x450001F8 # R_MIPS_HI16 0x0001F8 s3_25
+.word 0x460001FC # R_MIPS_LO16 0x0001FC s3_25
+.word 0x45000200 # R_MIPS_HI16 0x000200 s4_31
+.word 0x46000204 # R_MIPS_LO16 0x000204 s4_31
+.word 0x44000208 # R_MIPS_26   0x000208 s4_26
+.word 0x4500020C # R_MIPS_HI16 0x00020C s14_1
+.word 0x46000210 # R_MIPS_LO16 0x000210 s14_1
+.word 0x44000214 # R_MIPS_26   0x000214 s13_1
+.word 0x44000220 # R_MIPS_26   0x000220 s4_15
+.word 0x45000224 # R_MIPS_HI16 0x000224 s4_10
+.word 0x46000228 # R_MIPS_LO16 0x000228 s4_10
+.word 0x4400022C # R_MIPS_26   0x00022C s4_2
+.word 0x45000230 # R_MIPS_HI16 0x000230 s4_26
+.word 0x46000234 # R_MIPS_LO16 0x000234 s4_26
+.word 0x44000238 # R_MIPS_26   0x000238 s4_24
+.word 0x4500023C # R_MIPS_HI16 0x00023C s13_1
+.word 0x46000240 # R_MIPS_LO16 0x000240 s13_1
+.word 0x44000244 # R_MIPS_26   0x000244 s4_2
+.word 0x45000248 # R_MIPS_HI16 0x000248 s4_0
+.word 0x4600024C # R_MIPS_LO16 0x00024C s4_0
+.word 0x44000250 # R_MIPS_26   0x000250 s4_25
+.word 0x4400025C # R_MIPS_26   0x00025C s0_1
+.word 0x45000260 # R_MIPS_HI16 0x000260 s4_7
+.word 0x46000264 # R_MIPS_LO16 0x000264 s4_7
+.word 0x44000268 # R_MIPS_26   0x000268 s2_0
+.word 0x4500026C # R_MIPS_HI16 0x00026C s8_0
+.word 0x46000270 # R_MIPS_LO16 0x000270 s8_0
+.word 0x44000274 # R_MIPS_26   0x000274 s4_11
+.word 0x45000278 # R_MIPS_HI16 0x000278 s2_1
+.word 0x4600027C # R_MIPS_LO16 0x00027C s2_1
+.word 0x45000280 # R_MIPS_HI16 0x000280 s5_20
+.word 0x46000284 # R_MIPS_LO16 0x000284 s5_20
+.word 0x44000288 # R_MIPS_26   0x000288 s5_29
+.word 0x4500028C # R_MIPS_HI16 0x00028C s5_30
+.word 0x46000290 # R_MIPS_LO16 0x000290 s5_30
+.word 0x44000294 # R_MIPS_26   0x000294 s6_1
+.word 0x45000298 # R_MIPS_HI16 0x000298 s5_5
+.word 0x4600029C # R_MIPS_LO16 0x00029C s5_5
+.word 0x450002A4 # R_MIPS_HI16 0x0002A4 s5_26
+.word 0x460002A8 # R_MIPS_LO16 0x0002A8 s5_26
+.word 0x440002AC # R_MIPS_26   0x0002AC s9_0
+.word 0x450002B0 # R_MIPS_HI16 0x0002B0 s5_31
+.word 0x460002B4 # R_MIPS_LO16 0x0002B4 s5_31
+.word 0x440002B8 # R_MIPS_26   0x0002B8 s5_31
+.word 0x450002BC # R_MIPS_HI16 0x0002BC s5_27
+.word 0x460002C0 # R_MIPS_LO16 0x0002C0 s5_27
+.word 0x440002C4 # R_MIPS_26   0x0002C4 s5_21
+.word 0x450002C8 # R_MIPS_HI16 0x0002C8 s5_15
+.word 0x460002CC # R_MIPS_LO16 0x0002CC s5_15
+.word 0x440002D0 # R_MIPS_26   0x0002D0 s7_1
+.word 0x450002D4 # R_MIPS_HI16 0x0002D4 s5_30
+.word 0x460002D8 # R_MIPS_LO16 0x0002D8 s5_30
+.word 0x440002DC # R_MIPS_26   0x0002DC s5_8
+.word 0x450002E0 # R_MIPS_HI16 0x0002E0 s5_10
+.word 0x460002E4 # R_MIPS_LO16 0x0002E4 s5_10
+.word 0x440002E8 # R_MIPS_26   0x0002E8 s5_24
+.word 0x450002EC # R_MIPS_HI16 0x0002EC s5_22
+.word 0x460002F0 # R_MIPS_LO16 0x0002F0 s5_22
+.word 0x440002F4 # R_MIPS_26   0x0002F4 s5_23
+.word 0x450002F8 # R_MIPS_HI16 0x0002F8 s5_5
+.word 0x460002FC # R_MIPS_LO16 0x0002FC s5_5
+.word 0x45000300 # R_MIPS_HI16 0x000300 s6_22
+.word 0x46000304 # R_MIPS_LO16 0x000304 s6_22
+.word 0x44000308 # R_MIPS_26   0x000308 s7_2
+.word 0x44000314 # R_MIPS_26   0x000314 s6_11
+.word 0x45000318 # R_MIPS_HI16 0x000318 
+.word 0x4600031C # R_MIPS_LO16 0x00031C 
+.word 0x44000320 # R_MIPS_26   0x000320 s6_10
+.word 0x45000324 # R_MIPS_HI16 0x000324 s0_1
+.word 0x46000328 # R_MIPS_LO16 0x000328 s0_1
+.word 0x4400032C # R_MIPS_26   0x00032C s6_22
+.word 0x45000330 # R_MIPS_HI16 0x000330 s6_29
+.word 0x46000334 # R_MIPS_LO16 0x000334 s6_29
+.word 0x44000338 # R_MIPS_26   0x000338 s10_0
+.word 0x4500033C # R_MIPS_HI16 0x00033C 
+.word 0x46000340 # R_MIPS_LO16 0x000340 
+.word 0x44000344 # R_MIPS_26   0x000344 s6_11
+.word 0x45000348 # R_MIPS_HI16 0x000348 s3_0
+.word 0x4600034C # R_MIPS_LO16 0x00034C s3_0
+.word 0x44000350 # R_MIPS_26   0x000350 s6_0
+.word 0x45000354 # R_MIPS_HI16 0x000354 s6_18
+.word 0x46000358 # R_MIPS_LO16 0x000358 s6_18
+.word 0x4400035C # R_MIPS_26   0x00035C s6_18
+.word 0x44000368 # R_MIPS_26   0x000368 s6_14
+.word 0x4500036C # R_MIPS_HI16 0x00036C s6_13
+.word 0x46000370 # R_MIPS_LO16 0x000370 s6_13
+.word 0x44000374 # R_MIPS_26   0x000374 s12_0
+.word 0x45000380 # R_MIPS_HI16 0x000380 s7_23
+.word 0x46000384 # R_MIPS_LO16 0x000384 s7_23
+.word 0x44000388 # R_MIPS_26   0x000388 s9_1
+.word 0x44000394 # R_MIPS_26   0x000394 s7_3
+.word 0x45000398 # R_MIPS_HI16 0x000398 s7_26
+.word 0x4600039C # R_MIPS_LO16 0x00039C s7_26
+.word 0x440003A0 # R_MIPS_26   0x0003A0 s7_18
+.word 0x450003A4 # R_MIPS_HI16 0x0003A4 s6_0
+.word 0x460003A8 # R_MIPS_LO16 0x0003A8 s6_0
+.word 0x440003AC # R_MIPS_26   0x0003AC s7_21
+.word 0x450003B0 # R_MIPS_HI16 0x0003B0 s7_11
+.word 0x460003B4 # R_MIPS_LO16 0x0003B4 s7_11
+.word 0x440003B8 # R_MIPS_26   0x0003B8 s13_0
+.word 0x450003BC # R_MIPS_HI16 0x0003BC s7_8
+.word 0x460003C0 # R_MIPS_LO16 0x0003C0 s7_8
+.word 0x440003C4 # R_MIPS_26   0x0003C4 s7_23
+.word 0x450003C8 # R_MIPS_HI16 0x0003C8 s7_7
+.word 0x460003CC # R_MIPS_LO16 0x0003CC s7_7
+.word 0x440003D0 # R_MIPS_26   0x0003D0 s14_0
+.word 0x450003D4 # R_MIPS_HI16 0x0003D4 s7_23
+.word 0x460003D8 # R_MIPS_LO16 0x0003D8 s7_23
+.word 0x440003DC # R_MIPS_26   0x0003DC s7_21
+.word 0x450003E0 # R_MIPS_HI16 0x0003E0 s7_17
+.word 0x460003E4 # R_MIPS_LO16 0x0003E4 s7_17
+.word 0x440003E8 # R_MIPS_26   0x0003E8 s13_0
+.word 0x450003EC # R_MIPS_HI16 0x0003EC s7_4
+.word 0x460003F0 # R_MIPS_LO16 0x0003F0 s7_4
+.word 0x440003F4 # R_MIPS_26   0x0003F4 s7_14
+.word 0x450003F8 # R_MIPS_HI16 0x0003F8 s7_16
+.word 0x460003FC # R_MIPS_LO16 0x0003FC s7_16
+.word 0x45000400 # R_MIPS_HI16 0x000400 s8_0
+.word 0x46000404 # R_MIPS_LO16 0x000404 s8_0
+.word 0x44000408 # R_MIPS_26   0x000408 s8_0
+.word 0x4500040C # R_MIPS_HI16 0x00040C s8_3
+.word 0x46000410 # R_MIPS_LO16 0x000410 s8_3
+.word 0x44000414 # R_MIPS_26   0x000414 s12_1
+.word 0x45000418 # R_MIPS_HI16 0x000418 s8_25
+.word 0x4600041C # R_MIPS_LO16 0x00041C s8_25
+.word 0x45000424 # R_MIPS_HI16 0x000424 s8_3
+.word 0x46000428 # R_MIPS_LO16 0x000428 s8_3
+.word 0x4400042C # R_MIPS_26   0x00042C s8_5
+.word 0x45000430 # R_MIPS_HI16 0x000430 s8_26
+.word 0x46000434 # R_MIPS_LO16 0x000434 s8_26
+.word 0x44000438 # R_MIPS_26   0x000438 s8_24
+.word 0x4500043C # R_MIPS_HI16 0x00043C s8_25
+.word 0x46000440 # R_MIPS_LO16 0x000440 s8_25
+.word 0x44000444 # R_MIPS_26   0x000444 s8_12
+.word 0x45000448 # R_MIPS_HI16 0x000448 s8_28
+.word 0x4600044C # R_MIPS_LO16 0x00044C s8_28
+.word 0x44000450 # R_MIPS_26   0x000450 s8_20
+.word 0x45000454 # R_MIPS_HI16 0x000454 s8_7
+.word 0x46000458 # R_MIPS_LO16 0x000458 s8_7
+.word 0x4400045C # R_MIPS_26   0x00045C s8_21
+.word 0x45000460 # R_MIPS_HI16 0x000460 s3_1
+.word 0x46000464 # R_MIPS_LO16 0x000464 s3_1
+.word 0x44000468 # R_MIPS_26   0x000468 s15_0
+.word 0x4500046C # R_MIPS_HI16 0x00046C s8_4
+.word 0x46000470 # R_MIPS_LO16 0x000470 s8_4
+.word 0x44000474 # R_MIPS_26   0x000474 s8_27
+.word 0x45000478 # R_MIPS_HI16 0x000478 s12_0
+.word 0x4600047C # R_MIPS_LO16 0x00047C s12_0
+.word 0x45000480 # R_MIPS_HI16 0x000480 s14_1
+.word 0x46000484 # R_MIPS_LO16 0x000484 s14_1
+.word 0x44000488 # R_MIPS_26   0x000488 s9_9
+.word 0x4500048C # R_MIPS_HI16 0x00048C s2_0
+.word 0x46000490 # R_MIPS_LO16 0x000490 s2_0
+.word 0x44000494 # R_MIPS_26   0x000494 
+.word 0x45000498 # R_MIPS_HI16 0x000498 s9_0
+.word 0x4600049C # R_MIPS_LO16 0x00049C s9_0
+.word 0x440004A0 # R_MIPS_26   0x0004A0 s9_27
+.word 0x450004A4 # R_MIPS_HI16 0x0004A4 s9_3
+.word 0x460004A8 # R_MIPS_LO16 0x0004A8 s9_3
+.word 0x440004AC # R_MIPS_26   0x0004AC s9_11
+.word 0x450004B0 # R_MIPS_HI16 0x0004B0 s9_4
+.word 0x460004B4 # R_MIPS_LO16 0x0004B4 s9_4
+.word 0x440004B8 # R_MIPS_26   0x0004B8 s9_19
+.word 0x450004BC # R_MIPS_HI16 0x0004BC s9_6
+.word 0x460004C0 # R_MIPS_LO16 0x0004C0 s9_6
+.word 0x440004C4 # R_MIPS_26   0x0004C4 s9_4
+.word 0x450004C8 # R_MIPS_HI16 0x0004C8 s9_18
+.word 0x460004CC # R_MIPS_LO16 0x0004CC s9_18
+.word 0x440004D0 # R_MIPS_26   0x0004D0 s9_11
+.word 0x440004DC # R_MIPS_26   0x0004DC s9_27
+.word 0x450004E0 # R_MIPS_HI16 0x0004E0 s12_1
+.word 0x460004E4 # R_MIPS_LO16 0x0004E4 s12_1
+.word 0x440004E8 # R_MIPS_26   0x0004E8 s13_0
+.word 0x450004EC # R_MIPS_HI16 0x0004EC s9_5
+.word 0x460004F0 # R_MIPS_LO16 0x0004F0 s9_5
+.word 0x440004F4 # R_MIPS_26   0x0004F4 s9_7
+.word 0x450004F8 # R_MIPS_HI16 0x0004F8 s9_3
+.word 0x460004FC # R_MIPS_LO16 0x0004FC s9_3
+.word 0x45000500 # R_MIPS_HI16 0x000500 s10_25
+.word 0x46000504 # R_MIPS_LO16 0x000504 s10_25
+.word 0x44000508 # R_MIPS_26   0x000508 s4_0
+.word 0x4500050C # R_MIPS_HI16 0x00050C s10_29
+.word 0x46000510 # R_MIPS_LO16 0x000510 s10_29
+.word 0x44000514 # R_MIPS_26   0x000514 s10_14
+.word 0x45000518 # R_MIPS_HI16 0x000518 s10_14
+.word 0x4600051C # R_MIPS_LO16 0x00051C s10_14
+.word 0x44000520 # R_MIPS_26   0x000520 s10_16
+.word 0x45000524 # R_MIPS_HI16 0x000524 s10_21
+.word 0x46000528 # R_MIPS_LO16 0x000528 s10_21
+.word 0x4400052C # R_MIPS_26   0x00052C s2_1
+.word 0x45000530 # R_MIPS_HI16 0x000530 s10_4
+.word 0x46000534 # R_MIPS_LO16 0x000534 s10_4
+.word 0x44000538 # R_MIPS_26   0x000538 
+.word 0x4500053C # R_MIPS_HI16 0x00053C s10_9
+.word 0x46000540 # R_MIPS_LO16 0x000540 s10_9
+.word 0x44000544 # R_MIPS_26   0x000544 
+.word 0x45000548 # R_MIPS_HI16 0x000548 s10_26
+.word 0x4600054C # R_MIPS_LO16 0x00054C s10_26
+.word 0x44000550 # R_MIPS_26   0x000550 s10_7
+.word 0x45000554 # R_MIPS_HI16 0x000554 s10_3
+.word 0x46000558 # R_MIPS_LO16 0x000558 s10_3
+.word 0x4400055C # R_MIPS_26   0x00055C s0_0
+.word 0x45000560 # R_MIPS_HI16 0x000560 s10_22
+.word 0x46000564 # R_MIPS_LO16 0x000564 s10_22
+.word 0x44000568 # R_MIPS_26   0x000568 s10_0
+.word 0x4500056C # R_MIPS_HI16 0x00056C s15_1
+.word 0x46000570 # R_MIPS_LO16 0x000570 s15_1
+.word 0x44000574 # R_MIPS_26   0x000574 s10_5
+.word 0x45000578 # R_MIPS_HI16 0x000578 s10_12
+.word 0x4600057C # R_MIPS_LO16 0x00057C s10_12
+.word 0x45000580 # R_MIPS_HI16 0x000580 s7_1
+.word 0x46000584 # R_MIPS_LO16 0x000584 s7_1
+.word 0x44000588 # R_MIPS_26   0x000588 s11_15
+.word 0x4500058C # R_MIPS_HI16 0x00058C 
+.word 0x46000590 # R_MIPS_LO16 0x000590 
+.word 0x44000594 # R_MIPS_26   0x000594 s11_19
+.word 0x45000598 # R_MIPS_HI16 0x000598 s4_1
+.word 0x4600059C # R_MIPS_LO16 0x00059C s4_1
+.word 0x450005A4 # R_MIPS_HI16 0x0005A4 s4_0
+.word 0x460005A8 # R_MIPS_LO16 0x0005A8 s4_0
+.word 0x440005AC # R_MIPS_26   0x0005AC s11_3
+.word 0x450005B0 # R_MIPS_HI16 0x0005B0 s11_27
+.word 0x460005B4 # R_MIPS_LO16 0x0005B4 s11_27
+.word 0x440005B8 # R_MIPS_26   0x0005B8 s11_10
+.word 0x450005BC # R_MIPS_HI16 0x0005BC s11_13
+.word 0x460005C0 # R_MIPS_LO16 0x0005C0 s11_13
+.word 0x440005C4 # R_MIPS_26   0x0005C4 s11_20
+.word 0x450005C8 # R_MIPS_HI16 0x0005C8 s11_0
+.word 0x460005CC # R_MIPS_LO16 0x0005CC s11_0
+.word 0x440005D0 # R_MIPS_26   0x0005D0 s11_7
+.word 0x440005DC # R_MIPS_26   0x0005DC s11_30
+.word 0x450005E0 # R_MIPS_HI16 0x0005E0 s11_13
+.word 0x460005E4 # R_MIPS_LO16 0x0005E4 s11_13
+.word 0x440005E8 # R_MIPS_26   0x0005E8 s11_10
+.word 0x450005EC # R_MIPS_HI16 0x0005EC s11_22
+.word 0x460005F0 # R_MIPS_LO16 0x0005F0 s11_22
+.word 0x440005F4 # R_MIPS_26   0x0005F4 s13_2
+.word 0x450005F8 # R_MIPS_HI16 0x0005F8 s10_1
+.word 0x460005FC # R_MIPS_LO16 0x0005FC s10_1
+.word 0x45000600 # R_MIPS_HI16 0x000600 s12_11
+.word 0x46000604 # R_MIPS_LO16 0x000604 s12_11
+.word 0x44000608 # R_MIPS_26   0x000608 s3_0
+.word 0x4500060C # R_MIPS_HI16 0x00060C s12_20
+.word 0x46000610 # R_MIPS_LO16 0x000610 s12_20
+.word 0x44000614 # R_MIPS_26   0x000614 s13_1
+.word 0x45000618 # R_MIPS_HI16 0x000618 s12_13
+.word 0x4600061C # R_MIPS_LO16 0x00061C s12_13
+.word 0x44000620 # R_MIPS_26   0x000620 s12_7
+.word 0x45000624 # R_MIPS_HI16 0x000624 s12_19
+.word 0x46000628 # R_MIPS_LO16 0x000628 s12_19
+.word 0x4400062C # R_MIPS_26   0x00062C s12_15
+.word 0x45000630 # R_MIPS_HI16 0x000630 
+.word 0x46000634 # R_MIPS_LO16 0x000634 
+.word 0x44000638 # R_MIPS_26   0x000638 s12_25
+.word 0x4500063C # R_MIPS_HI16 0x00063C s13_1
+.word 0x46000640 # R_MIPS_LO16 0x000640 s13_1
+.word 0x44000644 # R_MIPS_26   0x000644 s12_3
+.word 0x45000648 # R_MIPS_HI16 0x000648 s15_0
+.word 0x4600064C # R_MIPS_LO16 0x00064C s15_0
+.word 0x44000650 # R_MIPS_26   0x000650 s15_0
+.word 0x45000654 # R_MIPS_HI16 0x000654 s12_14
+.word 0x46000658 # R_MIPS_LO16 0x000658 s12_14
+.word 0x4400065C # R_MIPS_26   0x00065C s12_13
+.word 0x45000660 # R_MIPS_HI16 0x000660 s12_25
+.word 0x46000664 # R_MIPS_LO16 0x000664 s12_25
+.word 0x44000668 # R_MIPS_26   0x000668 s12_3
+.word 0x4500066C # R_MIPS_HI16 0x00066C s12_21
+.word 0x46000670 # R_MIPS_LO16 0x000670 s12_21
+.word 0x44000674 # R_MIPS_26   0x000674 s12_26
+.word 0x45000678 # R_MIPS_HI16 0x000678 s12_9
+.word 0x4600067C # R_MIPS_LO16 0x00067C s12_9
+.word 0x45000680 # R_MIPS_HI16 0x000680 s1_0
+.word 0x46000684 # R_MIPS_LO16 0x000684 s1_0
+.word 0x4500068C # R_MIPS_HI16 0x00068C s7_1
+.word 0x46000690 # R_MIPS_LO16 0x000690 s7_1
+.word 0x45000698 # R_MIPS_HI16 0x000698 s13_12
+.word 0x4600069C # R_MIPS_LO16 0x00069C s13_12
+.word 0x440006A0 # R_MIPS_26   0x0006A0 s15_0
+.word 0x450006A4 # R_MIPS_HI16 0x0006A4 s13_18
+.word 0x460006A8 # R_MIPS_LO16 0x0006A8 s13_18
+.word 0x440006AC # R_MIPS_26   0x0006AC s13_31
+.word 0x450006B0 # R_MIPS_HI16 0x0006B0 s1_0
+.word 0x460006B4 # R_MIPS_LO16 0x0006B4 s1_0
+.word 0x440006B8 # R_MIPS_26   0x0006B8 s1_1
+.word 0x450006BC # R_MIPS_HI16 0x0006BC s13_28
+.word 0x460006C0 # R_MIPS_LO16 0x0006C0 s13_28
+.word 0x440006C4 # R_MIPS_26   0x0006C4 s13_19
+.word 0x450006C8 # R_MIPS_HI16 0x0006C8 s13_27
+.word 0x460006CC # R_MIPS_LO16 0x0006CC s13_27
+.word 0x440006D0 # R_MIPS_26   0x0006D0 s13_14
+.word 0x450006D4 # R_MIPS_HI16 0x0006D4 s13_29
+.word 0x460006D8 # R_MIPS_LO16 0x0006D8 s13_29
+.word 0x440006DC # R_MIPS_26   0x0006DC 
+.word 0x450006E0 # R_MIPS_HI16 0x0006E0 s7_0
+.word 0x460006E4 # R_MIPS_LO16 0x0006E4 s7_0
+.word 0x440006E8 # R_MIPS_26   0x0006E8 s13_14
+.word 0x450006EC # R_MIPS_HI16 0x0006EC s13_7
+.word 0x460006F0 # R_MIPS_LO16 0x0006F0 s13_7
+.word 0x440006F4 # R_MIPS_26   0x0006F4 s13_20
+.word 0x450006F8 # R_MIPS_HI16 0x0006F8 s13_14
+.word 0x460006FC # R_MIPS_LO16 0x0006FC s13_14
+.word 0x45000700 # R_MIPS_HI16 0x000700 s14_21
+.word 0x46000704 # R_MIPS_LO16 0x000704 s14_21
+.word 0x44000708 # R_MIPS_26   0x000708 s4_0
+.word 0x4500070C # R_MIPS_HI16 0x00070C s14_3
+.word 0x46000710 # R_MIPS_LO16 0x000710 s14_3
+.word 0x44000714 # R_MIPS_26   0x000714 s6_0
+.word 0x45000718 # R_MIPS_HI16 0x000718 s14_26
+.word 0x4600071C # R_MIPS_LO16 0x00071C s14_26
+.word 0x44000720 # R_MIPS_26   0x000720 s2_0
+.word 0x45000724 # R_MIPS_HI16 0x000724 s14_8
+.word 0x46000728 # R_MIPS_LO16 0x000728 s14_8
+.word 0x4400072C # R_MIPS_26   0x00072C s14_2
+.word 0x45000730 # R_MIPS_HI16 0x000730 s14_10
+.word 0x46000734 # R_MIPS_LO16 0x000734 s14_10
+.word 0x44000738 # R_MIPS_26   0x000738 s14_6
+.word 0x4500073C # R_MIPS_HI16 0x00073C s14_5
+.word 0x46000740 # R_MIPS_LO16 0x000740 s14_5
+.word 0x44000744 # R_MIPS_26   0x000744 s14_6
+.word 0x45000748 # R_MIPS_HI16 0x000748 
+.word 0x4600074C # R_MIPS_LO16 0x00074C 
+.word 0x44000750 # R_MIPS_26   0x000750 s15_2
+.word 0x45000754 # R_MIPS_HI16 0x000754 s14_4
+.word 0x46000758 # R_MIPS_LO16 0x000758 s14_4
+.word 0x4400075C # R_MIPS_26   0x00075C s3_0
+.word 0x45000760 # R_MIPS_HI16 0x000760 s8_0
+.word 0x46000764 # R_MIPS_LO16 0x000764 s8_0
+.word 0x44000768 # R_MIPS_26   0x000768 s14_18
+.word 0x4500076C # R_MIPS_HI16 0x00076C s14_1
+.word 0x46000770 # R_MIPS_LO16 0x000770 s14_1
+.word 0x44000774 # R_MIPS_26   0x000774 s14_22
+.word 0x45000778 # R_MIPS_HI16 0x000778 s14_15
+.word 0x4600077C # R_MIPS_LO16 0x00077C s14_15
+.word 0x45000780 # R_MIPS_HI16 0x000780 s14_1
+.word 0x46000784 # R_MIPS_LO16 0x000784 s14_1
+.word 0x44000788 # R_MIPS_26   0x000788 
+.word 0x4500078C # R_MIPS_HI16 0x00078C s9_0
+.word 0x46000790 # R_MIPS_LO16 0x000790 s9_0
+.word 0x44000794 # R_MIPS_26   0x000794 s15_28
+.word 0x45000798 # R_MIPS_HI16 0x000798 s15_28
+.word 0x4600079C # R_MIPS_LO16 0x00079C s15_28
+.word 0x440007A0 # R_MIPS_26   0x0007A0 s14_1
+.word 0x450007A4 # R_MIPS_HI16 0x0007A4 s15_29
+.word 0x460007A8 # R_MIPS_LO16 0x0007A8 s15_29
+.word 0x440007AC # R_MIPS_26   0x0007AC s15_6
+.word 0x450007B0 # R_MIPS_HI16 0x0007B0 s15_12
+.word 0x460007B4 # R_MIPS_LO16 0x0007B4 s15_12
+.word 0x440007B8 # R_MIPS_26   0x0007B8 s15_2
+.word 0x450007BC # R_MIPS_HI16 0x0007BC s15_14
+.word 0x460007C0 # R_MIPS_LO16 0x0007C0 s15_14
+.word 0x440007C4 # R_MIPS_26   0x0007C4 s15_28
+.word 0x450007C8 # R_MIPS_HI16 0x0007C8 s1_2
+.word 0x460007CC # R_MIPS_LO16 0x0007CC s1_2
+.word 0x440007D0 # R_MIPS_26   0x0007D0 s15_23
+.word 0x450007D4 # R_MIPS_HI16 0x0007D4 s3_1
+.word 0x460007D8 # R_MIPS_LO16 0x0007D8 s3_1
+.word 0x440007DC # R_MIPS_26   0x0007DC s15_31
+.word 0x450007E0 # R_MIPS_HI16 0x0007E0 s15_28
+.word 0x460007E4 # R_MIPS_LO16 0x0007E4 s15_28
+.word 0x440007E8 # R_MIPS_26   0x0007E8 s8_1
+.word 0x450007EC # R_MIPS_HI16 0x0007EC s0_2
+.word 0x460007F0 # R_MIPS_LO16 0x0007F0 s0_2
+.word 0x440007F4 # R_MIPS_26   0x0007F4 s2_1
+.word 0x450007F8 # R_MIPS_HI16 0x0007F8 s15_31
+.word 0x460007FC # R_MIPS_LO16 0x0007FC s15_31
+
+# DATA RELOCS
+.word 0x82000000 # R_MIPS_32   0x000000 s0_3
+.word 0x82000004 # R_MIPS_32   0x000004 s0_22
+.word 0x82000008 # R_MIPS_32   0x000008 
+.word 0x8200000C # R_MIPS_32   0x00000C s0_3
+.word 0x82000010 # R_MIPS_32   0x000010 s0_25
+.word 0x82000014 # R_MIPS_32   0x000014 s0_28
+.word 0x82000018 # R_MIPS_32   0x000018 s0_10
+.word 0x8200001C # R_MIPS_32   0x00001C s0_5
+.word 0x82000020 # R_MIPS_32   0x000020 s0_22
+.word 0x82000024 # R_MIPS_32   0x000024 s0_29
+.word 0x82000028 # R_MIPS_32   0x000028 
+.word 0x8200002C # R_MIPS_32   0x00002C 
+.word 0x82000030 # R_MIPS_32   0x000030 s1_26
+.word 0x82000034 # R_MIPS_32   0x000034 s1_25
+.word 0x82000038 # R_MIPS_32   0x000038 s1_29
+.word 0x8200003C # R_MIPS_32   0x00003C s1_0
+.word 0x82000040 # R_MIPS_32   0x000040 s9_0
+.word 0x82000044 # R_MIPS_32   0x000044 s1_26
+.word 0x82000048 # R_MIPS_32   0x000048 s1_31
+.word 0x8200004C # R_MIPS_32   0x00004C s5_0
+.word 0x82000050 # R_MIPS_32   0x000050 s5_0
+.word 0x82000054 # R_MIPS_32   0x000054 s1_18
+.word 0x82000058 # R_MIPS_32   0x000058 s1_12
+.word 0x8200005C # R_MIPS_32   0x00005C s1_18
+.word 0x82000060 # R_MIPS_32   0x000060 s2_5
+.word 0x82000064 # R_MIPS_32   0x000064 
+.word 0x82000068 # R_MIPS_32   0x000068 s2_13
+.word 0x8200006C # R_MIPS_32   0x00006C s2_27
+.word 0x82000070 # R_MIPS_32   0x000070 s9_1
+.word 0x82000074 # R_MIPS_32   0x000074 s2_2
+.word 0x82000078 # R_MIPS_32   0x000078 s2_21
+.word 0x8200007C # R_MIPS_32   0x00007C s2_10
+.word 0x82000080 # R_MIPS_32   0x000080 
+.word 0x82000084 # R_MIPS_32   0x000084 s2_18
+.word 0x82000088 # R_MIPS_32   0x000088 s2_30
+.word 0x8200008C # R_MIPS_32   0x00008C s12_1
+.word 0x82000090 # R_MIPS_32   0x000090 s11_0
+.word 0x82000094 # R_MIPS_32   0x000094 s3_18
+.word 0x82000098 # R_MIPS_32   0x000098 
+.word 0x8200009C # R_MIPS_32   0x00009C 
+.word 0x820000A0 # R_MIPS_32   0x0000A0 s3_27
+.word 0x820000A4 # R_MIPS_32   0x0000A4 s3_26
+.word 0x820000A8 # R_MIPS_32   0x0000A8 s9_0
+.word 0x820000AC # R_MIPS_32   0x0000AC s5_1
+.word 0x820000B0 # R_MIPS_32   0x0000B0 s3_21
+.word 0x820000B4 # R_MIPS_32   0x0000B4 s3_29
+.word 0x820000B8 # R_MIPS_32   0x0000B8 s3_6
+.word 0x820000BC # R_MIPS_32   0x0000BC s3_0
+.word 0x820000C0 # R_MIPS_32   0x0000C0 s15_0
+.word 0x820000C4 # R_MIPS_32   0x0000C4 s4_7
+.word 0x820000C8 # R_MIPS_32   0x0000C8 s13_0
+.word 0x820000CC # R_MIPS_32   0x0000CC s1_0
+.word 0x820000D0 # R_MIPS_32   0x0000D0 s5_2
+.word 0x820000D4 # R_MIPS_32   0x0000D4 
+.word 0x820000D8 # R_MIPS_32   0x0000D8 s4_15
+.word 0x820000DC # R_MIPS_32   0x0000DC s13_0
+.word 0x820000E0 # R_MIPS_32   0x0000E0 s2_0
+.word 0x820000E4 # R_MIPS_32   0x0000E4 s4_7
+.word 0x820000E8 # R_MIPS_32   0x0000E8 s0_0
+.word 0x820000EC # R_MIPS_32   0x0000EC 
+.word 0x820000F0 # R_MIPS_32   0x0000F0 
+.word 0x820000F4 # R_MIPS_32   0x0000F4 s7_0
+.word 0x820000F8 # R_MIPS_32   0x0000F8 s0_1
+.word 0x820000FC # R_MIPS_32   0x0000FC s5_9
+.word 0x82000100 # R_MIPS_32   0x000100 s8_1
+.word 0x82000104 # R_MIPS_32   0x000104 s6_0
+.word 0x82000108 # R_MIPS_32   0x000108 s2_0
+.word 0x8200010C # R_MIPS_32   0x00010C s5_20
+.word 0x82000110 # R_MIPS_32   0x000110 s5_21
+.word 0x82000114 # R_MIPS_32   0x000114 s5_4
+.word 0x82000118 # R_MIPS_32   0x000118 s5_13
+.word 0x8200011C # R_MIPS_32   0x00011C s5_24
+.word 0x82000120 # R_MIPS_32   0x000120 s6_27
+.word 0x82000124 # R_MIPS_32   0x000124 s6_5
+.word 0x82000128 # R_MIPS_32   0x000128 s6_18
+.word 0x8200012C # R_MIPS_32   0x00012C s14_1
+.word 0x82000130 # R_MIPS_32   0x000130 
+.word 0x82000134 # R_MIPS_32   0x000134 s6_7
+.word 0x82000138 # R_MIPS_32   0x000138 s8_0
+.word 0x8200013C # R_MIPS_32   0x00013C 
+.word 0x82000140 # R_MIPS_32   0x000140 
+.word 0x82000144 # R_MIPS_32   0x000144 
+.word 0x82000148 # R_MIPS_32   0x000148 s6_26
+.word 0x8200014C # R_MIPS_32   0x00014C 
+.word 0x82000150 # R_MIPS_32   0x000150 s7_16
+.word 0x82000154 # R_MIPS_32   0x000154 s7_23
+.word 0x82000158 # R_MIPS_32   0x000158 s7_28
+.word 0x8200015C # R_MIPS_32   0x00015C s7_25
+.word 0x82000160 # R_MIPS_32   0x000160 s7_9
+.word 0x82000164 # R_MIPS_32   0x000164 s4_0
+.word 0x82000168 # R_MIPS_32   0x000168 s7_5
+.word 0x8200016C # R_MIPS_32   0x00016C s7_9
+.word 0x82000170 # R_MIPS_32   0x000170 s7_22
+.word 0x82000174 # R_MIPS_32   0x000174 s7_18
+.word 0x82000178 # R_MIPS_32   0x000178 s0_0
+.word 0x8200017C # R_MIPS_32   0x00017C s8_1
+.word 0x82000180 # R_MIPS_32   0x000180 s8_23
+.word 0x82000184 # R_MIPS_32   0x000184 s8_1
+.word 0x82000188 # R_MIPS_32   0x000188 s8_25
+.word 0x8200018C # R_MIPS_32   0x00018C s8_4
+.word 0x82000190 # R_MIPS_32   0x000190 s8_3
+.word 0x82000198 # R_MIPS_32   0x000198 
+.word 0x8200019C # R_MIPS_32   0x00019C s7_0
+.word 0x820001A0 # R_MIPS_32   0x0001A0 s8_26
+.word 0x820001A4 # R_MIPS_32   0x0001A4 s8_17
+.word 0x820001A8 # R_MIPS_32   0x0001A8 s8_31
+.word 0x820001AC # R_MIPS_32   0x0001AC s14_1
+.word 0x820001B0 # R_MIPS_32   0x0001B0 s11_1
+.word 0x820001B4 # R_MIPS_32   0x0001B4 s9_26
+.word 0x820001BC # R_MIPS_32   0x0001BC s10_1
+.word 0x820001C0 # R_MIPS_32   0x0001C0 s9_10
+.word 0x820001C4 # R_MIPS_32   0x0001C4 s12_1
+.word 0x820001C8 # R_MIPS_32   0x0001C8 s9_28
+.word 0x820001CC # R_MIPS_32   0x0001CC s11_1
+.word 0x820001D0 # R_MIPS_32   0x0001D0 s10_1
+.word 0x820001D4 # R_MIPS_32   0x0001D4 s9_9
+.word 0x820001D8 # R_MIPS_32   0x0001D8 s9_23
+.word 0x820001DC # R_MIPS_32   0x0001DC s9_24
+.word 0x820001E0 # R_MIPS_32   0x0001E0 s10_11
+.word 0x820001E4 # R_MIPS_32   0x0001E4 s10_21
+.word 0x820001E8 # R_MIPS_32   0x0001E8 s10_16
+.word 0x820001EC # R_MIPS_32   0x0001EC s10_24
+.word 0x820001F4 # R_MIPS_32   0x0001F4 
+.word 0x820001F8 # R_MIPS_32   0x0001F8 s8_0
+.word 0x820001FC # R_MIPS_32   0x0001FC s10_17
+.word 0x82000200 # R_MIPS_32   0x000200 s10_12
+.word 0x82000204 # R_MIPS_32   0x000204 s15_1
+.word 0x82000208 # R_MIPS_32   0x000208 s10_21
+.word 0x8200020C # R_MIPS_32   0x00020C s10_7
+.word 0x82000210 # R_MIPS_32   0x000210 s11_24
+.word 0x82000214 # R_MIPS_32   0x000214 s14_0
+.word 0x82000218 # R_MIPS_32   0x000218 s7_1
+.word 0x8200021C # R_MIPS_32   0x00021C s11_5
+.word 0x82000220 # R_MIPS_32   0x000220 s10_0
+.word 0x82000224 # R_MIPS_32   0x000224 s11_26
+.word 0x82000228 # R_MIPS_32   0x000228 s11_22
+.word 0x8200022C # R_MIPS_32   0x00022C s14_0
+.word 0x82000230 # R_MIPS_32   0x000230 s6_1
+.word 0x82000234 # R_MIPS_32   0x000234 s11_8
+.word 0x82000238 # R_MIPS_32   0x000238 s11_18
+.word 0x8200023C # R_MIPS_32   0x00023C s7_1
+.word 0x82000240 # R_MIPS_32   0x000240 s6_0
+.word 0x82000244 # R_MIPS_32   0x000244 s12_11
+.word 0x82000248 # R_MIPS_32   0x000248 s6_1
+.word 0x8200024C # R_MIPS_32   0x00024C s12_17
+.word 0x82000250 # R_MIPS_32   0x000250 s12_18
+.word 0x82000254 # R_MIPS_32   0x000254 s12_21
+.word 0x8200025C # R_MIPS_32   0x00025C s12_20
+.word 0x82000260 # R_MIPS_32   0x000260 s12_0
+.word 0x82000264 # R_MIPS_32   0x000264 s12_1
+.word 0x82000268 # R_MIPS_32   0x000268 s12_11
+.word 0x8200026C # R_MIPS_32   0x00026C s12_23
+.word 0x82000270 # R_MIPS_32   0x000270 s13_16
+.word 0x82000274 # R_MIPS_32   0x000274 s13_5
+.word 0x8200027C # R_MIPS_32   0x00027C s5_0
+.word 0x82000280 # R_MIPS_32   0x000280 s13_0
+.word 0x82000288 # R_MIPS_32   0x000288 s0_1
+.word 0x8200028C # R_MIPS_32   0x00028C s13_30
+.word 0x82000294 # R_MIPS_32   0x000294 s13_29
+.word 0x82000298 # R_MIPS_32   0x000298 s13_21
+.word 0x8200029C # R_MIPS_32   0x00029C s7_1
+.word 0x820002A0 # R_MIPS_32   0x0002A0 s2_1
+.word 0x820002A4 # R_MIPS_32   0x0002A4 s14_6
+.word 0x820002A8 # R_MIPS_32   0x0002A8 s14_11
+.word 0x820002AC # R_MIPS_32   0x0002AC s1_1
+.word 0x820002B0 # R_MIPS_32   0x0002B0 s14_20
+.word 0x820002B4 # R_MIPS_32   0x0002B4 s2_1
+.word 0x820002B8 # R_MIPS_32   0x0002B8 s14_23
+.word 0x820002BC # R_MIPS_32   0x0002BC s14_30
+.word 0x820002C0 # R_MIPS_32   0x0002C0 s14_31
+.word 0x820002C4 # R_MIPS_32   0x0002C4 s14_22
+.word 0x820002C8 # R_MIPS_32   0x0002C8 s0_2
+.word 0x820002CC # R_MIPS_32   0x0002CC s14_7
+.word 0x820002D0 # R_MIPS_32   0x0002D0 s15_20
+.word 0x820002D4 # R_MIPS_32   0x0002D4 s11_1
+.word 0x820002D8 # R_MIPS_32   0x0002D8 s15_17
+.word 0x820002DC # R_MIPS_32   0x0002DC s15_16
+.word 0x820002E0 # R_MIPS_32   0x0002E0 s15_6
+.word 0x820002E8 # R_MIPS_32   0x0002E8 s15_30
+.word 0x820002EC # R_MIPS_32   0x0002EC 
+.word 0x820002F0 # R_MIPS_32   0x0002F0 s15_10
+.word 0x820002F4 # R_MIPS_32   0x0002F4 s15_14
+.word 0x820002F8 # R_MIPS_32   0x0002F8 s15_26
+
+# RODATA RELOCS
+.word 0xC2000004 # R_MIPS_32   0x000004 s0_22
+.word 0xC2000008 # R_MIPS_32   0x000008 
+.word 0xC200000C # R_MIPS_32   0x00000C s0_7
+.word 0xC2000010 # R_MIPS_32   0x000010 s0_14
+.word 0xC2000014 # R_MIPS_32   0x000014 s0_29
+.word 0xC2000030 # R_MIPS_32   0x000030 s1_0
+.word 0xC2000038 # R_MIPS_32   0x000038 s1_28
+.word 0xC200003C # R_MIPS_32   0x00003C s1_22
+.word 0xC2000040 # R_MIPS_32   0x000040 
+.word 0xC2000060 # R_MIPS_32   0x000060 s2_31
+.word 0xC2000064 # R_MIPS_32   0x000064 s2_30
+.word 0xC2000068 # R_MIPS_32   0x000068 s3_2
+.word 0xC200006C # R_MIPS_32   0x00006C s2_31
+.word 0xC2000070 # R_MIPS_32   0x000070 s2_15
+.word 0xC2000074 # R_MIPS_32   0x000074 s2_24
+.word 0xC2000090 # R_MIPS_32   0x000090 
+.word 0xC2000094 # R_MIPS_32   0x000094 s3_2
+.word 0xC2000098 # R_MIPS_32   0x000098 s3_20
+.word 0xC200009C # R_MIPS_32   0x00009C s3_16
+.word 0xC20000A0 # R_MIPS_32   0x0000A0 s3_11
+.word 0xC20000C0 # R_MIPS_32   0x0000C0 s4_27
+.word 0xC20000C4 # R_MIPS_32   0x0000C4 s4_24
+.word 0xC20000C8 # R_MIPS_32   0x0000C8 s4_7
+.word 0xC20000CC # R_MIPS_32   0x0000CC s4_2
+.word 0xC20000D0 # R_MIPS_32   0x0000D0 s12_0
+.word 0xC20000D4 # R_MIPS_32   0x0000D4 s4_19
+.word 0xC20000F0 # R_MIPS_32   0x0000F0 s5_30
+.word 0xC20000F4 # R_MIPS_32   0x0000F4 s5_10
+.word 0xC20000F8 # R_MIPS_32   0x0000F8 
+.word 0xC20000FC # R_MIPS_32   0x0000FC s5_1
+.word 0xC2000100 # R_MIPS_32   0x000100 s5_2
+.word 0xC2000104 # R_MIPS_32   0x000104 s5_6
+.word 0xC2000120 # R_MIPS_32   0x000120 s10_1
+.word 0xC2000124 # R_MIPS_32   0x000124 s6_1
+.word 0xC2000128 # R_MIPS_32   0x000128 s6_22
+.word 0xC200012C # R_MIPS_32   0x00012C s6_22
+.word 0xC2000150 # R_MIPS_32   0x000150 s7_1
+.word 0xC2000154 # R_MIPS_32   0x000154 s7_15
+.word 0xC2000158 # R_MIPS_32   0x000158 s7_0
+.word 0xC200015C # R_MIPS_32   0x00015C s7_29
+.word 0xC2000160 # R_MIPS_32   0x000160 s7_15
+.word 0xC2000164 # R_MIPS_32   0x000164 s7_5
+.word 0xC2000180 # R_MIPS_32   0x000180 s8_13
+.word 0xC2000184 # R_MIPS_32   0x000184 s8_27
+.word 0xC2000188 # R_MIPS_32   0x000188 s8_21
+.word 0xC200018C # R_MIPS_32   0x00018C s8_4
+.word 0xC2000190 # R_MIPS_32   0x000190 s8_14
+.word 0xC2000194 # R_MIPS_32   0x000194 s8_8
+.word 0xC20001B0 # R_MIPS_32   0x0001B0 s9_20
+.word 0xC20001B4 # R_MIPS_32   0x0001B4 s9_31
+.word 0xC20001B8 # R_MIPS_32   0x0001B8 s9_27
+.word 0xC20001BC # R_MIPS_32   0x0001BC 
+.word 0xC20001C0 # R_MIPS_32   0x0001C0 s9_10
+.word 0xC20001C4 # R_MIPS_32   0x0001C4 s1_1
+.word 0xC20001E4 # R_MIPS_32   0x0001E4 s7_1
+.word 0xC20001E8 # R_MIPS_32   0x0001E8 s12_0
+.word 0xC20001EC # R_MIPS_32   0x0001EC s8_0
+.word 0xC20001F0 # R_MIPS_32   0x0001F0 s3_1
+.word 0xC20001F4 # R_MIPS_32   0x0001F4 s10_3
+.word 0xC2000210 # R_MIPS_32   0x000210 s11_23
+.word 0xC2000214 # R_MIPS_32   0x000214 s4_1
+.word 0xC2000218 # R_MIPS_32   0x000218 
+.word 0xC200021C # R_MIPS_32   0x00021C s7_0
+.word 0xC2000220 # R_MIPS_32   0x000220 s15_1
+.word 0xC2000240 # R_MIPS_32   0x000240 s15_1
+.word 0xC2000244 # R_MIPS_32   0x000244 s12_29
+.word 0xC2000248 # R_MIPS_32   0x000248 s12_6
+.word 0xC200024C # R_MIPS_32   0x00024C s12_19
+.word 0xC2000250 # R_MIPS_32   0x000250 s6_0
+.word 0xC2000254 # R_MIPS_32   0x000254 s12_4
+.word 0xC2000270 # R_MIPS_32   0x000270 s13_9
+.word 0xC2000274 # R_MIPS_32   0x000274 s13_10
+.word 0xC2000278 # R_MIPS_32   0x000278 s7_1
+.word 0xC200027C # R_MIPS_32   0x00027C 
+.word 0xC2000280 # R_MIPS_32   0x000280 s13_11
+.word 0xC2000284 # R_MIPS_32   0x000284 s13_3
+.word 0xC20002A0 # R_MIPS_32   0x0002A0 s14_16
+.word 0xC20002A4 # R_MIPS_32   0x0002A4 s5_0
+.word 0xC20002A8 # R_MIPS_32   0x0002A8 s14_9
+.word 0xC20002AC # R_MIPS_32   0x0002AC s14_14
+.word 0xC20002B0 # R_MIPS_32   0x0002B0 s14_24
+.word 0xC20002B4 # R_MIPS_32   0x0002B4 s14_30
+.word 0xC20002D0 # R_MIPS_32   0x0002D0 s9_1
+.word 0xC20002D8 # R_MIPS_32   0x0002D8 s15_16
+.word 0xC20002DC # R_MIPS_32   0x0002DC s3_1
+.word 0xC20002E0 # R_MIPS_32   0x0002E0 s15_18
+.word 0xC20002E4 # R_MIPS_32   0x0002E4 s15_17
+
+.word 0x00000BE0 # rela_many_filesOverlayInfoOffset
@@ -0,0 +1,338 @@
+.section .ovl, "a"
+# rela_multiOverlayInfo
+.word _rela_multiSegmentTextSize
+.word _rela_multiSegmentDataSize
+.word _rela_multiSegmentRoDataSize
+.word _rela_multiSegmentBssSize
+
+.word 322 # relocCount
+
+# TEXT RELOCS
+.word 0x45000000 # R_MIPS_HI16 0x000000 s2_3
+.word 0x46000004 # R_MIPS_LO16 0x000004 s2_3
+.word 0x44000008 # R_MIPS_26   0x000008 s0_12
+.word 0x4500000C # R_MIPS_HI16 0x00000C s0_6
+.word 0x46000010 # R_MIPS_LO16 0x000010 s0_6
+.word 0x44000014 # R_MIPS_26   0x000014 s0_6
+.word 0x45000018 # R_MIPS_HI16 0x000018 s0_4
+.word 0x4600001C # R_MIPS_LO16 0x00001C s0_4
+.word 0x45000024 # R_MIPS_HI16 0x000024 s3_2
+.word 0x46000028 # R_MIPS_LO16 0x000028 s3_2
+.word 0x4400002C # R_MIPS_26   0x00002C s3_1
+.word 0x45000030 # R_MIPS_HI16 0x000030 s0_6
+.word 0x46000034 # R_MIPS_LO16 0x000034 s0_6
+.word 0x44000038 # R_MIPS_26   0x000038 s1_2
+.word 0x4500003C # R_MIPS_HI16 0x00003C s0_7
+.word 0x46000040 # R_MIPS_LO16 0x000040 s0_7
+.word 0x44000044 # R_MIPS_26   0x000044 s0_13
+.word 0x44000050 # R_MIPS_26   0x000050 s0_10
+.word 0x45000054 # R_MIPS_HI16 0x000054 s0_1
+.word 0x46000058 # R_MIPS_LO16 0x000058 s0_1
+.word 0x4400005C # R_MIPS_26   0x00005C s3_4
+.word 0x45000060 # R_MIPS_HI16 0x000060 s1_1
+.word 0x46000064 # R_MIPS_LO16 0x000064 s1_1
+.word 0x4500006C # R_MIPS_HI16 0x00006C s0_11
+.word 0x46000070 # R_MIPS_LO16 0x000070 s0_11
+.word 0x44000074 # R_MIPS_26   0x000074 s3_0
+.word 0x45000078 # R_MIPS_HI16 0x000078 s1_2
+.word 0x4600007C # R_MIPS_LO16 0x00007C s1_2
+.word 0x44000080 # R_MIPS_26   0x000080 s0_5
+.word 0x45000090 # R_MIPS_HI16 0x000090 s0_1
+.word 0x46000094 # R_MIPS_LO16 0x000094 s0_1
+.word 0x44000098 # R_MIPS_26   0x000098 s0_3
+.word 0x4500009C # R_MIPS_HI16 0x00009C s2_1
+.word 0x460000A0 # R_MIPS_LO16 0x0000A0 s2_1
+.word 0x440000A4 # R_MIPS_26   0x0000A4 s3_0
+.word 0x450000A8 # R_MIPS_HI16 0x0000A8 s3_1
+.word 0x460000AC # R_MIPS_LO16 0x0000AC s3_1
+.word 0x440000B0 # R_MIPS_26   0x0000B0 s0_5
+.word 0x450000B4 # R_MIPS_HI16 0x0000B4 s2_3
+.word 0x460000B8 # R_MIPS_LO16 0x0000B8 s2_3
+.word 0x450000C0 # R_MIPS_HI16 0x0000C0 s2_1
+.word 0x460000C4 # R_MIPS_LO16 0x0000C4 s2_1
+.word 0x440000C8 # R_MIPS_26   0x0000C8 s3_0
+.word 0x450000CC # R_MIPS_HI16 0x0000CC s0_11
+.word 0x460000D0 # R_MIPS_LO16 0x0000D0 s0_11
+.word 0x440000D4 # R_MIPS_26   0x0000D4 s1_1
+.word 0x450000D8 # R_MIPS_HI16 0x0000D8 s0_5
+.word 0x460000DC # R_MIPS_LO16 0x0000DC s0_5
+.word 0x440000E0 # R_MIPS_26   0x0000E0 s1_1
+.word 0x450000E4 # R_MIPS_HI16 0x0000E4 
+.word 0x460000E8 # R_MIPS_LO16 0x0000E8 
+.word 0x450000F0 # R_MIPS_HI16 0x0000F0 s0_7
+.word 0x460000F4 # R_MIPS_LO16 0x0000F4 s0_7
+.word 0x440000F8 # R_MIPS_26   0x0000F8 s2_1
+.word 0x45000100 # R_MIPS_HI16 0x000100 s0_2
+.word 0x46000104 # R_MIPS_LO16 0x000104 s0_2
+.word 0x44000108 # R_MIPS_26   0x000108 
+.word 0x4500010C # R_MIPS_HI16 0x00010C s1_1
+.word 0x46000110 # R_MIPS_LO16 0x000110 s1_1
+.word 0x44000114 # R_MIPS_26   0x000114 
+.word 0x44000120 # R_MIPS_26   0x000120 s3_1
+.word 0x45000124 # R_MIPS_HI16 0x000124 s2_1
+.word 0x46000128 # R_MIPS_LO16 0x000128 s2_1
+.word 0x4400012C # R_MIPS_26   0x00012C s3_3
+.word 0x45000130 # R_MIPS_HI16 0x000130 s1_12
+.word 0x46000134 # R_MIPS_LO16 0x000134 s1_12
+.word 0x44000138 # R_MIPS_26   0x000138 s1_7
+.word 0x4500013C # R_MIPS_HI16 0x00013C s1_0
+.word 0x46000140 # R_MIPS_LO16 0x000140 s1_0
+.word 0x44000144 # R_MIPS_26   0x000144 
+.word 0x45000148 # R_MIPS_HI16 0x000148 s3_4
+.word 0x4600014C # R_MIPS_LO16 0x00014C s3_4
+.word 0x4400015C # R_MIPS_26   0x00015C s3_3
+.word 0x45000160 # R_MIPS_HI16 0x000160 s1_12
+.word 0x46000164 # R_MIPS_LO16 0x000164 s1_12
+.word 0x44000168 # R_MIPS_26   0x000168 s1_9
+.word 0x4500016C # R_MIPS_HI16 0x00016C s0_1
+.word 0x46000170 # R_MIPS_LO16 0x000170 s0_1
+.word 0x45000178 # R_MIPS_HI16 0x000178 s1_13
+.word 0x4600017C # R_MIPS_LO16 0x00017C s1_13
+.word 0x44000180 # R_MIPS_26   0x000180 s1_7
+.word 0x4400018C # R_MIPS_26   0x00018C s1_9
+.word 0x45000190 # R_MIPS_HI16 0x000190 s1_6
+.word 0x46000194 # R_MIPS_LO16 0x000194 s1_6
+.word 0x44000198 # R_MIPS_26   0x000198 s1_1
+.word 0x4500019C # R_MIPS_HI16 0x00019C s2_1
+.word 0x460001A0 # R_MIPS_LO16 0x0001A0 s2_1
+.word 0x450001A8 # R_MIPS_HI16 0x0001A8 s3_1
+.word 0x460001AC # R_MIPS_LO16 0x0001AC s3_1
+.word 0x440001B0 # R_MIPS_26   0x0001B0 
+.word 0x450001C0 # R_MIPS_HI16 0x0001C0 s0_0
+.word 0x460001C4 # R_MIPS_LO16 0x0001C4 s0_0
+.word 0x450001CC # R_MIPS_HI16 0x0001CC 
+.word 0x460001D0 # R_MIPS_LO16 0x0001D0 
+.word 0x450001D8 # R_MIPS_HI16 0x0001D8 s1_5
+.word 0x460001DC # R_MIPS_LO16 0x0001DC s1_5
+.word 0x440001E0 # R_MIPS_26   0x0001E0 s1_14
+.word 0x440001EC # R_MIPS_26   0x0001EC s1_7
+.word 0x450001F0 # R_MIPS_HI16 0x0001F0 s2_2
+.word 0x460001F4 # R_MIPS_LO16 0x0001F4 s2_2
+.word 0x440001F8 # R_MIPS_26   0x0001F8 s0_2
+.word 0x45000200 # R_MIPS_HI16 0x000200 s2_12
+.word 0x46000204 # R_MIPS_LO16 0x000204 s2_12
+.word 0x44000208 # R_MIPS_26   0x000208 s0_1
+.word 0x4500020C # R_MIPS_HI16 0x00020C s2_3
+.word 0x46000210 # R_MIPS_LO16 0x000210 s2_3
+.word 0x44000214 # R_MIPS_26   0x000214 s3_4
+.word 0x45000218 # R_MIPS_HI16 0x000218 s2_13
+.word 0x4600021C # R_MIPS_LO16 0x00021C s2_13
+.word 0x44000220 # R_MIPS_26   0x000220 s2_0
+.word 0x45000224 # R_MIPS_HI16 0x000224 s1_3
+.word 0x46000228 # R_MIPS_LO16 0x000228 s1_3
+.word 0x4400022C # R_MIPS_26   0x00022C 
+.word 0x45000230 # R_MIPS_HI16 0x000230 s2_2
+.word 0x46000234 # R_MIPS_LO16 0x000234 s2_2
+.word 0x44000238 # R_MIPS_26   0x000238 
+.word 0x4500023C # R_MIPS_HI16 0x00023C s2_5
+.word 0x46000240 # R_MIPS_LO16 0x000240 s2_5
+.word 0x44000244 # R_MIPS_26   0x000244 s2_12
+.word 0x44000250 # R_MIPS_26   0x000250 s2_15
+.word 0x45000254 # R_MIPS_HI16 0x000254 s0_3
+.word 0x46000258 # R_MIPS_LO16 0x000258 s0_3
+.word 0x4400025C # R_MIPS_26   0x00025C s2_4
+.word 0x45000260 # R_MIPS_HI16 0x000260 s1_1
+.word 0x46000264 # R_MIPS_LO16 0x000264 s1_1
+.word 0x44000268 # R_MIPS_26   0x000268 s2_7
+.word 0x4500026C # R_MIPS_HI16 0x00026C s1_3
+.word 0x46000270 # R_MIPS_LO16 0x000270 s1_3
+.word 0x45000278 # R_MIPS_HI16 0x000278 s2_6
+.word 0x4600027C # R_MIPS_LO16 0x00027C s2_6
+.word 0x45000284 # R_MIPS_HI16 0x000284 s2_14
+.word 0x46000288 # R_MIPS_LO16 0x000288 s2_14
+.word 0x4400028C # R_MIPS_26   0x00028C 
+.word 0x45000290 # R_MIPS_HI16 0x000290 
+.word 0x46000294 # R_MIPS_LO16 0x000294 
+.word 0x44000298 # R_MIPS_26   0x000298 s2_14
+.word 0x4500029C # R_MIPS_HI16 0x00029C s2_1
+.word 0x460002A0 # R_MIPS_LO16 0x0002A0 s2_1
+.word 0x440002A4 # R_MIPS_26   0x0002A4 s2_9
+.word 0x440002B0 # R_MIPS_26   0x0002B0 s2_1
+.word 0x450002B4 # R_MIPS_HI16 0x0002B4 s1_2
+.word 0x460002B8 # R_MIPS_LO16 0x0002B8 s1_2
+.word 0x440002BC # R_MIPS_26   0x0002BC s2_7
+.word 0x450002C0 # R_MIPS_HI16 0x0002C0 s3_4
+.word 0x460002C4 # R_MIPS_LO16 0x0002C4 s3_4
+.word 0x440002C8 # R_MIPS_26   0x0002C8 s2_2
+.word 0x450002CC # R_MIPS_HI16 0x0002CC s2_7
+.word 0x460002D0 # R_MIPS_LO16 0x0002D0 s2_7
+.word 0x440002D4 # R_MIPS_26   0x0002D4 s2_2
+.word 0x450002D8 # R_MIPS_HI16 0x0002D8 s2_4
+.word 0x460002DC # R_MIPS_LO16 0x0002DC s2_4
+.word 0x440002E0 # R_MIPS_26   0x0002E0 s2_11
+.word 0x450002E4 # R_MIPS_HI16 0x0002E4 s1_4
+.word 0x460002E8 # R_MIPS_LO16 0x0002E8 s1_4
+.word 0x440002EC # R_MIPS_26   0x0002EC s3_2
+.word 0x440002F8 # R_MIPS_26   0x0002F8 s1_1
+.word 0x45000300 # R_MIPS_HI16 0x000300 s1_2
+.word 0x46000304 # R_MIPS_LO16 0x000304 s1_2
+.word 0x44000308 # R_MIPS_26   0x000308 s3_1
+.word 0x4500030C # R_MIPS_HI16 0x00030C s0_1
+.word 0x46000310 # R_MIPS_LO16 0x000310 s0_1
+.word 0x44000314 # R_MIPS_26   0x000314 s3_12
+.word 0x45000318 # R_MIPS_HI16 0x000318 s3_4
+.word 0x4600031C # R_MIPS_LO16 0x00031C s3_4
+.word 0x4400032C # R_MIPS_26   0x00032C s3_13
+.word 0x45000330 # R_MIPS_HI16 0x000330 s0_3
+.word 0x46000334 # R_MIPS_LO16 0x000334 s0_3
+.word 0x44000338 # R_MIPS_26   0x000338 s3_6
+.word 0x4500033C # R_MIPS_HI16 0x00033C s3_8
+.word 0x46000340 # R_MIPS_LO16 0x000340 s3_8
+.word 0x44000344 # R_MIPS_26   0x000344 s1_4
+.word 0x45000348 # R_MIPS_HI16 0x000348 s3_13
+.word 0x4600034C # R_MIPS_LO16 0x00034C s3_13
+.word 0x44000350 # R_MIPS_26   0x000350 s3_3
+.word 0x45000354 # R_MIPS_HI16 0x000354 s3_9
+.word 0x46000358 # R_MIPS_LO16 0x000358 s3_9
+.word 0x4400035C # R_MIPS_26   0x00035C s0_5
+.word 0x45000360 # R_MIPS_HI16 0x000360 
+.word 0x46000364 # R_MIPS_LO16 0x000364 
+.word 0x44000368 # R_MIPS_26   0x000368 s3_13
+.word 0x4500036C # R_MIPS_HI16 0x00036C 
+.word 0x46000370 # R_MIPS_LO16 0x000370 
+.word 0x44000374 # R_MIPS_26   0x000374 s3_12
+.word 0x45000378 # R_MIPS_HI16 0x000378 s3_9
+.word 0x4600037C # R_MIPS_LO16 0x00037C s3_9
+.word 0x44000380 # R_MIPS_26   0x000380 
+.word 0x45000384 # R_MIPS_HI16 0x000384 s3_5
+.word 0x46000388 # R_MIPS_LO16 0x000388 s3_5
+.word 0x4400038C # R_MIPS_26   0x00038C s2_3
+.word 0x44000398 # R_MIPS_26   0x000398 s0_3
+.word 0x4500039C # R_MIPS_HI16 0x00039C s3_6
+.word 0x460003A0 # R_MIPS_LO16 0x0003A0 s3_6
+.word 0x440003A4 # R_MIPS_26   0x0003A4 s3_5
+.word 0x450003A8 # R_MIPS_HI16 0x0003A8 s1_2
+.word 0x460003AC # R_MIPS_LO16 0x0003AC s1_2
+.word 0x440003B0 # R_MIPS_26   0x0003B0 s3_8
+.word 0x450003B4 # R_MIPS_HI16 0x0003B4 s1_1
+.word 0x460003B8 # R_MIPS_LO16 0x0003B8 s1_1
+.word 0x440003BC # R_MIPS_26   0x0003BC s2_2
+.word 0x450003C0 # R_MIPS_HI16 0x0003C0 s2_3
+.word 0x460003C4 # R_MIPS_LO16 0x0003C4 s2_3
+.word 0x450003CC # R_MIPS_HI16 0x0003CC 
+.word 0x460003D0 # R_MIPS_LO16 0x0003D0 
+.word 0x440003D4 # R_MIPS_26   0x0003D4 
+.word 0x440003E0 # R_MIPS_26   0x0003E0 s3_11
+.word 0x450003E4 # R_MIPS_HI16 0x0003E4 s2_1
+.word 0x460003E8 # R_MIPS_LO16 0x0003E8 s2_1
+.word 0x440003EC # R_MIPS_26   0x0003EC s1_0
+.word 0x450003F0 # R_MIPS_HI16 0x0003F0 s3_1
+.word 0x460003F4 # R_MIPS_LO16 0x0003F4 s3_1
+
+# DATA RELOCS
+.word 0x82000008 # R_MIPS_32   0x000008 
+.word 0x8200000C # R_MIPS_32   0x00000C s0_12
+.word 0x82000010 # R_MIPS_32   0x000010 
+.word 0x82000014 # R_MIPS_32   0x000014 s0_11
+.word 0x82000018 # R_MIPS_32   0x000018 
+.word 0x82000020 # R_MIPS_32   0x000020 s0_10
+.word 0x82000024 # R_MIPS_32   0x000024 s0_13
+.word 0x82000028 # R_MIPS_32   0x000028 s1_4
+.word 0x82000030 # R_MIPS_32   0x000030 s1_5
+.word 0x82000034 # R_MIPS_32   0x000034 s0_0
+.word 0x82000038 # R_MIPS_32   0x000038 s2_0
+.word 0x82000040 # R_MIPS_32   0x000040 s0_5
+.word 0x82000044 # R_MIPS_32   0x000044 
+.word 0x82000048 # R_MIPS_32   0x000048 s1_3
+.word 0x82000050 # R_MIPS_32   0x000050 s0_10
+.word 0x82000054 # R_MIPS_32   0x000054 s1_2
+.word 0x82000058 # R_MIPS_32   0x000058 
+.word 0x8200005C # R_MIPS_32   0x00005C s0_1
+.word 0x82000060 # R_MIPS_32   0x000060 s0_2
+.word 0x82000070 # R_MIPS_32   0x000070 s3_0
+.word 0x82000078 # R_MIPS_32   0x000078 
+.word 0x8200007C # R_MIPS_32   0x00007C s1_1
+.word 0x82000080 # R_MIPS_32   0x000080 s1_14
+.word 0x82000084 # R_MIPS_32   0x000084 s1_7
+.word 0x8200008C # R_MIPS_32   0x00008C s2_5
+.word 0x82000090 # R_MIPS_32   0x000090 s1_14
+.word 0x82000094 # R_MIPS_32   0x000094 s1_5
+.word 0x82000098 # R_MIPS_32   0x000098 s2_1
+.word 0x8200009C # R_MIPS_32   0x00009C s1_3
+.word 0x820000A0 # R_MIPS_32   0x0000A0 
+.word 0x820000A4 # R_MIPS_32   0x0000A4 s0_2
+.word 0x820000A8 # R_MIPS_32   0x0000A8 s1_1
+.word 0x820000B0 # R_MIPS_32   0x0000B0 s1_13
+.word 0x820000BC # R_MIPS_32   0x0000BC s3_4
+.word 0x820000C4 # R_MIPS_32   0x0000C4 s1_8
+.word 0x820000CC # R_MIPS_32   0x0000CC s3_3
+.word 0x820000D0 # R_MIPS_32   0x0000D0 s1_6
+.word 0x820000E4 # R_MIPS_32   0x0000E4 s3_1
+.word 0x820000EC # R_MIPS_32   0x0000EC 
+.word 0x820000F0 # R_MIPS_32   0x0000F0 s2_15
+.word 0x820000F4 # R_MIPS_32   0x0000F4 s1_0
+.word 0x820000F8 # R_MIPS_32   0x0000F8 s2_10
+.word 0x820000FC # R_MIPS_32   0x0000FC s2_6
+.word 0x82000100 # R_MIPS_32   0x000100 s1_1
+.word 0x82000104 # R_MIPS_32   0x000104 s2_7
+.word 0x82000108 # R_MIPS_32   0x000108 s2_15
+.word 0x82000110 # R_MIPS_32   0x000110 s2_2
+.word 0x82000114 # R_MIPS_32   0x000114 s2_0
+.word 0x8200011C # R_MIPS_32   0x00011C 
+.word 0x82000120 # R_MIPS_32   0x000120 s2_5
+.word 0x82000128 # R_MIPS_32   0x000128 s1_1
+.word 0x8200012C # R_MIPS_32   0x00012C s2_13
+.word 0x82000130 # R_MIPS_32   0x000130 s1_4
+.word 0x82000134 # R_MIPS_32   0x000134 
+.word 0x8200013C # R_MIPS_32   0x00013C s3_3
+.word 0x82000140 # R_MIPS_32   0x000140 s2_2
+.word 0x82000150 # R_MIPS_32   0x000150 
+.word 0x82000154 # R_MIPS_32   0x000154 s1_3
+.word 0x82000158 # R_MIPS_32   0x000158 s3_4
+.word 0x82000160 # R_MIPS_32   0x000160 
+.word 0x82000164 # R_MIPS_32   0x000164 s3_9
+.word 0x82000168 # R_MIPS_32   0x000168 
+.word 0x82000170 # R_MIPS_32   0x000170 s0_1
+.word 0x82000174 # R_MIPS_32   0x000174 s0_3
+.word 0x8200017C # R_MIPS_32   0x00017C s0_2
+.word 0x82000180 # R_MIPS_32   0x000180 s1_4
+.word 0x82000184 # R_MIPS_32   0x000184 s3_4
+.word 0x82000188 # R_MIPS_32   0x000188 s3_13
+.word 0x82000190 # R_MIPS_32   0x000190 s3_5
+.word 0x82000194 # R_MIPS_32   0x000194 s3_5
+.word 0x82000198 # R_MIPS_32   0x000198 s3_4
+.word 0x8200019C # R_MIPS_32   0x00019C s1_0
+.word 0x820001A0 # R_MIPS_32   0x0001A0 s0_2
+.word 0x820001A8 # R_MIPS_32   0x0001A8 s3_8
+.word 0x820001AC # R_MIPS_32   0x0001AC s2_0
+.word 0x820001B0 # R_MIPS_32   0x0001B0 s3_6
+
+# RODATA RELOCS
+.word 0xC2000000 # R_MIPS_32   0x000000 s0_2
+.word 0xC2000004 # R_MIPS_32   0x000004 s0_0
+.word 0xC2000008 # R_MIPS_32   0x000008 s0_0
+.word 0xC200000C # R_MIPS_32   0x00000C s1_2
+.word 0xC2000010 # R_MIPS_32   0x000010 s3_3
+.word 0xC2000014 # R_MIPS_32   0x000014 s2_4
+.word 0xC200001C # R_MIPS_32   0x00001C 
+.word 0xC2000024 # R_MIPS_32   0x000024 s2_1
+.word 0xC2000028 # R_MIPS_32   0x000028 s0_8
+.word 0xC200002C # R_MIPS_32   0x00002C s2_4
+.word 0xC2000030 # R_MIPS_32   0x000030 s2_3
+.word 0xC2000034 # R_MIPS_32   0x000034 s0_0
+.word 0xC200003C # R_MIPS_32   0x00003C 
+.word 0xC2000044 # R_MIPS_32   0x000044 s0_3
+.word 0xC2000048 # R_MIPS_32   0x000048 s1_3
+.word 0xC200004C # R_MIPS_32   0x00004C s1_4
+.word 0xC200005C # R_MIPS_32   0x00005C s1_15
+.word 0xC2000060 # R_MIPS_32   0x000060 s2_11
+.word 0xC2000064 # R_MIPS_32   0x000064 
+.word 0xC200006C # R_MIPS_32   0x00006C s2_11
+.word 0xC2000070 # R_MIPS_32   0x000070 s2_0
+.word 0xC2000074 # R_MIPS_32   0x000074 s2_15
+.word 0xC2000084 # R_MIPS_32   0x000084 s2_10
+.word 0xC2000088 # R_MIPS_32   0x000088 s2_8
+.word 0xC200008C # R_MIPS_32   0x00008C s1_1
+.word 0xC2000090 # R_MIPS_32   0x000090 s3_15
+.word 0xC2000094 # R_MIPS_32   0x000094 s0_3
+.word 0xC2000098 # R_MIPS_32   0x000098 s3_6
+.word 0xC20000A0 # R_MIPS_32   0x0000A0 
+.word 0xC20000A4 # R_MIPS_32   0x0000A4 
+.word 0xC20000A8 # R_MIPS_32   0x0000A8 s1_4
+.word 0xC20000AC # R_MIPS_32   0x0000AC s2_2
+.word 0xC20000B0 # R_MIPS_32   0x0000B0 s3_2
+.word 0xC20000B4 # R_MIPS_32   0x0000B4 
+.word 0xC20000B8 # R_MIPS_32   0x0000B8 s1_0
+.word 0xC20000BC # R_MIPS_32   0x0000BC s1_3
+
+.word 0x00000520 # rela_multiOverlayInfoOffset
@@ -0,0 +1,114 @@
+.section .ovl, "a"
+# ovl_AOverlayInfo
+.word _ovl_ASegmentTextSize
+.word _ovl_ASegmentDataSize
+.word _ovl_ASegmentRoDataSize
+.word _ovl_ASegmentBssSize
+
+.word 95 # relocCount
+
+# TEXT RELOCS
+.word 0x45000000 # R_MIPS_HI16 0x000000 s0_7
+.word 0x46000004 # R_MIPS_LO16 0x000004 s0_7
+.word 0x44000008 # R_MIPS_26   0x000008 s0_10
+.word 0x4500000C # R_MIPS_HI16 0x00000C s0_12
+.word 0x46000010 # R_MIPS_LO16 0x000010 s0_12
+.word 0x44000014 # R_MIPS_26   0x000014 s0_12
+.word 0x45000018 # R_MIPS_HI16 0x000018 s0_6
+.word 0x4600001C # R_MIPS_LO16 0x00001C s0_6
+.word 0x44000020 # R_MIPS_26   0x000020 s0_14
+.word 0x45000024 # R_MIPS_HI16 0x000024 s0_9
+.word 0x46000028 # R_MIPS_LO16 0x000028 s0_9
+.word 0x4400002C # R_MIPS_26   0x00002C 
+.word 0x45000030 # R_MIPS_HI16 0x000030 s0_11
+.word 0x46000034 # R_MIPS_LO16 0x000034 s0_11
+.word 0x44000038 # R_MIPS_26   0x000038 s0_1
+.word 0x4500003C # R_MIPS_HI16 0x00003C s0_12
+.word 0x46000040 # R_MIPS_LO16 0x000040 s0_12
+.word 0x44000044 # R_MIPS_26   0x000044 s1_11
+.word 0x45000048 # R_MIPS_HI16 0x000048 s0_0
+.word 0x4600004C # R_MIPS_LO16 0x00004C s0_0
+.word 0x44000050 # R_MIPS_26   0x000050 s1_11
+.word 0x45000054 # R_MIPS_HI16 0x000054 s1_13
+.word 0x46000058 # R_MIPS_LO16 0x000058 s1_13
+.word 0x4400005C # R_MIPS_26   0x00005C 
+.word 0x45000060 # R_MIPS_HI16 0x000060 s1_10
+.word 0x46000064 # R_MIPS_LO16 0x000064 s1_10
+.word 0x44000068 # R_MIPS_26   0x000068 s0_3
+.word 0x44000074 # R_MIPS_26   0x000074 s1_2
+.word 0x45000078 # R_MIPS_HI16 0x000078 s1_6
+.word 0x4600007C # R_MIPS_LO16 0x00007C s1_6
+.word 0x45000080 # R_MIPS_HI16 0x000080 s0_14
+.word 0x46000084 # R_MIPS_LO16 0x000084 s0_14
+.word 0x44000088 # R_MIPS_26   0x000088 s1_8
+.word 0x4500008C # R_MIPS_HI16 0x00008C s0_10
+.word 0x46000090 # R_MIPS_LO16 0x000090 s0_10
+.word 0x44000094 # R_MIPS_26   0x000094 s1_11
+.word 0x45000098 # R_MIPS_HI16 0x000098 
+.word 0x4600009C # R_MIPS_LO16 0x00009C 
+.word 0x440000A0 # R_MIPS_26   0x0000A0 s1_11
+.word 0x450000A4 # R_MIPS_HI16 0x0000A4 
+.word 0x460000A8 # R_MIPS_LO16 0x0000A8 
+.word 0x440000AC # R_MIPS_26   0x0000AC s0_14
+.word 0x450000B0 # R_MIPS_HI16 0x0000B0 s1_8
+.word 0x460000B4 # R_MIPS_LO16 0x0000B4 s1_8
+.word 0x440000B8 # R_MIPS_26   0x0000B8 s0_6
+.word 0x450000BC # R_MIPS_HI16 0x0000BC s0_9
+.word 0x460000C0 # R_MIPS_LO16 0x0000C0 s0_9
+.word 0x440000C4 # R_MIPS_26   0x0000C4 s1_7
+.word 0x450000C8 # R_MIPS_HI16 0x0000C8 s0_1
+.word 0x460000CC # R_MIPS_LO16 0x0000CC s0_1
+.word 0x440000D0 # R_MIPS_26   0x0000D0 s1_14
+.word 0x450000D4 # R_MIPS_HI16 0x0000D4 
+.word 0x460000D8 # R_MIPS_LO16 0x0000D8 
+.word 0x440000DC # R_MIPS_26   0x0000DC s1_6
+.word 0x450000E0 # R_MIPS_HI16 0x0000E0 s1_6
+.word 0x460000E4 # R_MIPS_LO16 0x0000E4 s1_6
+.word 0x440000E8 # R_MIPS_26   0x0000E8 s0_5
+.word 0x450000EC # R_MIPS_HI16 0x0000EC s1_2
+.word 0x460000F0 # R_MIPS_LO16 0x0000F0 s1_2
+.word 0x440000F4 # R_MIPS_26   0x0000F4 s0_14
+.word 0x450000F8 # R_MIPS_HI16 0x0000F8 s1_11
+.word 0x460000FC # R_MIPS_LO16 0x0000FC s1_11
+
+# DATA RELOCS
+.word 0x82000000 # R_MIPS_32   0x000000 s0_9
+.word 0x82000004 # R_MIPS_32   0x000004 
+.word 0x82000008 # R_MIPS_32   0x000008 s0_6
+.word 0x8200000C # R_MIPS_32   0x00000C s0_1
+.word 0x82000010 # R_MIPS_32   0x000010 s0_9
+.word 0x82000014 # R_MIPS_32   0x000014 s1_14
+.word 0x8200001C # R_MIPS_32   0x00001C s1_12
+.word 0x82000020 # R_MIPS_32   0x000020 s1_1
+.word 0x82000024 # R_MIPS_32   0x000024 s0_0
+.word 0x82000028 # R_MIPS_32   0x000028 s1_2
+.word 0x8200002C # R_MIPS_32   0x00002C s0_11
+.word 0x82000030 # R_MIPS_32   0x000030 s1_2
+.word 0x82000034 # R_MIPS_32   0x000034 s1_6
+.word 0x82000038 # R_MIPS_32   0x000038 
+.word 0x8200003C # R_MIPS_32   0x00003C s1_2
+.word 0x82000040 # R_MIPS_32   0x000040 s0_4
+.word 0x82000048 # R_MIPS_32   0x000048 s1_2
+.word 0x82000050 # R_MIPS_32   0x000050 s1_11
+.word 0x82000054 # R_MIPS_32   0x000054 s1_3
+.word 0x82000058 # R_MIPS_32   0x000058 s1_1
+.word 0x8200005C # R_MIPS_32   0x00005C s1_3
+
+# RODATA RELOCS
+.word 0xC2000000 # R_MIPS_32   0x000000 s1_10
+.word 0xC2000004 # R_MIPS_32   0x000004 s0_8
+.word 0xC2000008 # R_MIPS_32   0x000008 s1_14
+.word 0xC200000C # R_MIPS_32   0x00000C s1_9
+.word 0xC2000010 # R_MIPS_32   0x000010 s1_11
+.word 0xC2000014 # R_MIPS_32   0x000014 s0_15
+.word 0xC2000020 # R_MIPS_32   0x000020 s1_7
+.word 0xC2000024 # R_MIPS_32   0x000024 s0_11
+.word 0xC2000028 # R_MIPS_32   0x000028 s0_1
+.word 0xC200002C # R_MIPS_32   0x00002C 
+.word 0xC2000030 # R_MIPS_32   0x000030 s1_8
+.word 0xC2000034 # R_MIPS_32   0x000034 s1_0
+.word 0
+.word 0
+.word 0
+
+.word 0x000001A0 # ovl_AOverlayInfoOffset
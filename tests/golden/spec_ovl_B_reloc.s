@@ -0,0 +1,58 @@
+.section .ovl, "a"
+# ovl_BOverlayInfo
+.word _ovl_BSegmentTextSize
+.word _ovl_BSegmentDataSize
+.word _ovl_BSegmentRoDataSize
+.word _ovl_BSegmentBssSize
+
+.word 39 # relocCount
+
+# TEXT RELOCS
+.word 0x45000000 # R_MIPS_HI16 0x000000 s0_3
+.word 0x46000004 # R_MIPS_LO16 0x000004 s0_3
+.word 0x44000008 # R_MIPS_26   0x000008 s0_12
+.word 0x4500000C # R_MIPS_HI16 0x00000C s0_6
+.word 0x46000010 # R_MIPS_LO16 0x000010 s0_6
+.word 0x44000014 # R_MIPS_26   0x000014 s0_6
+.word 0x45000018 # R_MIPS_HI16 0x000018 s0_4
+.word 0x4600001C # R_MIPS_LO16 0x00001C s0_4
+.word 0x44000020 # R_MIPS_26   0x000020 s0_14
+.word 0x45000024 # R_MIPS_HI16 0x000024 s0_3
+.word 0x46000028 # R_MIPS_LO16 0x000028 s0_3
+.word 0x4400002C # R_MIPS_26   0x00002C s0_2
+.word 0x45000030 # R_MIPS_HI16 0x000030 s0_6
+.word 0x46000034 # R_MIPS_LO16 0x000034 s0_6
+.word 0x44000038 # R_MIPS_26   0x000038 
+.word 0x4500003C # R_MIPS_HI16 0x00003C s0_7
+.word 0x46000040 # R_MIPS_LO16 0x000040 s0_7
+.word 0x44000044 # R_MIPS_26   0x000044 s0_13
+.word 0x45000048 # R_MIPS_HI16 0x000048 s0_11
+.word 0x4600004C # R_MIPS_LO16 0x00004C s0_11
+.word 0x44000050 # R_MIPS_26   0x000050 s0_10
+.word 0x45000054 # R_MIPS_HI16 0x000054 s0_1
+.word 0x46000058 # R_MIPS_LO16 0x000058 s0_1
+.word 0x4400005C # R_MIPS_26   0x00005C s0_6
+.word 0x44000060 # R_MIPS_26   0x000060 s0_10
+
+# DATA RELOCS
+.word 0x82000004 # R_MIPS_32   0x000004 s0_11
+.word 0x82000008 # R_MIPS_32   0x000008 s0_11
+.word 0x8200000C # R_MIPS_32   0x00000C s0_14
+.word 0x82000010 # R_MIPS_32   0x000010 s0_5
+.word 0x82000014 # R_MIPS_32   0x000014 s0_15
+.word 0x82000018 # R_MIPS_32   0x000018 s0_6
+.word 0x8200001C # R_MIPS_32   0x00001C s0_1
+.word 0x82000020 # R_MIPS_32   0x000020 s0_3
+.word 0x82000024 # R_MIPS_32   0x000024 s0_3
+
+# RODATA RELOCS
+.word 0xC2000000 # R_MIPS_32   0x000000 s0_15
+.word 0xC2000004 # R_MIPS_32   0x000004 s0_11
+.word 0xC2000008 # R_MIPS_32   0x000008 s0_5
+.word 0xC200000C # R_MIPS_32   0x00000C 
+.word 0xC2000010 # R_MIPS_32   0x000010 s0_6
+.word 0
+.word 0
+.word 0
+
+.word 0x000000C0 # ovl_BOverlayInfoOffset
@@ -0,0 +1,183 @@
+#!/usr/bin/env bash
+# Runs fado over the overlays listed in tests/cases.txt and compares the output with tests/golden/<name>.s, then over
+# every overlay of tests/spec/spec in one run and compares each output and dependency file with tests/golden/spec_*,
+# and the dependency file combining them all. Then checks --verify against a binary from --link, before and after
+# changing a reloc word, and compares the --load-cost and --hotspots reports of fixed overlays with tests/golden.
+# usage: tests/golden_test.sh [--update]
+# --update rewrites the golden files instead, for when an output change is intended.
+
+# Absolute, since the spec test runs in another directory
+FADO=$(realpath "${FADO:-./fado.elf}")
+MKOBJ=$(realpath "${MKOBJ:-build/tools/mkobj.elf}")
+TESTS_DIR=$(realpath "$(dirname "$0")")
+
+UPDATE=0
+if [ "$1" = "--update" ]; then
+    UPDATE=1
+fi
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+FAILED=0
+COUNT=0
+
+# Compare output with the golden file of name, or replace the golden file with it if updating
+Compare() {
+    local NAME=$1
+    local OUTPUT=$2
+    local GOLDEN=$3
+
+    if [ $UPDATE -ne 0 ]; then
+        cp "$OUTPUT" "$GOLDEN"
+        echo "$NAME: updated"
+    elif diff -u "$GOLDEN" "$OUTPUT"; then
+        echo "$NAME: passed"
+    else
+        echo "$NAME: FAILED, output differs from $GOLDEN"
+        FAILED=$((FAILED + 1))
+    fi
+}
+
+while IFS='|' read -r NAME MKOBJ_ARGS FADO_ARGS; do
+    NAME=$(echo $NAME)
+    case "$NAME" in
+        "" | "#"*) continue ;;
+    esac
+    COUNT=$((COUNT + 1))
+
+    if ! $MKOBJ $MKOBJ_ARGS "$WORK_DIR/$NAME" > /dev/null; then
+        echo "$NAME: FAILED to generate the objects"
+        FAILED=$((FAILED + 1))
+        continue
+    fi
+
+    # In index order, so that _10.o comes after _9.o
+    INPUTS=()
+    for ((i = 0; i < $(ls "$WORK_DIR/$NAME"_*.o | wc -l); i++)); do
+        INPUTS+=("$WORK_DIR/${NAME}_$i.o")
+    done
+    OUTPUT="$WORK_DIR/$NAME.s"
+    $FADO $FADO_ARGS -n "$NAME" -o "$OUTPUT" "${INPUTS[@]}"
+    STATUS=$?
+    if [ $STATUS -ne 0 ]; then
+        echo "$NAME: FAILED, fado exited with status $STATUS"
+        FAILED=$((FAILED + 1))
+        continue
+    fi
+
+    Compare "$NAME" "$OUTPUT" "$TESTS_DIR/golden/$NAME.s"
+done < "$TESTS_DIR/cases.txt"
+
+SPEC_DIR="$WORK_DIR/spec"
+while IFS='|' read -r PREFIX MKOBJ_ARGS; do
+    PREFIX=$(echo $PREFIX)
+    case "$PREFIX" in
+        "" | "#"*) continue ;;
+    esac
+    mkdir -p "$(dirname "$SPEC_DIR/$PREFIX")"
+    $MKOBJ $MKOBJ_ARGS "$SPEC_DIR/$PREFIX" > /dev/null
+done < "$TESTS_DIR/spec/objects.txt"
+
+if ! (cd "$SPEC_DIR" && $FADO -S "$TESTS_DIR/spec/spec"); then
+    echo "spec: FAILED, fado exited with an error"
+    FAILED=$((FAILED + 1))
+    COUNT=$((COUNT + 1))
+else
+    for OUTPUT in "$SPEC_DIR"/build/*/*_reloc.[sd]; do
+        NAME="spec_$(basename "$OUTPUT")"
+        COUNT=$((COUNT + 1))
+        Compare "$NAME" "$OUTPUT" "$TESTS_DIR/golden/$NAME"
+    done
+fi
+
+# The dependencies of all the overlays in one file
+COUNT=$((COUNT + 1))
+if ! (cd "$SPEC_DIR" && $FADO -S "$TESTS_DIR/spec/spec" -M deps.d -F ninja); then
+    echo "spec_deps_ninja: FAILED, fado exited with an error"
+    FAILED=$((FAILED + 1))
+else
+    Compare "spec_deps_ninja" "$SPEC_DIR/deps.d" "$TESTS_DIR/golden/spec_deps_ninja.d"
+fi
+
+# An overlay linked by --link passes --verify, and fails it with the mismatch printed once a reloc word is changed
+VERIFY_DIR="$WORK_DIR/verify"
+mkdir -p "$VERIFY_DIR"
+$MKOBJ -f 2 -r 100 -s 16 -u 0 -S 9 "$VERIFY_DIR/verify" > /dev/null
+VERIFY_INPUTS=("$VERIFY_DIR/verify_0.o" "$VERIFY_DIR/verify_1.o")
+VERIFY_BINARY="$VERIFY_DIR/verify.bin"
+COUNT=$((COUNT + 1))
+if ! $FADO -n verify --link 0x80800000 -o "$VERIFY_BINARY" "${VERIFY_INPUTS[@]}"; then
+    echo "verify_linked: FAILED, fado --link exited with an error"
+    FAILED=$((FAILED + 1))
+elif ! $FADO -n verify --verify "$VERIFY_BINARY" "${VERIFY_INPUTS[@]}"; then
+    echo "verify_linked: FAILED, fado --verify rejected the binary it linked"
+    FAILED=$((FAILED + 1))
+else
+    echo "verify_linked: passed"
+
+    # Flip a bit of the offset in the first reloc word, which follows the 5 words of the .ovl header
+    COUNT=$((COUNT + 1))
+    VERIFY_SIZE=$(stat -c %s "$VERIFY_BINARY")
+    VERIFY_OVL_OFFSET=$(od -An -tu4 --endian=big -j $((VERIFY_SIZE - 4)) -N 4 "$VERIFY_BINARY" | tr -d ' ')
+    VERIFY_BYTE_OFFSET=$((VERIFY_SIZE - VERIFY_OVL_OFFSET + 5 * 4 + 3))
+    VERIFY_BYTE=$(od -An -tu1 -j $VERIFY_BYTE_OFFSET -N 1 "$VERIFY_BINARY" | tr -d ' ')
+    printf "\\$(printf %03o $((VERIFY_BYTE ^ 4)))" |
+        dd of="$VERIFY_BINARY" bs=1 seek=$VERIFY_BYTE_OFFSET conv=notrunc status=none
+    if $FADO -n verify --verify "$VERIFY_BINARY" "${VERIFY_INPUTS[@]}" 2> "$VERIFY_DIR/verify_corrupt.txt"; then
+        echo "verify_corrupt: FAILED, fado --verify accepted a changed reloc"
+        FAILED=$((FAILED + 1))
+    else
+        Compare "verify_corrupt" "$VERIFY_DIR/verify_corrupt.txt" "$TESTS_DIR/golden/verify_corrupt.txt"
+    fi
+fi
+
+# --load-cost writes the header into an empty report, and later runs append their line to it
+LOAD_COST_DIR="$WORK_DIR/load_cost"
+mkdir -p "$LOAD_COST_DIR"
+$MKOBJ -f 2 -r 100 -s 16 -x 20 -S 11 "$LOAD_COST_DIR/load_cost" > /dev/null
+LOAD_COST_REPORT="$LOAD_COST_DIR/load_cost.tsv"
+: > "$LOAD_COST_REPORT"
+COUNT=$((COUNT + 1))
+if ! $FADO -n both --load-cost "$LOAD_COST_REPORT" -o /dev/null "$LOAD_COST_DIR"/load_cost_{0,1}.o ||
+    ! $FADO -n first --load-cost "$LOAD_COST_REPORT" -o /dev/null "$LOAD_COST_DIR/load_cost_0.o"; then
+    echo "load_cost: FAILED, fado exited with an error"
+    FAILED=$((FAILED + 1))
+else
+    Compare "load_cost" "$LOAD_COST_REPORT" "$TESTS_DIR/golden/load_cost.tsv"
+fi
+
+# --hotspots groups the relocs, keeps the --top ones, and escapes the object names in JSON. The first object's name
+# has a tab, quotes, a backslash and a control character, and the inputs are relative so the report does not have
+# the temporary directory in it.
+HOTSPOTS_DIR="$WORK_DIR/hotspots"
+HOTSPOTS_OBJECT=$(printf 'hot\t"quoted"\\\001.o')
+mkdir -p "$HOTSPOTS_DIR"
+$MKOBJ -f 2 -r 60 -s 3 -S 10 "$HOTSPOTS_DIR/hot" > /dev/null
+mv "$HOTSPOTS_DIR/hot_0.o" "$HOTSPOTS_DIR/$HOTSPOTS_OBJECT"
+for FORMAT in text json; do
+    NAME="hotspots_$FORMAT"
+    FORMAT_ARGS=()
+    if [ $FORMAT = json ]; then
+        FORMAT_ARGS=(--json)
+    fi
+    COUNT=$((COUNT + 1))
+    if ! (cd "$HOTSPOTS_DIR" && $FADO -n hot --hotspots "$NAME.txt" --top 5 "${FORMAT_ARGS[@]}" -o /dev/null \
+        "$HOTSPOTS_OBJECT" hot_1.o); then
+        echo "$NAME: FAILED, fado exited with an error"
+        FAILED=$((FAILED + 1))
+    else
+        Compare "$NAME" "$HOTSPOTS_DIR/$NAME.txt" "$TESTS_DIR/golden/$NAME.txt"
+    fi
+done
+
+if [ $FAILED -ne 0 ]; then
+    echo "$FAILED of $COUNT golden tests failed"
+    exit 1
+fi
+if [ $UPDATE -ne 0 ]; then
+    echo "Updated $COUNT golden files."
+else
+    echo "All $COUNT golden tests passed."
+fi
+exit 0
@@ -0,0 +1,76 @@
+#!/usr/bin/env bash
+# Runs fado --incremental on a generated overlay as its objects change, and checks that the output matches a normal run
+# each time, that only the changed objects were read unless the sidecar could not be used, and that an unchanged output
+# is left alone.
+# usage: tests/incremental_test.sh
+
+FADO=$(realpath "${FADO:-./fado.elf}")
+MKOBJ=$(realpath "${MKOBJ:-build/tools/mkobj.elf}")
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+INPUTS=("$WORK_DIR/ovl/z_0.o" "$WORK_DIR/ovl/z_1.o" "$WORK_DIR/ovl/z_2.o")
+OUTPUT="$WORK_DIR/ovl_z_reloc.s"
+SIDECAR="$WORK_DIR/ovl_z_reloc.fado"
+
+# Run fado --incremental, and check its output against a normal run's and its log for how it was made
+CheckRun() {
+    local DESCRIPTION=$1
+    local EXPECTED_LOG=$2
+    shift 2
+
+    if ! $FADO -v 1 --incremental "$SIDECAR" -n ovl_z -o "$OUTPUT" "$@" "${INPUTS[@]}" > "$WORK_DIR/log.txt" 2>&1; then
+        echo "incremental $DESCRIPTION: FAILED, fado exited with an error"
+        cat "$WORK_DIR/log.txt"
+        exit 1
+    fi
+    $FADO -n ovl_z -o "$WORK_DIR/expected.s" "$@" "${INPUTS[@]}"
+    if ! cmp -s "$WORK_DIR/expected.s" "$OUTPUT"; then
+        echo "incremental $DESCRIPTION: FAILED, output differs from a normal run"
+        diff "$WORK_DIR/expected.s" "$OUTPUT" | head -n 20
+        exit 1
+    fi
+    if ! grep -q "$EXPECTED_LOG" "$WORK_DIR/log.txt"; then
+        echo "incremental $DESCRIPTION: FAILED, expected '$EXPECTED_LOG' in the log"
+        cat "$WORK_DIR/log.txt"
+        exit 1
+    fi
+    echo "incremental $DESCRIPTION: passed"
+}
+
+mkdir "$WORK_DIR/ovl" "$WORK_DIR/new" "$WORK_DIR/other"
+$MKOBJ -f 3 -r 60 -x 30 -S 1 "$WORK_DIR/ovl/z" > /dev/null
+# The same symbols with different relocs and section sizes
+$MKOBJ -f 3 -r 90 -x 30 -S 2 "$WORK_DIR/new/z" > /dev/null
+# Different symbols
+$MKOBJ -f 3 -r 60 -x 30 -s 40 -S 3 "$WORK_DIR/other/z" > /dev/null
+
+CheckRun "initial" "Regenerating from all the input files"
+# Backdated, so that a rewrite within the same second would still show
+touch -d "2000-01-01 00:00:00" "$OUTPUT"
+OUTPUT_MTIME=$(stat -c %Y "$OUTPUT")
+CheckRun "unchanged" "0 of 3 input files changed"
+if [ "$(stat -c %Y "$OUTPUT")" != "$OUTPUT_MTIME" ]; then
+    echo "incremental unchanged: FAILED, output rewritten"
+    exit 1
+fi
+
+cp "$WORK_DIR/new/z_1.o" "$WORK_DIR/ovl/z_1.o"
+CheckRun "one changed" "1 of 3 input files changed"
+
+cp "$WORK_DIR/new/z_0.o" "$WORK_DIR/ovl/z_0.o"
+cp "$WORK_DIR/new/z_2.o" "$WORK_DIR/ovl/z_2.o"
+CheckRun "two changed" "2 of 3 input files changed"
+
+cp "$WORK_DIR/other/z_2.o" "$WORK_DIR/ovl/z_2.o"
+CheckRun "different symbols" "defines different symbols"
+
+CheckRun "other options" "is not for these inputs and options" --literal-sizes
+
+head -n 20 "$SIDECAR" > "$WORK_DIR/truncated"
+mv "$WORK_DIR/truncated" "$SIDECAR"
+CheckRun "truncated sidecar" "is not for these inputs and options" --literal-sizes
+
+echo "All incremental tests passed."
+exit 0
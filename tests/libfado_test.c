@@ -0,0 +1,464 @@
+/**
+ * Tests for fado used as a library: reading overlays from memory, getting the .ovl section as a buffer, using
+ * several contexts in the same process, prefetching the input files, reading them from archives, and linking.
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* open_memstream, mkdtemp */
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "fado.h"
+#include "fado_io.h"
+#include "fado_link.h"
+#include "fado_stats.h"
+#include "fairy/fairy.h"
+#include "objgen.h"
+#include "z64ovl/z64ovl.h"
+
+#define ASSERT_EQ(expected, actual)                                                                         \
+    do {                                                                                                    \
+        if ((expected) != (actual)) {                                                                       \
+            fprintf(stderr, "Failed line %u. Expected: 0x%" PRIXMAX ". Actual: 0x%" PRIXMAX ".\n", __LINE__, \
+                    (uintmax_t)(expected), (uintmax_t)(actual));                                            \
+            abort();                                                                                        \
+        }                                                                                                   \
+    } while (0)
+
+#define ASSERT_TRUE(actual) ASSERT_EQ(true, (actual))
+
+#define TEST_FILES_COUNT 3
+
+typedef struct {
+    char* buffers[TEST_FILES_COUNT];
+    size_t sizes[TEST_FILES_COUNT];
+    uint32_t relocsKept;
+} TestObjects;
+
+static void Test_GenerateObjects(TestObjects* objects, bool rela) {
+    ObjGenConfig config;
+    int i;
+
+    ObjGen_SetDefaults(&config);
+    config.filesCount = TEST_FILES_COUNT;
+    config.relocsCount = 300;
+    config.crossFilePercent = 30;
+    config.rela = rela;
+
+    objects->relocsKept = 0;
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        FILE* stream = open_memstream(&objects->buffers[i], &objects->sizes[i]);
+        ObjGenResult result;
+
+        ASSERT_TRUE(stream != NULL);
+        ASSERT_TRUE(ObjGen_WriteFile(stream, &config, i, &result));
+        fclose(stream);
+        objects->relocsKept += result.relocsKept;
+    }
+}
+
+static void Test_FreeObjects(TestObjects* objects) {
+    int i;
+
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        free(objects->buffers[i]);
+    }
+}
+
+static uint8_t* Test_MakeOvlSection(const FadoOverlay* overlay, size_t* sizeOut) {
+    uint8_t* section;
+
+    *sizeOut = Fado_GetOvlSectionSize(overlay->relocCount);
+    section = malloc(*sizeOut);
+    ASSERT_TRUE(section != NULL);
+    Fado_WriteOvlSection(section, overlay);
+    return section;
+}
+
+/**
+ * Reading from memory must give the same .ovl section as reading the same objects from files, and the section must
+ * have every reloc the generator expects kept, in the order of the text output.
+ */
+static void Test_ExtractFromBuffers(bool rela) {
+    const vc_allocator* allocators[FADO_MEMORY_MAX] = { NULL };
+    TestObjects objects;
+    FILE* inputFiles[TEST_FILES_COUNT];
+    FadoOverlay fromBuffers;
+    FadoOverlay fromFiles;
+    Z64OvlInfo info;
+    uint8_t* sectionFromBuffers;
+    uint8_t* sectionFromFiles;
+    size_t sectionSize;
+    size_t fileSectionSize;
+    FairySection section;
+    uint32_t i;
+
+    Test_GenerateObjects(&objects, rela);
+
+    ASSERT_TRUE(Fado_ExtractRelocsFromBuffers(&fromBuffers, TEST_FILES_COUNT, (const void* const*)objects.buffers,
+                                              objects.sizes, NULL, allocators));
+    ASSERT_EQ(objects.relocsKept, fromBuffers.relocCount);
+    sectionFromBuffers = Test_MakeOvlSection(&fromBuffers, &sectionSize);
+
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        inputFiles[i] = tmpfile();
+        ASSERT_TRUE(inputFiles[i] != NULL);
+        ASSERT_EQ(objects.sizes[i], fwrite(objects.buffers[i], 1, objects.sizes[i], inputFiles[i]));
+        rewind(inputFiles[i]);
+    }
+    Fado_ExtractRelocs(&fromFiles, TEST_FILES_COUNT, inputFiles);
+    sectionFromFiles = Test_MakeOvlSection(&fromFiles, &fileSectionSize);
+    ASSERT_EQ(fileSectionSize, sectionSize);
+    ASSERT_EQ(0, memcmp(sectionFromFiles, sectionFromBuffers, sectionSize));
+
+    ASSERT_TRUE(Z64Ovl_ReadOverlayInfo(&info, sectionFromBuffers, sectionSize));
+    ASSERT_EQ(sectionSize, info.infoOffset);
+    ASSERT_EQ(fromBuffers.sectionSizes[FAIRY_SECTION_TEXT], info.textSize);
+    ASSERT_EQ(fromBuffers.sectionSizes[FAIRY_SECTION_DATA], info.dataSize);
+    ASSERT_EQ(fromBuffers.sectionSizes[FAIRY_SECTION_RODATA], info.rodataSize);
+    ASSERT_EQ(fromBuffers.bssSize, info.bssSize);
+    ASSERT_EQ(fromBuffers.relocCount, info.relocCount);
+
+    i = 0;
+    for (section = FAIRY_SECTION_TEXT; section < FAIRY_SECTION_OTHER; section++) {
+        FadoRelocInfo* reloc;
+
+        VC_VECTOR_TYPED_FOREACH(reloc, &fromBuffers.relocList[section]) {
+            ASSERT_EQ(reloc->relocWord, Z64Ovl_ReadWord(&info.relocs[4 * i]));
+            i++;
+        }
+    }
+
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        fclose(inputFiles[i]);
+    }
+    free(sectionFromFiles);
+    free(sectionFromBuffers);
+    Fado_DestroyOverlay(&fromFiles);
+    Fado_DestroyOverlay(&fromBuffers);
+    Test_FreeObjects(&objects);
+}
+
+/**
+ * Overlays read with different contexts at the same time keep their own options and statistics
+ */
+static void Test_SeparateContexts(void) {
+    const vc_allocator* allocators[FADO_MEMORY_MAX] = { NULL };
+    TestObjects objects;
+    FairyContext quiet;
+    FairyContext aligned;
+    FadoStats alignedStats;
+    FadoOverlay first;
+    FadoOverlay second;
+    int i;
+
+    Fairy_InitContext(&quiet);
+    Fairy_InitContext(&aligned);
+    aligned.useElfAlignment = true;
+    Fado_StatsInit(&alignedStats, &aligned, TEST_FILES_COUNT, false);
+    aligned.stats = &alignedStats;
+    Test_GenerateObjects(&objects, false);
+
+    ASSERT_TRUE(Fado_ExtractRelocsFromBuffers(&first, TEST_FILES_COUNT, (const void* const*)objects.buffers,
+                                              objects.sizes, &quiet, allocators));
+    ASSERT_TRUE(Fado_ExtractRelocsFromBuffers(&second, TEST_FILES_COUNT, (const void* const*)objects.buffers,
+                                              objects.sizes, &aligned, allocators));
+    ASSERT_TRUE(first.context == &quiet);
+    ASSERT_TRUE(second.context == &aligned);
+    ASSERT_TRUE(first.fileInfos[0].context == &quiet);
+    ASSERT_TRUE(second.fileInfos[0].context == &aligned);
+    ASSERT_EQ(first.relocCount, second.relocCount);
+    ASSERT_EQ(first.fileInfos[0].bytesRead, second.fileInfos[0].bytesRead);
+    ASSERT_TRUE(first.fileInfos[0].bytesRead <= objects.sizes[0]);
+
+    /* Only the second was recorded, and all of it */
+    ASSERT_TRUE(quiet.stats == NULL);
+    ASSERT_EQ(second.relocCount, alignedStats.relocsKept);
+    ASSERT_EQ(TEST_FILES_COUNT * FAIRY_SECTION_OTHER, alignedStats.phases[FADO_PHASE_FILTER].calls);
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        ASSERT_EQ(1, alignedStats.files[i].calls);
+    }
+
+    Fado_DestroyOverlay(&second);
+    Fado_DestroyOverlay(&first);
+    ASSERT_EQ(2, alignedStats.phases[FADO_PHASE_TEARDOWN].calls);
+    Fado_StatsDestroy(&alignedStats);
+    Test_FreeObjects(&objects);
+}
+
+/**
+ * Files opened with their parts prefetched in batches, by io_uring or pread, give the same overlay as reading them
+ * directly, and a missing file fails with none left open
+ */
+static void Test_OpenInputFiles(bool useIoUring) {
+    const vc_allocator* allocators[FADO_MEMORY_MAX] = { NULL };
+    char directory[] = "/tmp/libfado_testXXXXXX";
+    char fileNames[TEST_FILES_COUNT + 1][sizeof(directory) + sizeof("/0.o")];
+    char* fileNamePointers[TEST_FILES_COUNT + 1];
+    FILE* inputFiles[TEST_FILES_COUNT + 1];
+    TestObjects objects;
+    FadoOverlay fromFiles;
+    FadoOverlay fromBuffers;
+    FadoIoStats stats;
+    uint8_t* sectionFromFiles;
+    uint8_t* sectionFromBuffers;
+    size_t sectionSize;
+    size_t bufferSectionSize;
+    int i;
+
+    Test_GenerateObjects(&objects, true);
+    ASSERT_TRUE(mkdtemp(directory) != NULL);
+    for (i = 0; i < TEST_FILES_COUNT + 1; i++) {
+        sprintf(fileNames[i], "%s/%d.o", directory, i);
+        fileNamePointers[i] = fileNames[i];
+    }
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        FILE* file = fopen(fileNames[i], "wb");
+
+        ASSERT_TRUE(file != NULL);
+        ASSERT_EQ(objects.sizes[i], fwrite(objects.buffers[i], 1, objects.sizes[i], file));
+        fclose(file);
+    }
+
+    ASSERT_TRUE(Fado_OpenInputFiles(inputFiles, TEST_FILES_COUNT, fileNamePointers, useIoUring, &stats));
+    ASSERT_EQ(3, stats.batches);
+    ASSERT_TRUE(!stats.usedIoUring || useIoUring);
+    Fado_ExtractRelocsWithAllocators(&fromFiles, TEST_FILES_COUNT, inputFiles, NULL, allocators);
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        fclose(inputFiles[i]);
+    }
+    ASSERT_TRUE(Fado_ExtractRelocsFromBuffers(&fromBuffers, TEST_FILES_COUNT, (const void* const*)objects.buffers,
+                                              objects.sizes, NULL, allocators));
+    sectionFromFiles = Test_MakeOvlSection(&fromFiles, &sectionSize);
+    sectionFromBuffers = Test_MakeOvlSection(&fromBuffers, &bufferSectionSize);
+    ASSERT_EQ(bufferSectionSize, sectionSize);
+    ASSERT_EQ(0, memcmp(sectionFromFiles, sectionFromBuffers, sectionSize));
+    ASSERT_EQ(fromBuffers.fileInfos[0].bytesRead, fromFiles.fileInfos[0].bytesRead);
+
+    /* The last file does not exist */
+    ASSERT_TRUE(!Fado_OpenInputFiles(inputFiles, TEST_FILES_COUNT + 1, fileNamePointers, useIoUring, &stats));
+
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        ASSERT_EQ(0, unlink(fileNames[i]));
+    }
+    ASSERT_EQ(0, rmdir(directory));
+    free(sectionFromBuffers);
+    free(sectionFromFiles);
+    Fado_DestroyOverlay(&fromBuffers);
+    Fado_DestroyOverlay(&fromFiles);
+    Test_FreeObjects(&objects);
+}
+
+static const char* sTestMemberNames[TEST_FILES_COUNT] = { "0.o", "a_rather_long_member_name.o", "2.o" };
+
+static void Test_WriteArchiveMember(FILE* archive, const char* headerName, const char* bsdName, const void* data,
+                                    size_t size) {
+    size_t nameSize = (bsdName == NULL) ? 0 : strlen(bsdName);
+
+    fprintf(archive, "%-16s%-12s%-6s%-6s%-8s%-10zu`\n", headerName, "0", "0", "0", "644", nameSize + size);
+    if (bsdName != NULL) {
+        fwrite(bsdName, 1, nameSize, archive);
+    }
+    fwrite(data, 1, size, archive);
+    if ((nameSize + size) % 2 != 0) {
+        fputc('\n', archive);
+    }
+}
+
+/**
+ * Write the objects to an archive in GNU's format, with a symbol index, a long name table and a text member, or in
+ * BSD's, with the names after the headers
+ */
+static void Test_WriteArchive(const char* fileName, const TestObjects* objects, bool bsd) {
+    static const char sNotes[] = "not an object\n";
+    FILE* archive = fopen(fileName, "wb");
+    char headerName[32];
+    int i;
+
+    ASSERT_TRUE(archive != NULL);
+    fputs("!<arch>\n", archive);
+    if (bsd) {
+        Test_WriteArchiveMember(archive, "#1/12", "__.SYMDEF\0\0\0", "\0\0\0\0", 4);
+    } else {
+        char longNames[64];
+
+        sprintf(longNames, "%s/\n", sTestMemberNames[1]);
+        Test_WriteArchiveMember(archive, "/", NULL, "\0\0\0\0", 4);
+        Test_WriteArchiveMember(archive, "//", NULL, longNames, strlen(longNames));
+    }
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        if (bsd) {
+            sprintf(headerName, "#1/%zu", strlen(sTestMemberNames[i]));
+            Test_WriteArchiveMember(archive, headerName, sTestMemberNames[i], objects->buffers[i], objects->sizes[i]);
+        } else {
+            if (strlen(sTestMemberNames[i]) < 16) {
+                sprintf(headerName, "%s/", sTestMemberNames[i]);
+            } else {
+                strcpy(headerName, "/0");
+            }
+            Test_WriteArchiveMember(archive, headerName, NULL, objects->buffers[i], objects->sizes[i]);
+        }
+        if (i == 0) {
+            Test_WriteArchiveMember(archive, bsd ? "notes.txt" : "notes.txt/", NULL, sNotes, strlen(sNotes));
+        }
+    }
+    fclose(archive);
+}
+
+static void Test_OpenArchiveInputs(bool bsd) {
+    const vc_allocator* allocators[FADO_MEMORY_MAX] = { NULL };
+    char directory[] = "/tmp/libfado_testXXXXXX";
+    char archiveName[sizeof(directory) + sizeof("/libtest.a")];
+    char memberInput[sizeof(archiveName) + sizeof("(a_rather_long_member_name.o)")];
+    char* inputNames[2];
+    TestObjects objects;
+    FadoInputs inputs;
+    FadoOverlay fromArchive;
+    FadoOverlay fromBuffers;
+    FadoIoStats stats;
+    uint8_t* sectionFromArchive;
+    uint8_t* sectionFromBuffers;
+    size_t sectionSize;
+    size_t bufferSectionSize;
+
+    Test_GenerateObjects(&objects, false);
+    ASSERT_TRUE(mkdtemp(directory) != NULL);
+    sprintf(archiveName, "%s/libtest.a", directory);
+    Test_WriteArchive(archiveName, &objects, bsd);
+
+    /* The whole archive, and one of its members again, which is read from the same mapping */
+    sprintf(memberInput, "%s(%s)", archiveName, sTestMemberNames[1]);
+    inputNames[0] = archiveName;
+    inputNames[1] = memberInput;
+    ASSERT_TRUE(Fado_ExpandInputs(&inputs, 2, inputNames));
+    ASSERT_EQ(TEST_FILES_COUNT + 1, inputs.count);
+    ASSERT_EQ(1, inputs.pathCount);
+    ASSERT_EQ(1, inputs.archiveCount);
+    ASSERT_EQ(0, strcmp(memberInput, inputs.names[1]));
+    ASSERT_EQ(0, strcmp(memberInput, inputs.names[TEST_FILES_COUNT]));
+    ASSERT_TRUE(Fado_OpenInputs(&inputs, true, &stats));
+    Fado_ExtractRelocsWithAllocators(&fromArchive, TEST_FILES_COUNT, inputs.files, NULL, allocators);
+    Fado_CloseInputs(&inputs);
+    Fado_FreeInputs(&inputs);
+
+    ASSERT_TRUE(Fado_ExtractRelocsFromBuffers(&fromBuffers, TEST_FILES_COUNT, (const void* const*)objects.buffers,
+                                              objects.sizes, NULL, allocators));
+    sectionFromArchive = Test_MakeOvlSection(&fromArchive, &sectionSize);
+    sectionFromBuffers = Test_MakeOvlSection(&fromBuffers, &bufferSectionSize);
+    ASSERT_EQ(bufferSectionSize, sectionSize);
+    ASSERT_EQ(0, memcmp(sectionFromArchive, sectionFromBuffers, sectionSize));
+
+    /* A member the archive does not have */
+    sprintf(memberInput, "%s(missing.o)", archiveName);
+    ASSERT_TRUE(!Fado_ExpandInputs(&inputs, 2, inputNames));
+    Fado_FreeInputs(&inputs);
+
+    ASSERT_EQ(0, unlink(archiveName));
+    ASSERT_EQ(0, rmdir(directory));
+    free(sectionFromBuffers);
+    free(sectionFromArchive);
+    Fado_DestroyOverlay(&fromBuffers);
+    Fado_DestroyOverlay(&fromArchive);
+    Test_FreeObjects(&objects);
+}
+
+static uint8_t* Test_LinkOverlay(const FadoOverlay* overlay, FILE** inputFiles, uint32_t vram,
+                                 const FadoLinkSymbols* externals, size_t* sizeOut) {
+    char* inputNames[TEST_FILES_COUNT] = { "0.o", "1.o", "2.o" };
+    char* image;
+    FILE* stream = open_memstream(&image, sizeOut);
+    bool success;
+
+    ASSERT_TRUE(stream != NULL);
+    success = Fado_LinkOverlay(stream, overlay, inputFiles, inputNames, vram, externals);
+    fclose(stream);
+    if (!success) {
+        free(image);
+        return NULL;
+    }
+    return (uint8_t*)image;
+}
+
+/**
+ * An overlay linked at one address and moved by the game's loader, using only its .ovl section, must be the same as
+ * the overlay linked at the other address in the first place
+ */
+static void Test_LinkAndRelocate(bool rela) {
+    const vc_allocator* allocators[FADO_MEMORY_MAX] = { NULL };
+    TestObjects objects;
+    FILE* inputFiles[TEST_FILES_COUNT];
+    FadoOverlay overlay;
+    FadoLinkSymbols externals;
+    FILE* symbolsFile;
+    char* symbolsText;
+    size_t symbolsSize;
+    Z64OvlInfo info;
+    uint8_t* image;
+    uint8_t* movedImage;
+    size_t imageSize;
+    size_t movedImageSize;
+    uint32_t i;
+
+    Test_GenerateObjects(&objects, rela);
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        inputFiles[i] = fmemopen(objects.buffers[i], objects.sizes[i], "rb");
+        ASSERT_TRUE(inputFiles[i] != NULL);
+    }
+    Fado_ExtractRelocsWithAllocators(&overlay, TEST_FILES_COUNT, inputFiles, NULL, allocators);
+
+    /* The symbols defined nowhere in the overlay, in the style of a linker script */
+    symbolsFile = open_memstream(&symbolsText, &symbolsSize);
+    fprintf(symbolsFile, "/* Outside the overlay */\n\n");
+    for (i = 0; i < 64; i++) {
+        fprintf(symbolsFile, "ext_%u = 0x%X; // %u\n", i, 0x80001000 + 0x10 * i, i);
+    }
+    fclose(symbolsFile);
+    symbolsFile = fmemopen(symbolsText, symbolsSize, "r");
+    ASSERT_TRUE(Fado_ReadLinkSymbols(&externals, symbolsFile, "symbols.ld"));
+    fclose(symbolsFile);
+    ASSERT_EQ(64, vc_vector_FadoLinkSymbol_count(&externals.symbols));
+
+    image = Test_LinkOverlay(&overlay, inputFiles, 0x80800000, &externals, &imageSize);
+    movedImage = Test_LinkOverlay(&overlay, inputFiles, 0x80A00000, &externals, &movedImageSize);
+    ASSERT_TRUE((image != NULL) && (movedImage != NULL));
+    ASSERT_EQ(overlay.sectionSizes[FAIRY_SECTION_TEXT] + overlay.sectionSizes[FAIRY_SECTION_DATA] +
+                  overlay.sectionSizes[FAIRY_SECTION_RODATA] + Fado_GetOvlSectionSize(overlay.relocCount),
+              imageSize);
+    ASSERT_EQ(imageSize, movedImageSize);
+    ASSERT_TRUE(memcmp(image, movedImage, imageSize) != 0);
+
+    ASSERT_TRUE(Z64Ovl_ReadOverlayInfo(&info, image, imageSize));
+    ASSERT_TRUE(Z64Ovl_Relocate(image, imageSize, &info, 0x80800000, 0x80A00000));
+    ASSERT_EQ(0, memcmp(image, movedImage, imageSize));
+    free(movedImage);
+    free(image);
+
+    /* Without the externals, their relocs cannot be resolved */
+    ASSERT_TRUE(Test_LinkOverlay(&overlay, inputFiles, 0x80800000, NULL, &imageSize) == NULL);
+
+    Fado_DestroyLinkSymbols(&externals);
+    free(symbolsText);
+    for (i = 0; i < TEST_FILES_COUNT; i++) {
+        fclose(inputFiles[i]);
+    }
+    Fado_DestroyOverlay(&overlay);
+    Test_FreeObjects(&objects);
+}
+
+int main(void) {
+    Test_ExtractFromBuffers(false);
+    Test_ExtractFromBuffers(true);
+    Test_SeparateContexts();
+    Test_OpenInputFiles(true);
+    Test_OpenInputFiles(false);
+    Test_OpenArchiveInputs(false);
+    Test_OpenArchiveInputs(true);
+    Test_LinkAndRelocate(false);
+    Test_LinkAndRelocate(true);
+    printf("Tests passed.\n");
+    return 0;
+}
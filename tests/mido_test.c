@@ -0,0 +1,130 @@
+/**
+ * Tests for the exact text of the dependency files, and for only writing them when they change.
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* open_memstream, mkdtemp */
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mido.h"
+
+#define ASSERT_EQ(expected, actual)                                                                         \
+    do {                                                                                                    \
+        if ((expected) != (actual)) {                                                                       \
+            fprintf(stderr, "Failed line %u. Expected: 0x%" PRIXMAX ". Actual: 0x%" PRIXMAX ".\n", __LINE__, \
+                    (uintmax_t)(expected), (uintmax_t)(actual));                                            \
+            abort();                                                                                        \
+        }                                                                                                   \
+    } while (0)
+
+#define ASSERT_TRUE(actual) ASSERT_EQ(true, (actual))
+
+#define ASSERT_STR_EQ(expected, actual)                                                                   \
+    do {                                                                                                  \
+        if (strcmp((expected), (actual)) != 0) {                                                          \
+            fprintf(stderr, "Failed line %u. Expected:\n%s\nActual:\n%s\n", __LINE__, (expected), (actual)); \
+            abort();                                                                                      \
+        }                                                                                                 \
+    } while (0)
+
+static char* Test_ReadFile(const char* fileName) {
+    FILE* file = fopen(fileName, "rb");
+    char* contents;
+    size_t size;
+
+    ASSERT_TRUE(file != NULL);
+    fseek(file, 0, SEEK_END);
+    size = (size_t)ftell(file);
+    rewind(file);
+    contents = malloc(size + 1);
+    ASSERT_EQ(size, fread(contents, 1, size, file));
+    contents[size] = '\0';
+    fclose(file);
+    return contents;
+}
+
+static void Test_Rule(MidoFormat format, const char* target, int inputFilesCount, char** inputFiles,
+                      const char* expected) {
+    char* contents;
+    size_t size;
+    FILE* stream = open_memstream(&contents, &size);
+
+    ASSERT_TRUE(stream != NULL);
+    Mido_WriteRule(stream, target, inputFilesCount, inputFiles, format);
+    fclose(stream);
+    ASSERT_STR_EQ(expected, contents);
+    free(contents);
+}
+
+static void Test_Formats(void) {
+    char* inputs[] = { "build/ovl_A/z_a.o", "build/ovl_A/z_a_2.o" };
+    char* escaped[] = { "my dir/a#1.o", "$b.o" };
+
+    Test_Rule(MIDO_FORMAT_MAKE, "ovl_A_reloc.o", 2, inputs,
+              "ovl_A_reloc.o: build/ovl_A/z_a.o build/ovl_A/z_a_2.o\n"
+              "\n"
+              "build/ovl_A/z_a.o:\n"
+              "\n"
+              "build/ovl_A/z_a_2.o:\n"
+              "\n");
+    Test_Rule(MIDO_FORMAT_NINJA, "ovl_A_reloc.o", 2, inputs, "ovl_A_reloc.o: build/ovl_A/z_a.o build/ovl_A/z_a_2.o\n");
+    Test_Rule(MIDO_FORMAT_NINJA, "out dir/x.o", 2, escaped, "out\\ dir/x.o: my\\ dir/a\\#1.o $$b.o\n");
+    Test_Rule(MIDO_FORMAT_MAKE, "x.o", 1, escaped, "x.o: my\\ dir/a\\#1.o\n\nmy\\ dir/a\\#1.o:\n\n");
+}
+
+/**
+ * Several rules in one file are written in the order they are added, and the file only when it changes
+ */
+static void Test_CombinedIfChanged(void) {
+    char directory[] = "/tmp/mido_testXXXXXX";
+    char fileName[sizeof(directory) + sizeof("/deps.d")];
+    char* inputsA[] = { "a.o" };
+    char* inputsB[] = { "b.o", "c.o" };
+    MidoOptions options = { MIDO_FORMAT_MAKE, true };
+    const char* expected = "A.o: a.o\n\na.o:\n\nB.o: b.o c.o\n\nb.o:\n\nc.o:\n\n";
+    MidoDependencyFile dependencyFile;
+    struct stat before;
+    struct stat after;
+    char* contents;
+
+    ASSERT_TRUE(mkdtemp(directory) != NULL);
+    sprintf(fileName, "%s/deps.d", directory);
+
+    ASSERT_TRUE(Mido_Begin(&dependencyFile, &options));
+    Mido_AddRule(&dependencyFile, "A.o", 1, inputsA);
+    Mido_AddRule(&dependencyFile, "B.o", 2, inputsB);
+    ASSERT_TRUE(Mido_End(&dependencyFile, fileName));
+    contents = Test_ReadFile(fileName);
+    ASSERT_STR_EQ(expected, contents);
+    free(contents);
+
+    ASSERT_EQ(0, Mido_WriteFileIfChanged(fileName, expected, strlen(expected)));
+    /* A prefix or an extension of the contents is a change */
+    ASSERT_EQ(1, Mido_WriteFileIfChanged(fileName, "A.o: a.o\n", 9));
+    ASSERT_EQ(0, Mido_WriteFileIfChanged(fileName, "A.o: a.o\n", 9));
+    ASSERT_EQ(1, Mido_WriteFileIfChanged(fileName, "A.o: a.o\n\n", 10));
+
+    /* An unchanged file keeps its inode and modification time */
+    ASSERT_EQ(0, stat(fileName, &before));
+    ASSERT_EQ(0, Mido_WriteFileIfChanged(fileName, "A.o: a.o\n\n", 10));
+    ASSERT_EQ(0, stat(fileName, &after));
+    ASSERT_EQ(before.st_ino, after.st_ino);
+    ASSERT_EQ(before.st_mtim.tv_sec, after.st_mtim.tv_sec);
+    ASSERT_EQ(before.st_mtim.tv_nsec, after.st_mtim.tv_nsec);
+
+    ASSERT_EQ(0, unlink(fileName));
+    ASSERT_EQ(0, rmdir(directory));
+}
+
+int main(void) {
+    Test_Formats();
+    Test_CombinedIfChanged();
+    printf("Tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,111 @@
+#!/usr/bin/env bash
+# Times fado over the overlays listed in tests/perf_cases.txt, each run followed by a calibration run of mkobj writing
+# the same objects, and compares the median ratio of the two over several runs with tests/perf_baseline.txt, failing if
+# any is more than PERF_TOLERANCE percent higher. Timing against a calibration run on the same machine, rather than in
+# absolute terms, makes the baseline hold across machines and while the machine is busy.
+# usage: tests/perf_test.sh [--update]
+# --update records the ratios as the new baseline instead, from a build without DEBUG or ASAN. It should also be rerun
+# when mkobj changes.
+
+FADO=${FADO:-./fado.elf}
+MKOBJ=${MKOBJ:-build/tools/mkobj.elf}
+TESTS_DIR=$(dirname "$0")
+BASELINE="$TESTS_DIR/perf_baseline.txt"
+RUNS=${PERF_RUNS:-9}
+TOLERANCE=${PERF_TOLERANCE:-30}
+
+UPDATE=0
+if [ "$1" = "--update" ]; then
+    UPDATE=1
+fi
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+if [ $UPDATE -ne 0 ]; then
+    echo "# name fado_to_calibration_permille, recorded by tests/perf_test.sh --update" > "$WORK_DIR/baseline.txt"
+fi
+
+FAILED=0
+COUNT=0
+
+# Time a command in microseconds, into ELAPSED
+TimeRun() {
+    local START
+
+    START=$(date +%s%N)
+    "$@" || return 1
+    ELAPSED=$((($(date +%s%N) - START) / 1000))
+}
+
+# A ratio in thousandths as a decimal
+FormatRatio() {
+    printf "%d.%03d" $(($1 / 1000)) $(($1 % 1000))
+}
+
+while IFS='|' read -r NAME MKOBJ_ARGS; do
+    NAME=$(echo $NAME)
+    case "$NAME" in
+        "" | "#"*) continue ;;
+    esac
+    COUNT=$((COUNT + 1))
+
+    if ! $MKOBJ $MKOBJ_ARGS "$WORK_DIR/$NAME" > /dev/null; then
+        echo "$NAME: FAILED to generate the objects"
+        FAILED=$((FAILED + 1))
+        continue
+    fi
+
+    INPUTS=()
+    for ((i = 0; i < $(ls "$WORK_DIR/$NAME"_*.o | wc -l); i++)); do
+        INPUTS+=("$WORK_DIR/${NAME}_$i.o")
+    done
+
+    # Each run is paired with the calibration run straight after it, which sees much the same conditions, and the
+    # median of the pairs' ratios is the least disturbed by the rest of the machine
+    RATIOS=()
+    for ((run = 0; run < RUNS; run++)); do
+        if ! TimeRun $FADO -n "$NAME" -o /dev/null "${INPUTS[@]}"; then
+            echo "$NAME: FAILED, fado exited with an error"
+            FAILED=$((FAILED + 1))
+            continue 2
+        fi
+        FADO_ELAPSED=$ELAPSED
+        if ! TimeRun $MKOBJ $MKOBJ_ARGS "$WORK_DIR/calibration" > /dev/null; then
+            echo "$NAME: FAILED, the calibration run exited with an error"
+            FAILED=$((FAILED + 1))
+            continue 2
+        fi
+        RATIOS+=($((FADO_ELAPSED * 1000 / ELAPSED)))
+    done
+    RATIO=$(printf "%s\n" "${RATIOS[@]}" | sort -n | sed -n "$((RUNS / 2 + 1))p")
+
+    if [ $UPDATE -ne 0 ]; then
+        echo "$NAME $RATIO" >> "$WORK_DIR/baseline.txt"
+        echo "$NAME: $(FormatRatio $RATIO)x calibration"
+        continue
+    fi
+
+    EXPECTED=$(awk -v name="$NAME" '$1 == name { print $2 }' "$BASELINE" 2> /dev/null)
+    if [ -z "$EXPECTED" ]; then
+        echo "$NAME: $(FormatRatio $RATIO)x calibration, no baseline"
+    elif [ $((RATIO * 100)) -gt $((EXPECTED * (100 + TOLERANCE))) ]; then
+        echo "$NAME: FAILED, $(FormatRatio $RATIO)x calibration against a baseline of $(FormatRatio $EXPECTED)x" \
+            "($((RATIO * 100 / EXPECTED - 100))% slower)"
+        FAILED=$((FAILED + 1))
+    else
+        echo "$NAME: passed, $(FormatRatio $RATIO)x calibration against a baseline of $(FormatRatio $EXPECTED)x"
+    fi
+done < "$TESTS_DIR/perf_cases.txt"
+
+if [ $UPDATE -ne 0 ]; then
+    cp "$WORK_DIR/baseline.txt" "$BASELINE"
+    echo "Recorded a baseline of $COUNT cases in $BASELINE."
+    exit $((FAILED != 0))
+fi
+if [ $FAILED -ne 0 ]; then
+    echo "$FAILED of $COUNT performance tests failed (tolerance $TOLERANCE%)"
+    exit 1
+fi
+echo "All $COUNT performance tests passed (tolerance $TOLERANCE%)."
+exit 0
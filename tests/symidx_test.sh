@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+# Indexes three generated overlays, the first referring to symbols of the second, and checks the answers to each kind of
+# query against what the overlays were generated to contain.
+# usage: tests/symidx_test.sh
+
+SYMIDX=$(realpath "${SYMIDX:-build/tools/symidx.elf}")
+MKOBJ=$(realpath "${MKOBJ:-build/tools/mkobj.elf}")
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+cd "$WORK_DIR" || exit 1
+
+FAILED=0
+
+# Compare the output of a query with what is expected
+Check() {
+    local NAME=$1
+    local EXPECTED=$2
+    local OUTPUT=$3
+
+    if [ "$EXPECTED" = "$OUTPUT" ]; then
+        echo "symidx $NAME: passed"
+    else
+        echo "symidx $NAME: FAILED"
+        diff -u <(echo "$EXPECTED") <(echo "$OUTPUT")
+        FAILED=$((FAILED + 1))
+    fi
+}
+
+mkdir ovl_a ovl_b ovl_c
+$MKOBJ -f 2 -s 2 -r 20 -p a_ -E b_ ovl_a/x > /dev/null
+$MKOBJ -f 1 -s 4 -r 20 -p b_ ovl_b/y > /dev/null
+$MKOBJ -f 1 -s 2 -r 20 -p c_ ovl_c/z > /dev/null
+ls ovl_*/*.o | $SYMIDX build index -
+
+Check "defines" "ovl_b/y_0.o" "$($SYMIDX defines index b_s0_1)"
+Check "refs" "b_s0_1 ovl_a/x_0.o
+b_s0_1 ovl_a/x_1.o
+a_s1_0 ovl_a/x_0.o" "$($SYMIDX refs index b_s0_1 a_s1_0)"
+Check "cross" "ovl_a -> ovl_b b_s0_0 ovl_a/x_0.o
+ovl_a -> ovl_b b_s0_0 ovl_a/x_1.o
+ovl_a -> ovl_b b_s0_1 ovl_a/x_0.o
+ovl_a -> ovl_b b_s0_1 ovl_a/x_1.o" "$($SYMIDX cross index)"
+Check "cross of one overlay" "" "$($SYMIDX cross index ovl_c)"
+# Defined nowhere
+Check "not found" "1" "$($SYMIDX defines index ext_0 > /dev/null; echo $?)"
+
+if [ $FAILED -ne 0 ]; then
+    echo "$FAILED symidx tests FAILED."
+    exit 1
+fi
+echo "All symidx tests passed."
+exit 0
@@ -0,0 +1,84 @@
+#!/usr/bin/env bash
+# Runs fado --watch on a generated overlay, rewrites its objects in place and by renaming a new version over the old,
+# and checks that the output is regenerated to match a normal run each time, that an output that is already up to date
+# is left alone, and that a truncated object is reported without stopping the watch.
+# usage: tests/watch_test.sh
+
+FADO=$(realpath "${FADO:-./fado.elf}")
+MKOBJ=$(realpath "${MKOBJ:-build/tools/mkobj.elf}")
+
+WORK_DIR=$(mktemp -d)
+WATCH_PID=
+trap 'if [ -n "$WATCH_PID" ]; then kill $WATCH_PID; fi; rm -rf "$WORK_DIR"' EXIT
+
+INPUTS=("$WORK_DIR/ovl/z_0.o" "$WORK_DIR/ovl/z_1.o")
+OUTPUT="$WORK_DIR/ovl_z_reloc.s"
+
+# Wait up to 5 seconds for the output to be what a normal run gives
+WaitForOutput() {
+    local DESCRIPTION=$1
+
+    $FADO -n ovl_z -o "$WORK_DIR/expected.s" "${INPUTS[@]}"
+    for ((i = 0; i < 100; i++)); do
+        if cmp -s "$WORK_DIR/expected.s" "$OUTPUT"; then
+            echo "watch $DESCRIPTION: passed"
+            return 0
+        fi
+        sleep 0.05
+    done
+    echo "watch $DESCRIPTION: FAILED, output not regenerated"
+    exit 1
+}
+
+# Wait up to 5 seconds for the watch's log to mention something
+WaitForLog() {
+    local DESCRIPTION=$1
+    local EXPECTED_LOG=$2
+
+    for ((i = 0; i < 100; i++)); do
+        if grep -q "$EXPECTED_LOG" "$WORK_DIR/log.txt"; then
+            echo "watch $DESCRIPTION: passed"
+            return 0
+        fi
+        sleep 0.05
+    done
+    echo "watch $DESCRIPTION: FAILED, expected '$EXPECTED_LOG' in the log"
+    cat "$WORK_DIR/log.txt"
+    exit 1
+}
+
+mkdir "$WORK_DIR/ovl" "$WORK_DIR/new"
+$MKOBJ -f 2 -r 50 -x 30 -S 1 "$WORK_DIR/ovl/z" > /dev/null
+$MKOBJ -f 2 -r 80 -x 30 -S 2 "$WORK_DIR/new/z" > /dev/null
+
+# Already up to date, so the first generation should not rewrite it
+$FADO -n ovl_z -o "$OUTPUT" "${INPUTS[@]}"
+$FADO --watch -n ovl_z -o "$OUTPUT" "${INPUTS[@]}" > "$WORK_DIR/log.txt" 2>&1 &
+WATCH_PID=$!
+WaitForLog "initial unchanged" "unchanged"
+WaitForOutput "initial"
+
+cat "$WORK_DIR/new/z_1.o" > "$WORK_DIR/ovl/z_1.o"
+WaitForOutput "in place"
+
+cp "$WORK_DIR/new/z_0.o" "$WORK_DIR/ovl/z_0.o.tmp"
+mv "$WORK_DIR/ovl/z_0.o.tmp" "$WORK_DIR/ovl/z_0.o"
+WaitForOutput "rename"
+
+# The last good version is kept while an object is half-written
+cp "$OUTPUT" "$WORK_DIR/good.s"
+head -c 200 "$WORK_DIR/new/z_1.o" > "$WORK_DIR/ovl/z_1.o"
+WaitForLog "truncated" "is truncated"
+if ! cmp -s "$WORK_DIR/good.s" "$OUTPUT"; then
+    echo "watch truncated: FAILED, output changed"
+    exit 1
+fi
+cat "$WORK_DIR/new/z_1.o" > "$WORK_DIR/ovl/z_1.o"
+WaitForOutput "after truncated"
+
+if ! kill -0 $WATCH_PID 2> /dev/null; then
+    echo "watch: FAILED, fado exited"
+    exit 1
+fi
+echo "All watch tests passed."
+exit 0
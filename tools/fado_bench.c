@@ -0,0 +1,259 @@
+/**
+ * Scaling benchmark of fado over generated overlays of 1 to 256 files and 100 to 1M relocs, reporting wall time,
+ * throughput and peak memory. With --stats, the filtering phase's time and hardware counters are also reported, as
+ * fado --stats would.
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _DEFAULT_SOURCE
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "fado.h"
+#include "fado_stats.h"
+#include "objgen.h"
+#include "vc_vector/vc_allocator.h"
+
+#define BENCH_DEFAULT_MAX_RELOCS 1000000
+#define BENCH_MAX_FILES 256
+#define BENCH_MIN_NS 200000000 /* Per measurement, spread over as many runs as necessary */
+
+/* Sent back from the child process running a case */
+typedef struct {
+    uint32_t runs;
+    uint32_t relocsKept;
+    uint64_t elapsedNs;
+    size_t inputBytes;
+    size_t peakHeapBytes;
+    bool haveCounters;
+    FadoPhaseStats filter; /* Over all the runs, if --stats */
+} BenchResult;
+
+static uint64_t Bench_Now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * Generate the overlay into temporary files, then extract and write its relocs repeatedly until enough time has passed
+ * for a stable measurement. The overlay is checked against what the generator expects fado to keep.
+ */
+static bool Bench_RunCase(const ObjGenConfig* config, bool stats, BenchResult* result) {
+    FILE** inputFiles = malloc(config->filesCount * sizeof(FILE*));
+    FILE* outputFile = fopen("/dev/null", "w");
+    FairyContext context;
+    FadoStats fadoStats;
+    uint32_t expectedKept = 0;
+    int i;
+
+    memset(result, 0, sizeof(*result));
+
+    for (i = 0; i < config->filesCount; i++) {
+        ObjGenResult generated;
+
+        inputFiles[i] = tmpfile();
+        if ((inputFiles[i] == NULL) || !ObjGen_WriteFile(inputFiles[i], config, i, &generated)) {
+            fprintf(stderr, "error: failed to generate file %d\n", i);
+            return false;
+        }
+        expectedKept += generated.relocsKept;
+        result->inputBytes += generated.bytesWritten;
+    }
+
+    Fairy_InitContext(&context);
+    if (stats) {
+        Fado_StatsInit(&fadoStats, NULL, config->filesCount, false);
+        context.stats = &fadoStats;
+    }
+
+    do {
+        FadoOverlay overlay;
+        vc_counting_allocator counting;
+        vc_allocator allocator;
+        const vc_allocator* allocators[FADO_MEMORY_MAX];
+        uint64_t start;
+
+        for (i = 0; i < config->filesCount; i++) {
+            rewind(inputFiles[i]);
+        }
+        vc_counting_allocator_init(&counting, NULL);
+        allocator = vc_counting_allocator_get(&counting);
+        for (i = 0; i < FADO_MEMORY_MAX; i++) {
+            allocators[i] = &allocator;
+        }
+
+        start = Bench_Now();
+        Fado_ExtractRelocsWithAllocators(&overlay, config->filesCount, inputFiles, &context, allocators);
+        Fado_WriteRelocs(outputFile, &overlay, "bench", false);
+        fflush(outputFile);
+        result->relocsKept = overlay.relocCount;
+        Fado_DestroyOverlay(&overlay);
+        result->elapsedNs += Bench_Now() - start;
+
+        result->runs++;
+        if (counting.peak_bytes > result->peakHeapBytes) {
+            result->peakHeapBytes = counting.peak_bytes;
+        }
+    } while (result->elapsedNs < BENCH_MIN_NS);
+
+    if (stats) {
+        result->haveCounters = fadoStats.haveCounters;
+        result->filter = fadoStats.phases[FADO_PHASE_FILTER];
+        Fado_StatsDestroy(&fadoStats);
+    }
+
+    for (i = 0; i < config->filesCount; i++) {
+        fclose(inputFiles[i]);
+    }
+    fclose(outputFile);
+    free(inputFiles);
+
+    if (result->relocsKept != expectedKept) {
+        fprintf(stderr, "error: fado kept %u relocs, expected %u\n", result->relocsKept, expectedKept);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Run a case in a forked child, so that the peak RSS reported by wait4 belongs to that case alone
+ */
+static bool Bench_Run(const ObjGenConfig* config, bool stats, bool json, bool first) {
+    BenchResult result;
+    struct rusage usage;
+    uint32_t totalRelocs = config->filesCount * config->relocsCount;
+    double nsPerRun;
+    bool received;
+    int status;
+    int fds[2];
+    pid_t pid;
+
+    fflush(stdout);
+    if (pipe(fds) != 0) {
+        return false;
+    }
+
+    pid = fork();
+    if (pid < 0) {
+        return false;
+    }
+    if (pid == 0) {
+        bool success;
+
+        close(fds[0]);
+        success = Bench_RunCase(config, stats, &result);
+        _exit((success && (write(fds[1], &result, sizeof(result)) == sizeof(result))) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    close(fds[1]);
+    received = (read(fds[0], &result, sizeof(result)) == sizeof(result));
+    close(fds[0]);
+    if ((wait4(pid, &status, 0, &usage) != pid) || !received || !WIFEXITED(status) ||
+        (WEXITSTATUS(status) != EXIT_SUCCESS) || (result.runs == 0)) {
+        return false;
+    }
+
+    nsPerRun = (double)result.elapsedNs / result.runs;
+    if (json) {
+        printf("%s\n  {\"files\": %d, \"relocs\": %u, \"kept\": %u, \"format\": \"%s\", \"input_bytes\": %zu, "
+               "\"runs\": %u, \"ms_per_run\": %.3f, \"mrelocs_per_s\": %.3f, \"peak_heap_bytes\": %zu, "
+               "\"peak_rss_kib\": %ld",
+               first ? "" : ",", config->filesCount, totalRelocs, result.relocsKept, config->rela ? "rela" : "rel",
+               result.inputBytes, result.runs, nsPerRun / 1e6, totalRelocs * 1e3 / nsPerRun, result.peakHeapBytes,
+               usage.ru_maxrss);
+        if (stats) {
+            printf(", \"filter_ms_per_run\": %.3f", result.filter.nanoseconds / 1e6 / result.runs);
+            if (result.haveCounters) {
+                printf(", \"filter_cycles_per_run\": %" PRIu64 ", \"filter_cache_misses_per_run\": %" PRIu64,
+                       result.filter.counters[FADO_COUNTER_CYCLES] / result.runs,
+                       result.filter.counters[FADO_COUNTER_CACHE_MISSES] / result.runs);
+            } else {
+                printf(", \"filter_cycles_per_run\": null, \"filter_cache_misses_per_run\": null");
+            }
+        }
+        printf("}");
+    } else {
+        printf("%d,%u,%u,%s,%zu,%u,%.3f,%.3f,%zu,%ld", config->filesCount, totalRelocs, result.relocsKept,
+               config->rela ? "rela" : "rel", result.inputBytes, result.runs, nsPerRun / 1e6,
+               totalRelocs * 1e3 / nsPerRun, result.peakHeapBytes, usage.ru_maxrss);
+        if (stats) {
+            printf(",%.3f", result.filter.nanoseconds / 1e6 / result.runs);
+            if (result.haveCounters) {
+                printf(",%" PRIu64 ",%" PRIu64, result.filter.counters[FADO_COUNTER_CYCLES] / result.runs,
+                       result.filter.counters[FADO_COUNTER_CACHE_MISSES] / result.runs);
+            } else {
+                printf(",-,-");
+            }
+        }
+        printf("\n");
+    }
+    return true;
+}
+
+static void Bench_PrintUsage(const char* program) {
+    fprintf(stderr, "usage: %s [--json] [--rela] [--stats] [max_relocs]\n", program);
+}
+
+int main(int argc, char** argv) {
+    uint32_t maxRelocs = BENCH_DEFAULT_MAX_RELOCS;
+    bool json = false;
+    bool rela = false;
+    bool stats = false;
+    bool first = true;
+    uint32_t relocs;
+    int files;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "--json") == 0) {
+            json = true;
+        } else if (strcmp(argv[arg], "--rela") == 0) {
+            rela = true;
+        } else if (strcmp(argv[arg], "--stats") == 0) {
+            stats = true;
+        } else if ((sscanf(argv[arg], "%" SCNu32, &maxRelocs) != 1) || (maxRelocs == 0)) {
+            Bench_PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (json) {
+        printf("[");
+    } else {
+        printf("files,relocs,kept,format,input_bytes,runs,ms_per_run,mrelocs_per_s,peak_heap_bytes,peak_rss_kib%s\n",
+               stats ? ",filter_ms_per_run,filter_cycles_per_run,filter_cache_misses_per_run" : "");
+    }
+    for (files = 1; files <= BENCH_MAX_FILES; files *= 4) {
+        for (relocs = 100; relocs <= maxRelocs; relocs *= 10) {
+            ObjGenConfig config;
+
+            /* Every file needs at least one reloc */
+            if (relocs < (uint32_t)files) {
+                continue;
+            }
+
+            ObjGen_SetDefaults(&config);
+            config.filesCount = files;
+            config.relocsCount = relocs / files;
+            config.rela = rela;
+            if (!Bench_Run(&config, stats, json, first)) {
+                fprintf(stderr, "error: benchmark failed for %d files, %u relocs\n", files, relocs);
+                return EXIT_FAILURE;
+            }
+            first = false;
+        }
+    }
+    printf(json ? "\n]\n" : "");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/**
+ * Command line front end to the synthetic object generator: writes the files of one overlay
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "objgen.h"
+
+static void MkObj_PrintUsage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [-f files] [-s symbols] [-r relocs] [-u undefined%%] [-x cross-file%%] [-e extra sections] [-a] "
+            "[-S seed] [-p symbol_prefix] [-E external_prefix] PREFIX\n"
+            "Writes PREFIX_0.o ... PREFIX_<files - 1>.o, big-endian MIPS relocatable objects forming one overlay.\n"
+            "  -f  files in the overlay (default 1)\n"
+            "  -s  global symbols defined in each file (default 64)\n"
+            "  -r  relocs in each file (default 1000)\n"
+            "  -u  percentage of relocs against symbols not defined in any file (default 5)\n"
+            "  -x  percentage of relocs against symbols defined in another file (default 10)\n"
+            "  -e  extra PROGBITS sections in each file (default 0)\n"
+            "  -a  use SHT_RELA reloc sections rather than SHT_REL\n"
+            "  -S  random seed (default 1)\n"
+            "  -p  prefix for the names of the symbols defined\n"
+            "  -E  name the symbols defined nowhere in the overlay after those of the first file of another overlay\n"
+            "      generated with -p external_prefix\n",
+            program);
+}
+
+static unsigned int MkObj_ParseNumber(const char* arg, const char* program) {
+    char* end;
+    unsigned long value = strtoul(arg, &end, 0);
+
+    if ((*arg == '\0') || (*end != '\0')) {
+        fprintf(stderr, "error: '%s' is not a number\n", arg);
+        MkObj_PrintUsage(program);
+        exit(EXIT_FAILURE);
+    }
+    return value;
+}
+
+int main(int argc, char** argv) {
+    ObjGenConfig config;
+    int opt;
+    int i;
+
+    ObjGen_SetDefaults(&config);
+
+    while ((opt = getopt(argc, argv, "f:s:r:u:x:e:aS:p:E:h")) != -1) {
+        switch (opt) {
+            case 'f':
+                config.filesCount = MkObj_ParseNumber(optarg, argv[0]);
+                break;
+
+            case 's':
+                config.symbolsCount = MkObj_ParseNumber(optarg, argv[0]);
+                break;
+
+            case 'r':
+                config.relocsCount = MkObj_ParseNumber(optarg, argv[0]);
+                break;
+
+            case 'u':
+                config.undefinedPercent = MkObj_ParseNumber(optarg, argv[0]);
+                break;
+
+            case 'x':
+                config.crossFilePercent = MkObj_ParseNumber(optarg, argv[0]);
+                break;
+
+            case 'e':
+                config.extraSections = MkObj_ParseNumber(optarg, argv[0]);
+                break;
+
+            case 'a':
+                config.rela = true;
+                break;
+
+            case 'S':
+                config.seed = MkObj_ParseNumber(optarg, argv[0]);
+                break;
+
+            case 'p':
+                config.symbolPrefix = optarg;
+                break;
+
+            case 'E':
+                config.externalPrefix = optarg;
+                break;
+
+            case 'h':
+                MkObj_PrintUsage(argv[0]);
+                return EXIT_SUCCESS;
+
+            default:
+                MkObj_PrintUsage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (optind != argc - 1) {
+        MkObj_PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!ObjGen_CheckConfig(&config)) {
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < config.filesCount; i++) {
+        ObjGenResult result;
+        char* fileName = malloc(snprintf(NULL, 0, "%s_%d.o", argv[optind], i) + 1);
+        FILE* file;
+
+        sprintf(fileName, "%s_%d.o", argv[optind], i);
+        file = fopen(fileName, "wb");
+        if (file == NULL) {
+            fprintf(stderr, "error: unable to open '%s' for writing\n", fileName);
+            return EXIT_FAILURE;
+        }
+        if (!ObjGen_WriteFile(file, &config, i, &result)) {
+            fprintf(stderr, "error: failed to write '%s'\n", fileName);
+            return EXIT_FAILURE;
+        }
+        fclose(file);
+
+        printf("%s: %zu bytes, %u relocs kept, %u dropped\n", fileName, result.bytesWritten, result.relocsKept,
+               result.relocsDropped);
+        free(fileName);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,424 @@
+/**
+ * Generator of synthetic big-endian MIPS relocatable objects, so that fado can be benchmarked without a compiler
+ * toolchain or a decomp checkout
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#include "objgen.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "macros.h"
+#include "mips_elf.h"
+#include "vc_vector/vc_vector_typed.h"
+
+#define OBJGEN_SHF_WRITE 0x1
+#define OBJGEN_SHF_ALLOC 0x2
+#define OBJGEN_SHF_EXECINSTR 0x4
+
+#define OBJGEN_EHDR_SIZE 0x34
+#define OBJGEN_SHDR_SIZE 0x28
+#define OBJGEN_SYM_SIZE 0x10
+#define OBJGEN_PROGBITS_ALIGN 0x10
+#define OBJGEN_BSS_SIZE 0x10
+#define OBJGEN_EXTRA_SECTION_SIZE 0x10
+
+/* Instructions carrying the relocs in .text; their immediates are left to the (implicit) addend of 0 */
+#define OBJGEN_OP_LUI_AT 0x3C010000
+#define OBJGEN_OP_ADDIU_AT 0x24210000
+#define OBJGEN_OP_JAL 0x0C000000
+
+VC_VECTOR_DECLARE_NAMED(bytes, uint8_t);
+
+/* The sections with relocs, in the same order as FairySection */
+typedef enum {
+    OBJGEN_SECTION_TEXT,
+    OBJGEN_SECTION_DATA,
+    OBJGEN_SECTION_RODATA,
+    OBJGEN_SECTION_MAX
+} ObjGenSection;
+
+static const char* sSectionNames[OBJGEN_SECTION_MAX] = { "text", "data", "rodata" };
+static const uint32_t sSectionFlags[OBJGEN_SECTION_MAX] = {
+    OBJGEN_SHF_ALLOC | OBJGEN_SHF_EXECINSTR,
+    OBJGEN_SHF_ALLOC | OBJGEN_SHF_WRITE,
+    OBJGEN_SHF_ALLOC,
+};
+
+/* Symbol table layout, which is the same in every file */
+typedef struct {
+    uint32_t firstGlobal; /* After the null symbol and the section symbols */
+    uint32_t firstExternal;
+    uint32_t firstCrossFile;
+    uint32_t count;
+} ObjGenSymtabLayout;
+
+typedef struct {
+    Elf32_Shdr header;
+    vc_vector_bytes contents; /* Empty for .bss */
+} ObjGenSectionInfo;
+
+void ObjGen_SetDefaults(ObjGenConfig* config) {
+    config->filesCount = 1;
+    config->symbolsCount = 64;
+    config->relocsCount = 1000;
+    config->undefinedPercent = 5;
+    config->crossFilePercent = 10;
+    config->extraSections = 0;
+    config->rela = false;
+    config->seed = 1;
+    config->symbolPrefix = "";
+    config->externalPrefix = NULL;
+}
+
+bool ObjGen_CheckConfig(const ObjGenConfig* config) {
+    if (config->filesCount < 1) {
+        fprintf(stderr, "error: an overlay needs at least one file\n");
+        return false;
+    }
+    if (config->symbolsCount < 1) {
+        fprintf(stderr, "error: each file needs at least one symbol\n");
+        return false;
+    }
+    if (config->undefinedPercent + config->crossFilePercent > 100) {
+        fprintf(stderr, "error: undefined and cross-file percentages add up to more than 100\n");
+        return false;
+    }
+    /* Fado stores reloc offsets in 24 bits */
+    if (config->relocsCount > 0xFFFFFF / 4) {
+        fprintf(stderr, "error: too many relocs for one file, maximum is %u\n", 0xFFFFFF / 4);
+        return false;
+    }
+    return true;
+}
+
+/* xorshift32, so the output only depends on the seed */
+static uint32_t ObjGen_Random(uint32_t* state) {
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static void ObjGen_Put8(vc_vector_bytes* vector, uint8_t value) {
+    vc_vector_bytes_push_back(vector, value);
+}
+
+static void ObjGen_Put16(vc_vector_bytes* vector, uint16_t value) {
+    ObjGen_Put8(vector, value >> 8);
+    ObjGen_Put8(vector, value & 0xFF);
+}
+
+static void ObjGen_Put32(vc_vector_bytes* vector, uint32_t value) {
+    ObjGen_Put16(vector, value >> 16);
+    ObjGen_Put16(vector, value & 0xFFFF);
+}
+
+static void ObjGen_Pad(vc_vector_bytes* vector, size_t alignment) {
+    while (vector->count % alignment != 0) {
+        ObjGen_Put8(vector, 0);
+    }
+}
+
+/* Append a null-terminated string to a string table, returning its offset */
+static uint32_t ObjGen_AddString(vc_vector_bytes* strtab, const char* string) {
+    uint32_t offset = strtab->count;
+
+    do {
+        ObjGen_Put8(strtab, *string);
+    } while (*string++ != '\0');
+
+    return offset;
+}
+
+static void ObjGen_AddSymbol(vc_vector_bytes* symtab, uint32_t name, uint32_t value, uint8_t info, uint16_t shndx) {
+    ObjGen_Put32(symtab, name);
+    ObjGen_Put32(symtab, value);
+    ObjGen_Put32(symtab, 0);
+    ObjGen_Put8(symtab, info);
+    ObjGen_Put8(symtab, 0);
+    ObjGen_Put16(symtab, shndx);
+}
+
+static void ObjGen_AddReloc(vc_vector_bytes* relocs, bool rela, uint32_t offset, uint32_t symbol, uint32_t type) {
+    ObjGen_Put32(relocs, offset);
+    ObjGen_Put32(relocs, ELF32_R_INFO(symbol, type));
+    if (rela) {
+        ObjGen_Put32(relocs, 0);
+    }
+}
+
+/**
+ * Pick the symbol of a reloc according to the configured mix, and record whether fado should keep it. A file that is
+ * alone in its overlay has nothing to refer to across files, so uses its own symbols instead.
+ */
+static uint32_t ObjGen_ChooseSymbol(const ObjGenConfig* config, const ObjGenSymtabLayout* layout, uint32_t* random,
+                                    uint32_t relocs, ObjGenResult* result) {
+    uint32_t roll = ObjGen_Random(random) % 100;
+    uint32_t pick = ObjGen_Random(random);
+
+    if (roll < config->undefinedPercent) {
+        result->relocsDropped += relocs;
+        return layout->firstExternal + pick % config->symbolsCount;
+    }
+
+    result->relocsKept += relocs;
+    if ((roll < config->undefinedPercent + config->crossFilePercent) && (config->filesCount > 1)) {
+        return layout->firstCrossFile + pick % config->symbolsCount;
+    }
+    /* Either a section symbol or one of this file's globals */
+    return 1 + pick % (OBJGEN_SECTION_MAX + config->symbolsCount);
+}
+
+static void ObjGen_BuildSymtab(vc_vector_bytes* symtab, vc_vector_bytes* strtab, const ObjGenConfig* config,
+                               const ObjGenSymtabLayout* layout, int fileIndex) {
+    char name[64];
+    uint32_t i;
+
+    ObjGen_AddString(strtab, "");
+    ObjGen_AddSymbol(symtab, 0, 0, 0, SHN_UNDEF);
+    for (i = 0; i < OBJGEN_SECTION_MAX; i++) {
+        ObjGen_AddSymbol(symtab, 0, 0, ELF32_ST_INFO(STB_LOCAL, STT_SECTION), 1 + i);
+    }
+
+    /* Defined globals, round robin over the sections */
+    for (i = 0; i < config->symbolsCount; i++) {
+        ObjGenSection section = i % OBJGEN_SECTION_MAX;
+
+        snprintf(name, sizeof(name), "%ss%d_%u", config->symbolPrefix, fileIndex, i);
+        ObjGen_AddSymbol(symtab, ObjGen_AddString(strtab, name), 4 * (i / OBJGEN_SECTION_MAX),
+                         ELF32_ST_INFO(STB_GLOBAL, (section == OBJGEN_SECTION_TEXT) ? STT_FUNC : STT_OBJECT),
+                         1 + section);
+    }
+
+    /* Symbols defined nowhere in the overlay */
+    for (i = 0; i < config->symbolsCount; i++) {
+        if (config->externalPrefix != NULL) {
+            snprintf(name, sizeof(name), "%ss0_%u", config->externalPrefix, i);
+        } else {
+            snprintf(name, sizeof(name), "ext_%u", i);
+        }
+        ObjGen_AddSymbol(symtab, ObjGen_AddString(strtab, name), 0, ELF32_ST_INFO(STB_GLOBAL, STT_NOTYPE), SHN_UNDEF);
+    }
+
+    /* Globals of the other files, each (file, symbol) pair at most once */
+    if (config->filesCount > 1) {
+        for (i = 0; i < config->symbolsCount; i++) {
+            uint32_t others = config->filesCount - 1;
+            int otherFile = (fileIndex + 1 + i % others) % config->filesCount;
+
+            snprintf(name, sizeof(name), "%ss%d_%u", config->symbolPrefix, otherFile,
+                     (i / others) % config->symbolsCount);
+            ObjGen_AddSymbol(symtab, ObjGen_AddString(strtab, name), 0, ELF32_ST_INFO(STB_GLOBAL, STT_NOTYPE),
+                             SHN_UNDEF);
+        }
+    }
+
+    assert(symtab->count == layout->count * OBJGEN_SYM_SIZE);
+}
+
+/**
+ * Fill in the contents of .text, .data and .rodata and their reloc sections. .text gets HI16/LO16 pairs and jals,
+ * the others 32-bit pointers; a quarter of the relocs go to .data and an eighth to .rodata.
+ */
+static void ObjGen_BuildSections(ObjGenSectionInfo* progBits, ObjGenSectionInfo* relocs, const ObjGenConfig* config,
+                                 const ObjGenSymtabLayout* layout, int fileIndex, ObjGenResult* result) {
+    uint32_t random = (config->seed ^ (0x9E3779B9 * (uint32_t)(fileIndex + 1))) | 1;
+    uint32_t sectionRelocs[OBJGEN_SECTION_MAX];
+    uint32_t minWords = (config->symbolsCount + OBJGEN_SECTION_MAX - 1) / OBJGEN_SECTION_MAX;
+    ObjGenSection section;
+    uint32_t i;
+
+    sectionRelocs[OBJGEN_SECTION_DATA] = config->relocsCount / 4;
+    sectionRelocs[OBJGEN_SECTION_RODATA] = config->relocsCount / 8;
+    sectionRelocs[OBJGEN_SECTION_TEXT] =
+        config->relocsCount - sectionRelocs[OBJGEN_SECTION_DATA] - sectionRelocs[OBJGEN_SECTION_RODATA];
+
+    for (section = OBJGEN_SECTION_TEXT; section < OBJGEN_SECTION_MAX; section++) {
+        vc_vector_bytes* contents = &progBits[section].contents;
+        vc_vector_bytes* relocContents = &relocs[section].contents;
+        uint32_t count = sectionRelocs[section];
+        uint32_t words = (count > minWords) ? count : minWords;
+
+        vc_vector_bytes_reserve(contents, ALIGN(4 * words, OBJGEN_PROGBITS_ALIGN));
+        vc_vector_bytes_reserve(relocContents, count * (config->rela ? sizeof(Elf32_Rela) : sizeof(Elf32_Rel)));
+
+        if (section == OBJGEN_SECTION_TEXT) {
+            for (i = 0; i < count; i++) {
+                uint32_t symbol;
+
+                if ((i % 3 == 0) && (i + 1 < count)) {
+                    /* A pair shares its symbol */
+                    symbol = ObjGen_ChooseSymbol(config, layout, &random, 2, result);
+                    ObjGen_AddReloc(relocContents, config->rela, 4 * i, symbol, R_MIPS_HI16);
+                    ObjGen_AddReloc(relocContents, config->rela, 4 * (i + 1), symbol, R_MIPS_LO16);
+                    ObjGen_Put32(contents, OBJGEN_OP_LUI_AT);
+                    ObjGen_Put32(contents, OBJGEN_OP_ADDIU_AT);
+                    i++;
+                } else {
+                    symbol = ObjGen_ChooseSymbol(config, layout, &random, 1, result);
+                    ObjGen_AddReloc(relocContents, config->rela, 4 * i, symbol, R_MIPS_26);
+                    ObjGen_Put32(contents, OBJGEN_OP_JAL);
+                }
+            }
+        } else {
+            for (i = 0; i < count; i++) {
+                ObjGen_AddReloc(relocContents, config->rela, 4 * i,
+                                ObjGen_ChooseSymbol(config, layout, &random, 1, result), R_MIPS_32);
+                ObjGen_Put32(contents, 0);
+            }
+        }
+
+        /* Room for the symbols defined in the section */
+        for (; i < words; i++) {
+            ObjGen_Put32(contents, 0);
+        }
+        ObjGen_Pad(contents, OBJGEN_PROGBITS_ALIGN);
+    }
+}
+
+static void ObjGen_SetHeader(ObjGenSectionInfo* section, uint32_t name, uint32_t type, uint32_t flags, uint32_t link,
+                             uint32_t info, uint32_t addralign, uint32_t entsize) {
+    section->header.sh_name = name;
+    section->header.sh_type = type;
+    section->header.sh_flags = flags;
+    section->header.sh_link = link;
+    section->header.sh_info = info;
+    section->header.sh_addralign = addralign;
+    section->header.sh_entsize = entsize;
+}
+
+static void ObjGen_WriteElfHeader(uint8_t* buffer, uint32_t shoff, uint16_t shnum, uint16_t shstrndx) {
+    vc_vector_bytes header;
+    static const uint8_t ident[EI_NIDENT] = { 0x7F, 'E', 'L', 'F', ELFCLASS32, ELFDATA2MSB, EV_CURRENT };
+
+    vc_vector_bytes_init(&header, OBJGEN_EHDR_SIZE);
+    memcpy(header.data, ident, EI_NIDENT);
+    header.count = EI_NIDENT;
+    ObjGen_Put16(&header, ET_REL);
+    ObjGen_Put16(&header, EM_MIPS);
+    ObjGen_Put32(&header, EV_CURRENT);
+    ObjGen_Put32(&header, 0); /* e_entry */
+    ObjGen_Put32(&header, 0); /* e_phoff */
+    ObjGen_Put32(&header, shoff);
+    ObjGen_Put32(&header, 0); /* e_flags */
+    ObjGen_Put16(&header, OBJGEN_EHDR_SIZE);
+    ObjGen_Put16(&header, 0); /* e_phentsize */
+    ObjGen_Put16(&header, 0); /* e_phnum */
+    ObjGen_Put16(&header, OBJGEN_SHDR_SIZE);
+    ObjGen_Put16(&header, shnum);
+    ObjGen_Put16(&header, shstrndx);
+
+    memcpy(buffer, header.data, OBJGEN_EHDR_SIZE);
+    vc_vector_bytes_release(&header);
+}
+
+/**
+ * Write file number fileIndex of the overlay described by config. The sections are laid out as
+ *
+ * null, .text, .data, .rodata, .bss, extra sections, reloc sections, .symtab, .strtab, .shstrtab
+ *
+ * with the section header table at the end. Returns false if the file could not be written.
+ */
+bool ObjGen_WriteFile(FILE* file, const ObjGenConfig* config, int fileIndex, ObjGenResult* result) {
+    ObjGenSymtabLayout layout;
+    uint32_t firstReloc = 5 + config->extraSections;
+    uint32_t symtabIndex = firstReloc + OBJGEN_SECTION_MAX;
+    uint32_t sectionsCount = symtabIndex + 3;
+    ObjGenSectionInfo* sections = calloc(sectionsCount, sizeof(ObjGenSectionInfo));
+    vc_vector_bytes* shstrtab = &sections[symtabIndex + 2].contents;
+    vc_vector_bytes output;
+    char name[32];
+    uint32_t i;
+    bool success;
+
+    layout.firstGlobal = 1 + OBJGEN_SECTION_MAX;
+    layout.firstExternal = layout.firstGlobal + config->symbolsCount;
+    layout.firstCrossFile = layout.firstExternal + config->symbolsCount;
+    layout.count = layout.firstCrossFile + ((config->filesCount > 1) ? config->symbolsCount : 0);
+
+    result->relocsKept = 0;
+    result->relocsDropped = 0;
+
+    ObjGen_AddString(shstrtab, "");
+    for (i = 0; i < OBJGEN_SECTION_MAX; i++) {
+        snprintf(name, sizeof(name), ".%s", sSectionNames[i]);
+        ObjGen_SetHeader(&sections[1 + i], ObjGen_AddString(shstrtab, name), SHT_PROGBITS, sSectionFlags[i], 0, 0,
+                         OBJGEN_PROGBITS_ALIGN, 0);
+
+        snprintf(name, sizeof(name), "%s.%s", config->rela ? ".rela" : ".rel", sSectionNames[i]);
+        ObjGen_SetHeader(&sections[firstReloc + i], ObjGen_AddString(shstrtab, name),
+                         config->rela ? SHT_RELA : SHT_REL, 0, symtabIndex, 1 + i, 4,
+                         config->rela ? sizeof(Elf32_Rela) : sizeof(Elf32_Rel));
+    }
+    ObjGen_SetHeader(&sections[4], ObjGen_AddString(shstrtab, ".bss"), SHT_NOBITS,
+                     OBJGEN_SHF_ALLOC | OBJGEN_SHF_WRITE, 0, 0, OBJGEN_PROGBITS_ALIGN, 0);
+    sections[4].header.sh_size = OBJGEN_BSS_SIZE;
+    for (i = 0; i < config->extraSections; i++) {
+        snprintf(name, sizeof(name), ".extra.%u", i);
+        ObjGen_SetHeader(&sections[5 + i], ObjGen_AddString(shstrtab, name), SHT_PROGBITS, 0, 0, 0, 4, 0);
+        vc_vector_bytes_reserve(&sections[5 + i].contents, OBJGEN_EXTRA_SECTION_SIZE);
+        while (sections[5 + i].contents.count < OBJGEN_EXTRA_SECTION_SIZE) {
+            ObjGen_Put8(&sections[5 + i].contents, 0);
+        }
+    }
+    ObjGen_SetHeader(&sections[symtabIndex], ObjGen_AddString(shstrtab, ".symtab"), SHT_SYMTAB, 0, symtabIndex + 1,
+                     layout.firstGlobal, 4, OBJGEN_SYM_SIZE);
+    ObjGen_SetHeader(&sections[symtabIndex + 1], ObjGen_AddString(shstrtab, ".strtab"), SHT_STRTAB, 0, 0, 0, 1, 0);
+    ObjGen_SetHeader(&sections[symtabIndex + 2], ObjGen_AddString(shstrtab, ".shstrtab"), SHT_STRTAB, 0, 0, 0, 1, 0);
+
+    ObjGen_BuildSections(&sections[1], &sections[firstReloc], config, &layout, fileIndex, result);
+    vc_vector_bytes_reserve(&sections[symtabIndex].contents, layout.count * OBJGEN_SYM_SIZE);
+    ObjGen_BuildSymtab(&sections[symtabIndex].contents, &sections[symtabIndex + 1].contents, config, &layout,
+                       fileIndex);
+
+    /* Lay out the file: header, section contents, section header table */
+    vc_vector_bytes_init(&output, OBJGEN_EHDR_SIZE);
+    output.count = OBJGEN_EHDR_SIZE;
+    for (i = 1; i < sectionsCount; i++) {
+        Elf32_Shdr* header = &sections[i].header;
+
+        ObjGen_Pad(&output, (header->sh_addralign > 4) ? header->sh_addralign : 4);
+        header->sh_offset = output.count;
+        if (header->sh_type != SHT_NOBITS) {
+            header->sh_size = sections[i].contents.count;
+            vc_vector_bytes_reserve(&output, output.count + sections[i].contents.count);
+            if (sections[i].contents.count != 0) {
+                memcpy(&output.data[output.count], sections[i].contents.data, sections[i].contents.count);
+            }
+            output.count += sections[i].contents.count;
+        }
+    }
+
+    ObjGen_Pad(&output, 4);
+    ObjGen_WriteElfHeader(output.data, output.count, sectionsCount, symtabIndex + 2);
+    for (i = 0; i < sectionsCount; i++) {
+        const Elf32_Shdr* header = &sections[i].header;
+
+        ObjGen_Put32(&output, header->sh_name);
+        ObjGen_Put32(&output, header->sh_type);
+        ObjGen_Put32(&output, header->sh_flags);
+        ObjGen_Put32(&output, header->sh_addr);
+        ObjGen_Put32(&output, header->sh_offset);
+        ObjGen_Put32(&output, header->sh_size);
+        ObjGen_Put32(&output, header->sh_link);
+        ObjGen_Put32(&output, header->sh_info);
+        ObjGen_Put32(&output, header->sh_addralign);
+        ObjGen_Put32(&output, header->sh_entsize);
+    }
+
+    success = (fwrite(output.data, 1, output.count, file) == output.count);
+    result->bytesWritten = output.count;
+
+    vc_vector_bytes_release(&output);
+    for (i = 0; i < sectionsCount; i++) {
+        vc_vector_bytes_release(&sections[i].contents);
+    }
+    free(sections);
+
+    return success;
+}
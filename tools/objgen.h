@@ -0,0 +1,36 @@
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Description of a synthetic overlay: every file of it has the same shape, but defines its own symbols and refers to
+ * the other files' ones.
+ */
+typedef struct {
+    int filesCount;            /* Files in the overlay */
+    uint32_t symbolsCount;     /* Global symbols defined in each file, spread over .text, .data and .rodata */
+    uint32_t relocsCount;      /* Relocs in each file */
+    uint32_t undefinedPercent; /* Relocs against symbols defined nowhere in the overlay, which fado drops */
+    uint32_t crossFilePercent; /* Relocs against symbols defined in another file of the overlay, which fado keeps */
+    uint32_t extraSections;    /* Additional PROGBITS sections that fado should ignore */
+    bool rela;                 /* Write SHT_RELA sections instead of SHT_REL */
+    uint32_t seed;
+    const char* symbolPrefix;   /* Before the names of the symbols the files define */
+    const char* externalPrefix; /* The symbolPrefix of another overlay, to refer to its first file's symbols rather than
+                                 * to ones defined nowhere, or NULL */
+} ObjGenConfig;
+
+/* What fado should make of a generated file */
+typedef struct {
+    uint32_t relocsKept;
+    uint32_t relocsDropped;
+    size_t bytesWritten;
+} ObjGenResult;
+
+void ObjGen_SetDefaults(ObjGenConfig* config);
+bool ObjGen_CheckConfig(const ObjGenConfig* config);
+bool ObjGen_WriteFile(FILE* file, const ObjGenConfig* config, int fileIndex, ObjGenResult* result);
@@ -0,0 +1,542 @@
+/**
+ * Index of the global symbols of many objects, built once into a file and then queried for which objects define or
+ * refer to a symbol, and which overlays refer to symbols defined in other overlays
+ */
+/* Copyright (C) 2021 Elliptic Ellipsis */
+/* SPDX-License-Identifier: AGPL-3.0-only */
+#define _POSIX_C_SOURCE 200809L /* getline, strdup */
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "fado_io.h"
+#include "fairy/fairy.h"
+#include "vc_vector/vc_vector_typed.h"
+
+/**
+ * The index file, all in host byte order and 4-byte words, as it is only a cache of the objects:
+ * header, objects, overlays, symbols sorted by name, entries, strings.
+ * Each symbol's entries are the objects defining it, then the objects referring to it, each in index order.
+ */
+#define SYMIDX_MAGIC "SYMIDX1\n"
+
+typedef struct {
+    char magic[8];
+    uint32_t objectsCount;
+    uint32_t overlaysCount;
+    uint32_t symbolsCount;
+    uint32_t entriesCount;
+    uint32_t stringsSize;
+} SymIdxHeader;
+
+typedef struct {
+    uint32_t name; /* Offsets into the strings */
+    uint32_t overlay;
+} SymIdxObject;
+
+typedef struct {
+    uint32_t name;
+    uint32_t firstEntry;
+    uint32_t definesCount;
+    uint32_t referencesCount;
+} SymIdxSymbol;
+
+/* Opened files at a time, to stay well inside the limit on file descriptors */
+#define SYMIDX_OPEN_BATCH 256
+
+/* One symbol of one object while building */
+typedef struct {
+    uint32_t name; /* Offset into the builder's names */
+    uint32_t object;
+    bool define;
+} SymIdxRef;
+
+VC_VECTOR_DECLARE(SymIdxRef);
+VC_VECTOR_DECLARE_NAMED(chars, char);
+VC_VECTOR_DECLARE(SymIdxObject);
+VC_VECTOR_DECLARE_NAMED(u32, uint32_t);
+
+typedef struct {
+    vc_vector_SymIdxRef refs;
+    vc_vector_chars names;    /* Of the symbols, while building */
+    vc_vector_chars strings;  /* Of the index */
+    vc_vector_SymIdxObject objects;
+    vc_vector_u32 overlays;   /* Their names in the strings */
+} SymIdxBuilder;
+
+/* An index mapped into memory */
+typedef struct {
+    const SymIdxHeader* header;
+    const SymIdxObject* objects;
+    const uint32_t* overlays;
+    const SymIdxSymbol* symbols;
+    const uint32_t* entries;
+    const char* strings;
+    size_t size;
+} SymIdxIndex;
+
+static void SymIdx_PrintUsage(const char* program) {
+    fprintf(stderr,
+            "usage: %s build INDEX OBJECT...\n"
+            "       %s defines INDEX SYMBOL...\n"
+            "       %s refs INDEX SYMBOL...\n"
+            "       %s cross INDEX [OVERLAY...]\n"
+            "build    index the global symbols of the objects, which can be archives as for fado, or - to read their\n"
+            "         names from stdin, one per line. Each object's overlay is the directory it is in.\n"
+            "defines  print the objects defining each symbol\n"
+            "refs     print the objects referring to each symbol\n"
+            "cross    print the references of objects in the overlays, or all of them, to symbols not defined in\n"
+            "         their own overlay but in another, as REFERRING_OVERLAY -> DEFINING_OVERLAY SYMBOL OBJECT\n"
+            "defines and refs exit with 1 if any symbol has none.\n",
+            program, program, program, program);
+}
+
+static uint32_t SymIdx_AddString(vc_vector_chars* strings, const char* string) {
+    uint32_t offset = vc_vector_chars_count(strings);
+
+    do {
+        vc_vector_chars_push_back(strings, *string);
+    } while (*string++ != '\0');
+    return offset;
+}
+
+/**
+ * The overlay of an input is the directory it, or its archive, is in, as for fado's default overlay name
+ */
+static uint32_t SymIdx_AddOverlay(SymIdxBuilder* builder, const char* inputName) {
+    const char* end = strrchr(inputName, '(');
+    const char* start;
+    char* name;
+    uint32_t* overlay;
+    uint32_t index = 0;
+
+    if (end == NULL) {
+        end = inputName + strlen(inputName);
+    }
+    while ((end > inputName) && (end[-1] != '/')) {
+        end--;
+    }
+    if (end == inputName) {
+        name = strdup(".");
+    } else {
+        end--;
+        for (start = end; (start > inputName) && (start[-1] != '/'); start--) {}
+        name = strndup(start, end - start);
+    }
+
+    /* Objects of the same overlay are usually together, so look from the end */
+    for (index = vc_vector_u32_count(&builder->overlays); index > 0; index--) {
+        overlay = vc_vector_u32_at(&builder->overlays, index - 1);
+        if (strcmp(vc_vector_chars_at(&builder->strings, *overlay), name) == 0) {
+            free(name);
+            return index - 1;
+        }
+    }
+    vc_vector_u32_push_back(&builder->overlays, SymIdx_AddString(&builder->strings, name));
+    free(name);
+    return vc_vector_u32_count(&builder->overlays) - 1;
+}
+
+/**
+ * Add the global symbols of one object, returning false if it is not one
+ */
+static bool SymIdx_ReadObject(SymIdxBuilder* builder, FILE* file, const char* inputName) {
+    FairyFileHeader fileHeader;
+    FairySecHeader* sectionTable;
+    FairySym* symtab = NULL;
+    size_t symbolsCount = 0;
+    char* strtab = NULL;
+    size_t strtabSize = 0;
+    SymIdxObject object;
+    size_t i;
+
+    if (Fairy_ReadFileHeader(&fileHeader, file) == NULL) {
+        fprintf(stderr, "error: '%s' is not a MIPS relocatable object\n", inputName);
+        return false;
+    }
+    sectionTable = malloc(fileHeader.e_shnum * sizeof(FairySecHeader));
+    Fairy_ReadSectionTable(sectionTable, file, fileHeader.e_shoff, fileHeader.e_shnum);
+    for (i = 0; i < fileHeader.e_shnum; i++) {
+        if ((sectionTable[i].sh_type == SHT_SYMTAB) && (sectionTable[i].sh_link < fileHeader.e_shnum)) {
+            const FairySecHeader* strtabHeader = &sectionTable[sectionTable[i].sh_link];
+
+            symbolsCount = Fairy_ReadSymbolTable(&symtab, file, sectionTable[i].sh_offset, sectionTable[i].sh_size);
+            strtabSize = strtabHeader->sh_size;
+            strtab = malloc(strtabSize + 1);
+            Fairy_ReadStringTable(strtab, file, strtabHeader->sh_offset, strtabSize);
+            strtab[strtabSize] = '\0';
+            break;
+        }
+    }
+    free(sectionTable);
+
+    object.name = SymIdx_AddString(&builder->strings, inputName);
+    object.overlay = SymIdx_AddOverlay(builder, inputName);
+    vc_vector_SymIdxObject_push_back(&builder->objects, object);
+
+    /* The first symbol is always the null one */
+    for (i = 1; i < symbolsCount; i++) {
+        const FairySym* symbol = &symtab[i];
+        int type = ELF32_ST_TYPE(symbol->st_info);
+        SymIdxRef ref;
+
+        if ((ELF32_ST_BIND(symbol->st_info) == STB_LOCAL) || (type == STT_SECTION) || (type == STT_FILE) ||
+            (symbol->st_name == 0) || (symbol->st_name >= strtabSize)) {
+            continue;
+        }
+        ref.name = SymIdx_AddString(&builder->names, &strtab[symbol->st_name]);
+        ref.object = vc_vector_SymIdxObject_count(&builder->objects) - 1;
+        ref.define = (symbol->st_shndx != SHN_UNDEF);
+        vc_vector_SymIdxRef_push_back(&builder->refs, ref);
+    }
+
+    free(strtab);
+    free(symtab);
+    return true;
+}
+
+/**
+ * Read the symbols of a batch of inputs, expanding archives and prefetching the files as fado does
+ */
+static bool SymIdx_ReadBatch(SymIdxBuilder* builder, int count, char** names) {
+    FadoInputs inputs;
+    FadoIoStats ioStats;
+    bool success = Fado_ExpandInputs(&inputs, count, names) && Fado_OpenInputs(&inputs, true, &ioStats);
+    int i;
+
+    for (i = 0; success && (i < inputs.count); i++) {
+        success = SymIdx_ReadObject(builder, inputs.files[i], inputs.names[i]);
+    }
+    Fado_CloseInputs(&inputs);
+    Fado_FreeInputs(&inputs);
+    return success;
+}
+
+/* Refs are sorted by the names in here */
+static const char* sSortNames;
+
+static int SymIdx_CompareRefs(const void* a, const void* b) {
+    const SymIdxRef* refA = a;
+    const SymIdxRef* refB = b;
+    int order = strcmp(&sSortNames[refA->name], &sSortNames[refB->name]);
+
+    if (order != 0) {
+        return order;
+    }
+    /* Definitions first */
+    if (refA->define != refB->define) {
+        return refA->define ? -1 : 1;
+    }
+    return (refA->object > refB->object) - (refA->object < refB->object);
+}
+
+static bool SymIdx_WriteIndex(SymIdxBuilder* builder, const char* indexName) {
+    size_t refsCount = vc_vector_SymIdxRef_count(&builder->refs);
+    SymIdxRef* refs = vc_vector_SymIdxRef_begin(&builder->refs);
+    char* tempName = malloc(strlen(indexName) + sizeof(".tmp"));
+    SymIdxHeader header;
+    SymIdxSymbol* symbols = malloc(refsCount * sizeof(SymIdxSymbol));
+    uint32_t* entries = malloc(refsCount * sizeof(uint32_t));
+    SymIdxSymbol* symbol = NULL;
+    uint32_t symbolsCount = 0;
+    bool success;
+    FILE* file;
+    size_t i;
+
+    sSortNames = vc_vector_chars_begin(&builder->names);
+    qsort(refs, refsCount, sizeof(SymIdxRef), SymIdx_CompareRefs);
+
+    /* The same object can list a symbol more than once, but it only needs one entry */
+    for (i = 0; i < refsCount; i++) {
+        const char* name = &sSortNames[refs[i].name];
+
+        if ((i == 0) || (strcmp(&sSortNames[refs[i - 1].name], name) != 0)) {
+            symbol = &symbols[symbolsCount++];
+            symbol->name = SymIdx_AddString(&builder->strings, name);
+            symbol->firstEntry = i;
+            symbol->definesCount = 0;
+            symbol->referencesCount = 0;
+        } else if ((refs[i].object == refs[i - 1].object) && (refs[i].define == refs[i - 1].define)) {
+            continue;
+        }
+        entries[symbol->firstEntry + symbol->definesCount + symbol->referencesCount] = refs[i].object;
+        if (refs[i].define) {
+            symbol->definesCount++;
+        } else {
+            symbol->referencesCount++;
+        }
+    }
+    /* Close up the gaps left by duplicates */
+    {
+        uint32_t next = 0;
+
+        for (i = 0; i < symbolsCount; i++) {
+            uint32_t count = symbols[i].definesCount + symbols[i].referencesCount;
+
+            memmove(&entries[next], &entries[symbols[i].firstEntry], count * sizeof(uint32_t));
+            symbols[i].firstEntry = next;
+            next += count;
+        }
+        header.entriesCount = next;
+    }
+    /* Keep everything after the strings aligned */
+    while (vc_vector_chars_count(&builder->strings) % sizeof(uint32_t) != 0) {
+        vc_vector_chars_push_back(&builder->strings, '\0');
+    }
+
+    memcpy(header.magic, SYMIDX_MAGIC, sizeof(header.magic));
+    header.objectsCount = vc_vector_SymIdxObject_count(&builder->objects);
+    header.overlaysCount = vc_vector_u32_count(&builder->overlays);
+    header.symbolsCount = symbolsCount;
+    header.stringsSize = vc_vector_chars_count(&builder->strings);
+
+    /* Written beside it and renamed over it, so that queries running meanwhile see the old or new index whole */
+    sprintf(tempName, "%s.tmp", indexName);
+    file = fopen(tempName, "wb");
+    success = (file != NULL);
+    if (success) {
+        fwrite(&header, sizeof(header), 1, file);
+        fwrite(vc_vector_SymIdxObject_begin(&builder->objects), sizeof(SymIdxObject), header.objectsCount, file);
+        fwrite(vc_vector_u32_begin(&builder->overlays), sizeof(uint32_t), header.overlaysCount, file);
+        fwrite(symbols, sizeof(SymIdxSymbol), header.symbolsCount, file);
+        fwrite(entries, sizeof(uint32_t), header.entriesCount, file);
+        fwrite(vc_vector_chars_begin(&builder->strings), 1, header.stringsSize, file);
+        success = !ferror(file);
+        success = (fclose(file) == 0) && success && (rename(tempName, indexName) == 0);
+    }
+    if (!success) {
+        fprintf(stderr, "error: unable to write index '%s'\n", indexName);
+        remove(tempName);
+    }
+
+    free(entries);
+    free(symbols);
+    free(tempName);
+    return success;
+}
+
+static int SymIdx_Build(const char* indexName, int argCount, char** args) {
+    SymIdxBuilder builder = { 0 };
+    vc_vector_chars names = { 0 };
+    char** inputNames = args;
+    int inputsCount = argCount;
+    bool success = true;
+    int i;
+
+    /* "-" reads the names from stdin, for more objects than fit on a command line */
+    if ((argCount == 1) && (strcmp(args[0], "-") == 0)) {
+        char* line = NULL;
+        size_t lineSize = 0;
+        ssize_t length;
+        size_t offset;
+
+        inputsCount = 0;
+        while ((length = getline(&line, &lineSize, stdin)) > 0) {
+            if (line[length - 1] == '\n') {
+                line[--length] = '\0';
+            }
+            if (length != 0) {
+                SymIdx_AddString(&names, line);
+                inputsCount++;
+            }
+        }
+        free(line);
+        inputNames = malloc(inputsCount * sizeof(char*));
+        for (i = 0, offset = 0; i < inputsCount; i++) {
+            inputNames[i] = vc_vector_chars_at(&names, offset);
+            offset += strlen(inputNames[i]) + 1;
+        }
+    }
+
+    for (i = 0; success && (i < inputsCount); i += SYMIDX_OPEN_BATCH) {
+        int count = (inputsCount - i < SYMIDX_OPEN_BATCH) ? inputsCount - i : SYMIDX_OPEN_BATCH;
+
+        success = SymIdx_ReadBatch(&builder, count, &inputNames[i]);
+    }
+    success = success && SymIdx_WriteIndex(&builder, indexName);
+
+    if (inputNames != args) {
+        free(inputNames);
+    }
+    vc_vector_chars_release(&names);
+    vc_vector_SymIdxRef_release(&builder.refs);
+    vc_vector_chars_release(&builder.names);
+    vc_vector_chars_release(&builder.strings);
+    vc_vector_SymIdxObject_release(&builder.objects);
+    vc_vector_u32_release(&builder.overlays);
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static bool SymIdx_OpenIndex(SymIdxIndex* index, const char* indexName) {
+    int fd = open(indexName, O_RDONLY);
+    struct stat fileStat;
+    const SymIdxHeader* header;
+    void* mapping = MAP_FAILED;
+    size_t size;
+
+    if ((fd >= 0) && (fstat(fd, &fileStat) == 0) && ((size_t)fileStat.st_size >= sizeof(SymIdxHeader))) {
+        mapping = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    if (mapping == MAP_FAILED) {
+        fprintf(stderr, "error: unable to read index '%s'\n", indexName);
+        return false;
+    }
+
+    header = mapping;
+    size = sizeof(SymIdxHeader) + (size_t)header->objectsCount * sizeof(SymIdxObject) +
+           ((size_t)header->overlaysCount + header->entriesCount) * sizeof(uint32_t) +
+           (size_t)header->symbolsCount * sizeof(SymIdxSymbol) + header->stringsSize;
+    if ((memcmp(header->magic, SYMIDX_MAGIC, sizeof(header->magic)) != 0) || (size != (size_t)fileStat.st_size)) {
+        fprintf(stderr, "error: '%s' is not a symbol index, or is from another version\n", indexName);
+        munmap(mapping, fileStat.st_size);
+        return false;
+    }
+
+    index->header = header;
+    index->objects = (const SymIdxObject*)(header + 1);
+    index->overlays = (const uint32_t*)(index->objects + header->objectsCount);
+    index->symbols = (const SymIdxSymbol*)(index->overlays + header->overlaysCount);
+    index->entries = (const uint32_t*)(index->symbols + header->symbolsCount);
+    index->strings = (const char*)(index->entries + header->entriesCount);
+    index->size = size;
+    return true;
+}
+
+static const SymIdxSymbol* SymIdx_FindSymbol(const SymIdxIndex* index, const char* name) {
+    size_t low = 0;
+    size_t high = index->header->symbolsCount;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        int order = strcmp(&index->strings[index->symbols[middle].name], name);
+
+        if (order == 0) {
+            return &index->symbols[middle];
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Print the objects defining, or referring to, each symbol. Returns whether every symbol had any.
+ */
+static bool SymIdx_QueryObjects(const SymIdxIndex* index, int count, char** symbolNames, bool defines) {
+    bool allFound = true;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        const SymIdxSymbol* symbol = SymIdx_FindSymbol(index, symbolNames[i]);
+        uint32_t first;
+        uint32_t entriesCount;
+        uint32_t entry;
+
+        if (symbol == NULL) {
+            allFound = false;
+            continue;
+        }
+        first = symbol->firstEntry + (defines ? 0 : symbol->definesCount);
+        entriesCount = defines ? symbol->definesCount : symbol->referencesCount;
+        allFound = allFound && (entriesCount != 0);
+        for (entry = first; entry < first + entriesCount; entry++) {
+            const SymIdxObject* object = &index->objects[index->entries[entry]];
+
+            if (count > 1) {
+                printf("%s ", symbolNames[i]);
+            }
+            printf("%s\n", &index->strings[object->name]);
+        }
+    }
+    return allFound;
+}
+
+static const char* SymIdx_OverlayName(const SymIdxIndex* index, uint32_t overlay) {
+    return &index->strings[index->overlays[overlay]];
+}
+
+/**
+ * Print each reference from an object in one of the overlays (or any, if none are given) to a symbol that its overlay
+ * does not define but another does
+ */
+static void SymIdx_QueryCross(const SymIdxIndex* index, int count, char** overlayNames) {
+    bool* wanted = calloc(index->header->overlaysCount, sizeof(bool));
+    uint32_t i;
+    int j;
+
+    for (i = 0; i < index->header->overlaysCount; i++) {
+        wanted[i] = (count == 0);
+        for (j = 0; j < count; j++) {
+            wanted[i] = wanted[i] || (strcmp(SymIdx_OverlayName(index, i), overlayNames[j]) == 0);
+        }
+    }
+
+    for (i = 0; i < index->header->symbolsCount; i++) {
+        const SymIdxSymbol* symbol = &index->symbols[i];
+        const uint32_t* defining = &index->entries[symbol->firstEntry];
+        const uint32_t* referring = defining + symbol->definesCount;
+        uint32_t r;
+
+        if (symbol->definesCount == 0) {
+            continue;
+        }
+        for (r = 0; r < symbol->referencesCount; r++) {
+            uint32_t overlay = index->objects[referring[r]].overlay;
+            uint32_t d;
+
+            if (!wanted[overlay]) {
+                continue;
+            }
+            for (d = 0; d < symbol->definesCount; d++) {
+                if (index->objects[defining[d]].overlay == overlay) {
+                    break;
+                }
+            }
+            if (d == symbol->definesCount) {
+                printf("%s -> %s %s %s\n", SymIdx_OverlayName(index, overlay),
+                       SymIdx_OverlayName(index, index->objects[defining[0]].overlay),
+                       &index->strings[symbol->name], &index->strings[index->objects[referring[r]].name]);
+            }
+        }
+    }
+    free(wanted);
+}
+
+int main(int argc, char** argv) {
+    SymIdxIndex index;
+    bool success = true;
+
+    if (argc < 3) {
+        SymIdx_PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (strcmp(argv[1], "build") == 0) {
+        return SymIdx_Build(argv[2], argc - 3, &argv[3]);
+    }
+    if ((strcmp(argv[1], "defines") != 0) && (strcmp(argv[1], "refs") != 0) && (strcmp(argv[1], "cross") != 0)) {
+        SymIdx_PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!SymIdx_OpenIndex(&index, argv[2])) {
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "cross") == 0) {
+        SymIdx_QueryCross(&index, argc - 3, &argv[3]);
+    } else {
+        success = SymIdx_QueryObjects(&index, argc - 3, &argv[3], strcmp(argv[1], "defines") == 0);
+    }
+    munmap((void*)index.header, index.size);
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}